@@ -1,36 +1,150 @@
-#include <iostream>
-#include <vector>
-#include "BranchAndBound.h"
-#include "ProblemReader.h"
-
-int main() {
-    try {
-        ProblemReader reader;
-        glp_prob* raw_problem = reader.read("/app/tests/teste3_19.txt");
-
-        // Wrap the raw pointer in a unique_ptr
-        using GLPProbPtr = std::unique_ptr<glp_prob, GLPKProbDeleter>;
-        GLPProbPtr problem(raw_problem, GLPKProbDeleter());
-
-        BranchAndBound bb;
-        std::vector<int> solution;
-        double objective_value = 0.0;
-
-        SolveStatus status = bb.solve(std::move(problem), solution, objective_value, true); // true for DFS
-        if (status == SolveStatus::OK) {
-            std::cout << "Optimal solution found: z = " << objective_value << "\n";
-            for (size_t i = 0; i < solution.size(); ++i) {
-                std::cout << "x" << (i + 1) << " = " << solution[i] << "\n";
-            }
-        } else {
-            std::cerr << "Failed to solve the problem.\n";
-        }
-    } catch (const std::exception& e) {
-        std::cerr << "Error: " << e.what() << std::endl;
-        return -1;
-    }
-
-    return 0;
-}
-
-
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "BatchSolver.h"
+#include "Logger.h"
+
+namespace {
+    // Instância padrão quando nenhuma entrada é informada (mantém o comportamento anterior)
+    const char* DEFAULT_INSTANCE = "/app/tests/teste3_19.txt";
+
+    void printUsage(std::ostream& out, const char* program) {
+        out << "Uso: " << program << " [opções] <arquivo|diretório|@manifesto>...\n"
+            << "\n"
+            << "Resolve cada instância e escreve uma linha por resultado (objetivo, status, nós, tempo).\n"
+            << "\n"
+            << "Opções:\n"
+            << "  -j, --jobs N            instâncias resolvidas em paralelo (padrão: número de núcleos)\n"
+            << "  -t, --threads N         threads de busca por instância (padrão: 1)\n"
+            << "      --time-limit S      limite de tempo por instância, em segundos\n"
+            << "      --node-limit N      limite de nós por instância\n"
+            << "      --gap G             gap relativo aceito como ótimo (ex.: 0.01 para 1%)\n"
+            << "      --abs-gap G         gap absoluto aceito como ótimo\n"
+            << "      --progress S        linha de progresso a cada S segundos (ativa o nível info)\n"
+            << "      --node-selection S  dfs, bfs, best-bound, best-estimate ou hybrid\n"
+            << "      --memory-limit MB   memória dos nós abertos por instância; o excedente vai para disco\n"
+            << "      --spill-dir DIR     diretório do arquivo de transbordo de nós (padrão: temporário)\n"
+            << "      --format F          jsonl (padrão) ou csv\n"
+            << "  -o, --output ARQUIVO    grava os resultados no arquivo em vez da saída padrão\n"
+            << "      --solution          inclui o vetor solução em cada resultado\n"
+            << "      --log-level L       trace, debug, info, warning (padrão), error ou off\n"
+            << "  -h, --help              mostra esta ajuda\n";
+    }
+
+    NodeSelection parseNodeSelection(const std::string& name) {
+        if (name == "dfs") return NodeSelection::DEPTH_FIRST;
+        if (name == "bfs") return NodeSelection::BREADTH_FIRST;
+        if (name == "best-bound") return NodeSelection::BEST_BOUND;
+        if (name == "best-estimate") return NodeSelection::BEST_ESTIMATE;
+        if (name == "hybrid") return NodeSelection::HYBRID;
+        throw std::invalid_argument("Estratégia de seleção de nós desconhecida: " + name);
+    }
+
+    OutputFormat parseFormat(const std::string& name) {
+        if (name == "jsonl" || name == "json") return OutputFormat::JSON_LINES;
+        if (name == "csv") return OutputFormat::CSV;
+        throw std::invalid_argument("Formato de saída desconhecido: " + name);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        // Nível de log opcional via ambiente: trace, debug, info, warning, error ou off.
+        // Com várias instâncias em paralelo apenas avisos e erros são mostrados por padrão.
+        Logger::instance().setLevel(LogLevel::WARNING);
+        if (const char* level = std::getenv("BB_LOG_LEVEL")) {
+            Logger::instance().setLevel(Logger::parseLevel(level));
+        }
+
+        BranchAndBoundOptions options;
+        int jobs = 0;
+        OutputFormat format = OutputFormat::JSON_LINES;
+        std::string output_path;
+        bool include_solution = false;
+        std::vector<std::string> inputs;
+
+        for (int k = 1; k < argc; ++k) {
+            const std::string arg = argv[k];
+            auto value = [&]() -> std::string {
+                if (k + 1 >= argc) {
+                    throw std::invalid_argument("Valor ausente para " + arg);
+                }
+                return argv[++k];
+            };
+            if (arg == "-h" || arg == "--help") {
+                printUsage(std::cout, argv[0]);
+                return 0;
+            } else if (arg == "-j" || arg == "--jobs") {
+                jobs = std::stoi(value());
+            } else if (arg == "-t" || arg == "--threads") {
+                options.num_threads = std::stoi(value());
+            } else if (arg == "--time-limit") {
+                options.time_limit = std::stod(value());
+            } else if (arg == "--node-limit") {
+                options.node_limit = std::stoll(value());
+            } else if (arg == "--gap") {
+                options.relative_gap = std::stod(value());
+            } else if (arg == "--abs-gap") {
+                options.absolute_gap = std::stod(value());
+            } else if (arg == "--progress") {
+                options.progress_interval = std::stod(value());
+                if (Logger::instance().level() > LogLevel::INFO) {
+                    Logger::instance().setLevel(LogLevel::INFO);
+                }
+            } else if (arg == "--node-selection") {
+                options.node_selection = parseNodeSelection(value());
+            } else if (arg == "--memory-limit") {
+                options.node_memory_limit = static_cast<std::size_t>(std::stod(value()) * 1024.0 * 1024.0);
+            } else if (arg == "--spill-dir") {
+                options.spill_directory = value();
+            } else if (arg == "--format") {
+                format = parseFormat(value());
+            } else if (arg == "-o" || arg == "--output") {
+                output_path = value();
+            } else if (arg == "--solution") {
+                include_solution = true;
+            } else if (arg == "--log-level") {
+                Logger::instance().setLevel(Logger::parseLevel(value()));
+            } else if (arg.size() > 1 && arg[0] == '-') {
+                printUsage(std::cerr, argv[0]);
+                return 2;
+            } else {
+                inputs.push_back(arg);
+            }
+        }
+        if (inputs.empty()) {
+            inputs.push_back(DEFAULT_INSTANCE);
+        }
+
+        std::ofstream file;
+        if (!output_path.empty()) {
+            file.open(output_path, std::ios::trunc);
+            if (!file) {
+                throw std::runtime_error("Falha ao abrir o arquivo de saída: " + output_path);
+            }
+        }
+        std::ostream& out = output_path.empty() ? std::cout : file;
+
+        const std::vector<std::string> instances = BatchSolver::expandInputs(inputs);
+        BatchSolver batch(options, jobs);
+        BatchSolver::writeHeader(out, format, include_solution);
+        const std::vector<BatchResult> results = batch.run(instances, [&](const BatchResult& result) {
+            BatchSolver::write(out, result, format, include_solution);
+        });
+
+        // Código de saída diferente de zero se alguma instância falhou
+        for (const BatchResult& result : results) {
+            if (result.status == SolveStatus::ERROR) {
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include "BinaryInstance.h"
+#include "GLPKSolver.h"
+#include "ProblemReader.h"
+
+// Converte instâncias (texto denso, MPS ou LP) para o formato binário .bbin.
+// Uso: bb_convert <entrada> <saída.bbin>
+//      bb_convert <entrada>...   (cada saída ao lado da entrada, com extensão .bbin)
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Uso: " << argv[0] << " <entrada> <saída.bbin> | " << argv[0] << " <entrada>...\n";
+        return 1;
+    }
+    const bool explicit_output = argc == 3 && std::filesystem::path(argv[2]).extension() == ".bbin";
+    const int num_inputs = explicit_output ? 1 : argc - 1;
+
+    int failures = 0;
+    for (int k = 1; k <= num_inputs; ++k) {
+        const std::string input = argv[k];
+        const std::string output = explicit_output
+            ? std::string(argv[2])
+            : std::filesystem::path(input).replace_extension(".bbin").string();
+        try {
+            ProblemReader reader;
+            GLPProbPtr problem(reader.read(input), GLPKProbDeleter());
+            BinaryInstance::write(problem.get(), output);
+            std::cout << input << " -> " << output << " (" << glp_get_num_cols(problem.get()) << " variáveis, "
+                      << glp_get_num_rows(problem.get()) << " restrições)\n";
+        } catch (const std::exception& e) {
+            std::cerr << "Erro ao converter " << input << ": " << e.what() << std::endl;
+            ++failures;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,70 @@
+#ifndef BASIS_POOL_H
+#define BASIS_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "GLPKSolver.h"
+
+/// @brief Bases do simplex guardadas nos nós abertos (e na tabela de relaxações), recicladas.
+/// @details Cada base é entregue como std::shared_ptr cujo objeto e bloco de controle vêm de listas
+/// livres do pool: quando a última referência some, os dois voltam ao pool, e o objeto mantém a
+/// capacidade dos seus vetores. Depois que a busca atinge seu tamanho de trabalho, guardar a base de
+/// um nó não aloca memória. Pode ser usado por várias threads; o pool precisa sobreviver a todas as
+/// bases entregues por ele.
+class BasisPool {
+public:
+    BasisPool() = default;
+    BasisPool(const BasisPool&) = delete;
+    BasisPool& operator=(const BasisPool&) = delete;
+    ~BasisPool();
+
+    /// @brief Base atual do solver (ver GLPKSolver::saveBasis).
+    std::shared_ptr<const LpBasis> save(const GLPKSolver& solver);
+
+    /// @brief Bases em uso.
+    std::size_t liveBases() const;
+
+    /// @brief Bases alocadas (em uso ou livres).
+    std::size_t capacity() const;
+
+private:
+    // Devolve a base ao pool quando a última referência é destruída
+    struct Recycler {
+        BasisPool* pool;
+        void operator()(LpBasis* basis) const noexcept;
+    };
+
+    // Alocador dos blocos de controle do shared_ptr (todos do mesmo tipo, logo do mesmo tamanho)
+    template <class T>
+    struct BlockAllocator {
+        using value_type = T;
+
+        BasisPool* pool;
+
+        explicit BlockAllocator(BasisPool* owner) noexcept : pool(owner) {}
+        template <class U>
+        BlockAllocator(const BlockAllocator<U>& other) noexcept : pool(other.pool) {}
+
+        T* allocate(std::size_t count) { return static_cast<T*>(pool->allocateBlock(count * sizeof(T))); }
+        void deallocate(T* block, std::size_t count) noexcept { pool->releaseBlock(block, count * sizeof(T)); }
+
+        template <class U>
+        bool operator==(const BlockAllocator<U>& other) const noexcept { return pool == other.pool; }
+        template <class U>
+        bool operator!=(const BlockAllocator<U>& other) const noexcept { return pool != other.pool; }
+    };
+
+    void* allocateBlock(std::size_t bytes);
+    void releaseBlock(void* block, std::size_t bytes) noexcept;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<LpBasis>> bases_;
+    std::vector<LpBasis*> free_bases_;
+    std::vector<void*> blocks_;      // Blocos de controle alocados (liberados no destrutor)
+    std::vector<void*> free_blocks_;
+    std::size_t block_size_ = 0;     // Tamanho do bloco de controle (definido na primeira alocação)
+};
+
+#endif // BASIS_POOL_H
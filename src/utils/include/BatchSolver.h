@@ -0,0 +1,74 @@
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "BranchAndBoundOptions.h"
+#include "SolveStats.h"
+#include "SolveStatus.h"
+
+/// @brief Resultado da resolução de uma instância do lote.
+struct BatchResult {
+    std::string instance;              // Caminho do arquivo
+    SolveStatus status = SolveStatus::ERROR;
+    bool has_solution = false;         // objective e solution só são válidos com incumbente
+    double objective = 0.0;
+    SolveStats stats;
+    std::vector<int> solution;
+    std::string error;                 // Mensagem de erro de leitura/resolução (vazia se não houve)
+};
+
+/// @brief Formatos de saída legíveis por máquina.
+enum class OutputFormat {
+    JSON_LINES, // Um objeto JSON por linha
+    CSV         // Cabeçalho seguido de uma linha por instância
+};
+
+/// @brief Resolve muitas instâncias em paralelo, uma por thread de trabalho.
+/// @details Cada thread lê e resolve suas instâncias do início ao fim (leitura, presolve e busca), de
+/// modo que os problemas GLPK nunca são compartilhados entre threads; o ambiente do GLPK de cada
+/// thread é liberado quando ela termina. O paralelismo é entre instâncias: para lotes grandes ele
+/// rende mais do que paralelizar a árvore de uma única instância (options.num_threads).
+class BatchSolver {
+public:
+    using ResultCallback = std::function<void(const BatchResult&)>;
+
+    /// @param options Parâmetros aplicados a cada instância (inclusive limites de tempo e de nós).
+    /// @param jobs Número de instâncias resolvidas ao mesmo tempo (<= 0: número de núcleos).
+    BatchSolver(BranchAndBoundOptions options, int jobs);
+
+    /// @brief Resolve as instâncias e entrega cada resultado assim que ele fica pronto.
+    /// @details O callback é chamado sob exclusão mútua, na ordem de término. Falhas de uma
+    /// instância (arquivo inválido, por exemplo) são registradas no resultado e não interrompem o lote.
+    /// @return Os resultados na ordem das instâncias de entrada.
+    std::vector<BatchResult> run(const std::vector<std::string>& instances, const ResultCallback& on_result = {}) const;
+
+    /// @brief Resolve uma única instância na thread atual.
+    BatchResult solveOne(const std::string& instance) const;
+
+    /// @brief Expande as entradas da linha de comando em uma lista de arquivos.
+    /// @details Arquivos são mantidos; diretórios contribuem com seus arquivos regulares (em ordem
+    /// alfabética, sem recursão); "@lista" lê um caminho por linha de um manifesto, ignorando linhas
+    /// vazias e comentários iniciados por '#'. Caminhos relativos do manifesto partem do seu diretório.
+    /// @throws std::invalid_argument se uma entrada não existir.
+    static std::vector<std::string> expandInputs(const std::vector<std::string>& inputs);
+
+    /// @brief Escreve o cabeçalho do formato (apenas CSV possui cabeçalho).
+    static void writeHeader(std::ostream& out, OutputFormat format, bool include_solution);
+
+    /// @brief Escreve um resultado como uma linha no formato pedido.
+    static void write(std::ostream& out, const BatchResult& result, OutputFormat format, bool include_solution);
+
+    /// @brief Nome do status usado na saída ("optimal", "feasible", "limit", ...).
+    static const char* statusName(SolveStatus status);
+
+    int jobs() const noexcept { return jobs_; }
+
+private:
+    BranchAndBoundOptions options_;
+    int jobs_;
+};
+
+#endif // BATCH_SOLVER_H
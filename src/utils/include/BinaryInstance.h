@@ -0,0 +1,35 @@
+#ifndef BINARY_INSTANCE_H
+#define BINARY_INSTANCE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <glpk.h>
+
+/// @brief Formato binário versionado de instâncias (extensão .bbin), lido sem interpretação de texto.
+/// @details Layout (little-endian), com todas as seções alinhadas em 8 bytes:
+/// - cabeçalho de 64 bytes: identificador, versão, flags (bit 0: maximização), marcador de ordem dos
+///   bytes, dimensões, constante do objetivo, tamanho e checksum do conteúdo;
+/// - double: objetivo[n], limites das colunas (inferior[n], superior[n]) e das linhas (inferior[m],
+///   superior[m]), com ±infinito para lados ausentes, e coeficientes[nnz + 1];
+/// - int32: início das linhas[m + 1] e colunas (base 1)[nnz + 1].
+/// A posição 0 de coeficientes e colunas é reservada, para que cada linha seja entregue ao GLPK
+/// (glp_set_mat_row, que lê a partir do índice 1) direto da memória mapeada, sem cópias.
+class BinaryInstance {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// @brief Grava o problema no formato binário.
+    /// @throws std::runtime_error se o arquivo não puder ser escrito.
+    static void write(glp_prob* problem, const std::string& path);
+
+    /// @brief Cria o problema GLPK a partir do conteúdo de um arquivo binário (tipicamente mapeado).
+    /// @throws std::invalid_argument se identificador, versão, tamanho ou checksum não conferirem, se a
+    /// matriz tiver colunas repetidas numa linha ou se alguma coluna tiver limites fora de [0, 1].
+    static glp_prob* load(std::string_view contents);
+
+    /// @brief Indica se o conteúdo começa com o identificador do formato.
+    static bool matches(std::string_view contents) noexcept;
+};
+
+#endif // BINARY_INSTANCE_H
@@ -0,0 +1,48 @@
+#ifndef BOUND_TRAIL_H
+#define BOUND_TRAIL_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <glpk.h>
+
+/// @brief Trilha de alterações de limites de colunas sobre um único problema GLPK.
+/// @details Permite que a busca reutilize um mesmo glp_prob para todos os nós: cada nó é apenas
+/// a lista de fixações (variável, valor) desde a raiz. Ao mudar de nó, a trilha desfaz as fixações
+/// que não pertencem ao prefixo comum e aplica as novas, com custo O(profundidade) em vez de uma
+/// cópia completa da matriz.
+class BoundTrail {
+public:
+    /// @brief Cria uma trilha vazia sobre o problema informado (não assume a posse do ponteiro).
+    explicit BoundTrail(glp_prob* problem);
+
+    // A trilha referencia o problema; cópias deixariam dois donos das mesmas alterações
+    BoundTrail(const BoundTrail&) = delete;
+    BoundTrail& operator=(const BoundTrail&) = delete;
+
+    /// @brief Leva o problema ao estado do nó descrito por fixed_vars.
+    /// @param fixed_vars Fixações (índice base 0, valor) na ordem em que foram feitas desde a raiz.
+    void moveTo(const std::vector<std::pair<int, int>>& fixed_vars);
+
+    /// @brief Desfaz todas as fixações, restaurando os limites originais.
+    void reset();
+
+    /// @brief Número de fixações atualmente aplicadas.
+    std::size_t depth() const noexcept { return trail_.size(); }
+
+private:
+    struct Entry {
+        int var;
+        int value;
+        int old_type;
+        double old_lb;
+        double old_ub;
+    };
+
+    void undoTo(std::size_t size);
+
+    glp_prob* problem_;
+    std::vector<Entry> trail_;
+};
+
+#endif // BOUND_TRAIL_H
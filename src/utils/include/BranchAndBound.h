@@ -1,49 +1,40 @@
 #ifndef BRANCH_AND_BOUND_H
 #define BRANCH_AND_BOUND_H
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <vector>
 #include <utility>
 #include <memory>
 #include <functional>
+#include <limits>
+#include "BasisPool.h"
 #include "GLPKSolver.h"
+#include "Heuristics.h"
+#include "BoundTrail.h"
+#include "BranchingRule.h"
+#include "Conflicts.h"
+#include "Cuts.h"
+#include "Incumbent.h"
+#include "Lagrangian.h"
+#include "LpCache.h"
+#include "Node.h"
+#include "NodeSelector.h"
+#include "ProblemModel.h"
+#include "Propagator.h"
+#include "Symmetry.h"
+#include "SolveStats.h"
+#include "BranchAndBoundOptions.h"
+#include "WarmStart.h"
 
-// Enum para representar o tipo de nó
-enum class NodeType {
-    ROOT,
-    LEFT_CHILD,  // x_j = 0
-    RIGHT_CHILD  // x_j = 1
-};
-
-// Estrutura para representar um nó na árvore de Branch and Bound
-struct Node {
-    std::unique_ptr<GLPKSolver> solver;
-    std::vector<std::pair<int, int>> fixed_vars;
-    double bound;
-    NodeType type;
-
-    // Construtor principal
-    Node(
-        std::unique_ptr<GLPKSolver> solver,
-        std::vector<std::pair<int, int>> fixed,
-        double b,
-        NodeType t
-    );
-
-    // Construtor de movimento
-    Node(Node&& other) noexcept;
-
-    // Operações de cópia desabilitadas
-    Node(const Node&) = delete;
-    Node& operator=(const Node&) = delete;
-
-    // Operador de atribuição por movimento
-    Node& operator=(Node&& other) noexcept;
-};
+class Postsolve;
 
 // Classe principal para o algoritmo Branch and Bound
 class BranchAndBound {
 public:
     explicit BranchAndBound();
+    explicit BranchAndBound(BranchAndBoundOptions options);
 
     // Operações de cópia desabilitadas
     BranchAndBound(const BranchAndBound&) = delete;
@@ -55,17 +46,136 @@ public:
 
     ~BranchAndBound() = default;
 
-    // Método principal para resolver o problema
+    // Método principal para resolver o problema (estratégia definida nas opções)
+    SolveStatus solve(
+        GLPProbPtr original_problem, 
+        std::vector<int>& solution, 
+        double& objective_value
+    );
+
+    // Mantido por compatibilidade: true para busca em profundidade, false para busca em largura
     SolveStatus solve(
         GLPProbPtr original_problem, 
         std::vector<int>& solution, 
         double& objective_value, 
-        bool use_depth_first = true
+        bool use_depth_first
     );
 
+    // Resolve usando uma estratégia de seleção de nós fornecida pelo chamador
+    SolveStatus solve(
+        GLPProbPtr original_problem, 
+        std::vector<int>& solution, 
+        double& objective_value, 
+        std::unique_ptr<NodeSelector> selector
+    );
+
+    // Resolve a partir de uma execução anterior: a solução anterior vira o incumbente inicial se
+    // continuar viável e, com frontier_complete, os nós abertos substituem a raiz (ver WarmStart).
+    // Lança std::invalid_argument se a solução ou os nós não tiverem o número de colunas do problema.
+    SolveStatus solve(
+        GLPProbPtr original_problem,
+        std::vector<int>& solution,
+        double& objective_value,
+        const WarmStart& start
+    );
+
+    // Aplica a alteração ao problema (o mesmo modelo da última chamada de solve()) e o resolve a partir
+    // de warmStart(). Os nós abertos só são reaproveitados se a alteração apenas restringe o modelo;
+    // mudanças no objetivo ou nos coeficientes reaproveitam só a solução anterior.
+    SolveStatus resolve(
+        GLPProbPtr problem,
+        const ModelDelta& delta,
+        std::vector<int>& solution,
+        double& objective_value
+    );
+
+    const BranchAndBoundOptions& options() const noexcept { return options_; }
+    BranchAndBoundOptions& options() noexcept { return options_; }
+
+    // Estatísticas da última chamada de solve()
+    const SolveStats& stats() const noexcept { return stats_; }
+
+    // Solução e fronteira da árvore deixadas pela última chamada de solve(), no espaço original
+    const WarmStart& warmStart() const noexcept { return last_run_; }
+
 private:
+    // Resultado do processamento de um nó
+    enum class NodeOutcome {
+        PRUNED,            // Limite não supera o incumbente
+        INFEASIBLE,        // Relaxação inviável ou erro do simplex
+        INTEGER,           // Solução inteira que não melhora o incumbente
+        INCUMBENT_UPDATED, // Solução inteira que passou a ser o incumbente
+        BRANCHED           // Solução fracionária: filhos criados
+    };
+
+    // LP de uma thread de busca: no modo SHARED_TRAIL (e em cada thread da busca paralela)
+    // um único problema é reutilizado via trilha; no modo COPY_PER_NODE cada nó traz o seu.
+    struct SearchLp {
+        std::unique_ptr<GLPKSolver> solver;
+        std::unique_ptr<BoundTrail> trail;
+        long long lp_iterations = 0;
+        std::size_t synced_cuts = 0; // Cortes do pool já repassados a este LP
+        SolveStats stats;            // Contadores e tempos desta thread, somados no fim da busca
+        std::vector<std::pair<int, int>> fixed_vars; // Fixações do nó em processamento (capacidade reaproveitada)
+        std::vector<double> relaxed_solution;        // Solução do LP do nó em processamento
+        std::vector<double> reduced_costs;           // Custos reduzidos do LP do nó em processamento
+        LagrangianWorkspace lagrangian;
+        PropagatorWorkspace propagation;
+        SymmetryWorkspace symmetry;
+        ConflictWorkspace conflicts;
+        double closed_bound = -std::numeric_limits<double>::infinity(); // Maior limite podado só pela tolerância de gap
+    };
+
+    // Contagem de nós e critérios de parada de uma execução, compartilhados pelas threads
+    struct SearchControl {
+        std::atomic<long long> nodes{0};
+        std::atomic<bool> limit_reached{false};
+        long long node_limit = 0; // <= 0: sem limite
+        bool has_deadline = false;
+        std::chrono::steady_clock::time_point deadline;
+
+        std::chrono::steady_clock::time_point start;
+        double objective_sign = 1.0; // -1 quando o problema original é de minimização
+        double progress_interval = 0.0;
+        std::atomic<std::chrono::steady_clock::rep> next_progress{0};
+
+        // Maior limite entre os nós que ficaram abertos ao fim da busca
+        double open_bound = -std::numeric_limits<double>::infinity();
+
+        // Nós iniciais no lugar da raiz (espaço reduzido, limite interno), usados quando seeded
+        bool seeded = false;
+        std::vector<OpenNode> roots;
+
+        // Nós abertos ao fim de uma busca interrompida por limite (espaço reduzido, limite interno)
+        std::vector<OpenNode> frontier;
+
+        // Indica se a busca deve parar antes do próximo nó; registra quando um limite é atingido
+        bool shouldStop();
+
+        // Indica se já é hora de uma linha de progresso; apenas uma thread recebe cada uma
+        bool progressDue();
+    };
+
+    BranchAndBoundOptions options_;
+    SolveStats stats_;
+    WarmStart last_run_;
     double best_objective_;
     std::vector<int> best_solution_;
+    std::vector<double> objective_coefs_; // Coeficientes da função objetivo (índice base 0)
+    std::unique_ptr<PseudoCosts> pseudo_costs_;
+    std::unique_ptr<BranchingRule> branching_rule_;
+    std::unique_ptr<ProblemModel> model_;        // Formulação lida uma vez por execução
+    std::unique_ptr<Propagator> propagator_;
+    std::unique_ptr<ColumnSymmetry> symmetry_; // Nulo sem classes de colunas idênticas
+    std::unique_ptr<PrimalHeuristics> heuristics_;
+    std::unique_ptr<CutSeparator> cut_separator_;
+    std::unique_ptr<CutPool> cut_pool_;
+    std::unique_ptr<ConflictAnalyzer> conflict_analyzer_;
+    std::unique_ptr<ConflictPool> conflict_pool_; // Nulo com a análise de conflitos desativada
+    std::unique_ptr<FixingArena> fixing_arena_;    // Fixações dos nós da execução corrente
+    std::unique_ptr<BasisPool> basis_pool_;        // Bases dos nós e da tabela de relaxações (destruído depois dela)
+    std::unique_ptr<LpCache> lp_cache_;            // Mantida entre execuções (nula se desligada)
+    std::unique_ptr<LagrangianBound> lagrangian_;  // Nulo se desligado ou se o modelo não for uma mochila
 
     // Métodos auxiliares
     GLPProbPtr copyProblem(glp_prob* original) const;
@@ -79,18 +189,113 @@ private:
     ) const;
     int selectBranchingVariable(const std::vector<double>& solution) const;
 
-    // Função auxiliar para criar nós filhos
+    // Estima o melhor objetivo inteiro do filho que fixa branching_var em value
+    double estimateChildObjective(
+        const std::vector<double>& solution,
+        double node_objective,
+        int branching_var,
+        int value
+    ) const;
+
+    // Cria os nós filhos e os entrega a node_sink (qualquer chamável com Node&&, despachado sem
+    // std::function). fixed_vars são as fixações do nó já com as implicadas pela propagação.
+    template <typename NodeSink>
     void createChildNodes(
         Node&& current_node,
+        const std::vector<std::pair<int, int>>& fixed_vars,
         int branching_var,
-        std::function<void(Node&&)> node_processor
+        double node_objective,
+        const std::vector<double>& relaxed_solution,
+        std::shared_ptr<const LpBasis> parent_basis,
+        NodeSink& node_sink
     );
 
-    // Verifica se a solução é viável
-    bool isSolutionFeasible(
-        glp_prob* problem, 
-        const std::vector<int>& solution
-    ) const;
+    // Rodadas de separação de cortes sobre a relaxação já resolvida do nó; retira do LP os cortes
+    // inativos há options_.cuts.max_age separações. Retorna o status da última reotimização.
+    SolveStatus separateCuts(
+        GLPKSolver& solver,
+        std::vector<double>& relaxed_solution,
+        double& objective,
+        int depth,
+        const Incumbent& incumbent,
+        SearchLp& search_lp
+    );
+
+    // Resolve a relaxação do nó; se o simplex parar no limite de SimplexParams, continua da base
+    // alcançada sem limite (podar o nó perderia a subárvore)
+    SolveStatus solveRelaxation(GLPKSolver& solver, std::vector<double>& relaxed_solution,
+                                double& objective, SearchLp& lp) const;
+
+    // Inclui no LP de uma thread os cortes que outras threads colocaram no pool
+    void syncCuts(GLPKSolver& solver, std::size_t& synced_cuts);
+
+    // Resolve a relaxação de um nó e poda, atualiza o incumbente ou ramifica.
+    // Pode ser chamado por várias threads ao mesmo tempo: só lê o estado do objeto.
+    template <typename NodeSink>
+    NodeOutcome processNode(
+        Node&& current_node,
+        SearchLp& lp,
+        Incumbent& incumbent,
+        NodeSink& node_sink
+    );
+
+    // Indica se um nó com este limite pode ser podado: não supera o incumbente por mais que a
+    // tolerância de gap. Limites podados apenas pela tolerância ficam em lp.closed_bound.
+    bool prunedByBound(double bound, const Incumbent& incumbent, SearchLp& lp) const;
+
+    // Maior limite podado com o incumbente informado (incumbente mais a tolerância de gap)
+    double pruneCutoff(double primal) const;
+
+    // Inclui no pool o nogood aprendido em um nó podado
+    void learnConflict(Conflict conflict, SolveStats& stats) const;
+
+    // Contabiliza o resultado de um nó nas estatísticas da thread
+    static void recordOutcome(SolveStats& stats, NodeOutcome outcome);
+
+    // Registra no log uma linha de progresso (sentido original do objetivo)
+    void logProgress(const SearchControl& control, const Incumbent& incumbent,
+                     long long processed, long long open_nodes, double open_bound) const;
+
+    // Registra no log o resumo de stats_
+    void logStats() const;
+
+    // Busca sequencial guiada pela estratégia de seleção de nós
+    void searchSequential(
+        GLPProbPtr problem,
+        NodeSelector& selector,
+        Incumbent& incumbent,
+        SearchControl& control,
+        long long& lp_iterations
+    );
+
+    // Busca paralela com deques por thread e roubo de trabalho
+    void searchParallel(
+        GLPProbPtr problem,
+        int num_threads,
+        Incumbent& incumbent,
+        SearchControl& control,
+        long long& lp_iterations
+    );
+
+    // Implementação de solve(): start vazio resolve do zero
+    SolveStatus solveFrom(
+        GLPProbPtr original_problem,
+        std::vector<int>& solution,
+        double& objective_value,
+        std::unique_ptr<NodeSelector> selector,
+        const WarmStart& start
+    );
+
+    // Escolhe o algoritmo pela estrutura do modelo reduzido e, se não for o LP, resolve com ele.
+    // Retorna false quando a busca com LP deve rodar; completed indica se o algoritmo terminou.
+    bool solveWithoutLp(Incumbent& incumbent, SearchControl& control, bool& completed);
+
+    // Leva o ponto de partida ao espaço reduzido: semeia o incumbente e, se válidos, os nós iniciais
+    void seedWarmStart(const WarmStart& start, const Postsolve* postsolve,
+                       Incumbent& incumbent, SearchControl& control) const;
+
+    // Verifica se a solução é viável nas linhas do modelo (sem alocação)
+    bool isSolutionFeasible(const std::vector<int>& solution) const;
 };
 
-#endif // BRANCH_AND_BOUND_H
\ No newline at end of file
+#endif // BRANCH_AND_BOUND_H
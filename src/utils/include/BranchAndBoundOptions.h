@@ -0,0 +1,150 @@
+#ifndef BRANCH_AND_BOUND_OPTIONS_H
+#define BRANCH_AND_BOUND_OPTIONS_H
+
+#include "BranchingRule.h"
+#include "Conflicts.h"
+#include "Cuts.h"
+#include "GLPKSolver.h"
+#include "Heuristics.h"
+#include "KnapsackEngines.h"
+#include "Lagrangian.h"
+#include "NodeSelector.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// @brief Como cada nó obtém o seu problema de programação linear.
+enum class LpStrategy {
+    COPY_PER_NODE, // Cada nó possui uma cópia completa do glp_prob (glp_copy_prob)
+    SHARED_TRAIL   // Um único glp_prob reutilizado; o nó guarda apenas suas fixações
+};
+
+/// @brief Melhora do incumbente entregue a BranchAndBoundOptions::on_incumbent.
+struct IncumbentUpdate {
+    double objective;                 // Valor no sentido original do problema
+    const std::vector<int>& solution; // Variáveis originais (já mapeadas pelo postsolve)
+    double seconds;                   // Tempo desde o início de solve()
+    long long nodes;                  // Nós processados até a melhora
+};
+
+/// @brief Parâmetros de configuração do Branch and Bound.
+struct BranchAndBoundOptions {
+    /// @brief Estratégia de seleção de nós usada por solve() quando nenhuma outra é informada.
+    NodeSelection node_selection = NodeSelection::DEPTH_FIRST;
+
+    /// @brief Número máximo de nós consecutivos de um mergulho na estratégia híbrida.
+    int max_plunge_depth = 10;
+
+    /// @brief Estratégia de gerenciamento das relaxações lineares dos nós.
+    /// @details Com SHARED_TRAIL, criar um nó não aloca memória depois que a busca atinge seu tamanho de
+    /// trabalho: as fixações vêm da FixingArena, a base de warm_start do BasisPool, e a propagação, a
+    /// simetria, os conflitos e a solução do LP usam vetores reaproveitados pela thread. Ainda alocam o
+    /// próprio GLPK, as heurísticas primais, os cortes, o strong branching e os nogoods aprendidos.
+    /// COPY_PER_NODE aloca além disso uma cópia do glp_prob para cada filho da esquerda.
+    LpStrategy lp_strategy = LpStrategy::SHARED_TRAIL;
+
+    /// @brief Parâmetros do simplex usados em todas as relaxações dos nós.
+    SimplexParams simplex;
+
+    /// @brief Reotimiza cada filho a partir da base ótima do pai.
+    /// @details A base é guardada uma vez por nó ramificado, num objeto reciclado (ver BasisPool).
+    bool warm_start = true;
+
+    /// @brief Regra de escolha da variável de ramificação.
+    BranchingStrategy branching = BranchingStrategy::MOST_FRACTIONAL;
+
+    /// @brief Observações por direção a partir das quais o pseudo-custo é considerado confiável.
+    int reliability_threshold = 4;
+
+    /// @brief Máximo de variáveis avaliadas por strong branching em cada nó (RELIABILITY).
+    int strong_branching_candidates = 8;
+
+    /// @brief Limite de iterações do dual simplex em cada avaliação de strong branching.
+    int strong_branching_iterations = 25;
+
+    /// @brief Algoritmo exato. AUTO examina o problema reduzido: mochila de uma restrição (pesos não
+    /// negativos, linha <=) vai para o branch and bound combinatório, mochila de várias restrições com pesos
+    /// e capacidades inteiros pequenos para a programação dinâmica, e o resto para o branch and bound com
+    /// LP. Um algoritmo forçado que não se aplica ao problema cai no branch and bound com LP. Os algoritmos
+    /// sem LP não são usados quando há nós iniciais de uma execução anterior (WarmStart).
+    SolverEngine engine = SolverEngine::AUTO;
+
+    /// @brief Reduz o problema antes da busca (fixações, linhas redundantes, redução de coeficientes e
+    /// colunas dominadas); a solução encontrada é mapeada de volta para as variáveis originais.
+    bool presolve = true;
+
+    /// @brief Propaga as fixações de cada nó sobre as restrições antes de resolver a relaxação,
+    /// fixando as variáveis que não cabem na folga restante e podando nós inviáveis sem chamar o simplex.
+    bool propagation = true;
+
+    /// @brief Fixa, após a relaxação de cada nó, as variáveis cujo custo reduzido prova que
+    /// não podem melhorar o incumbente; as fixações valem para toda a subárvore.
+    bool reduced_cost_fixing = true;
+
+    /// @brief Detecta colunas idênticas (objetivo e coeficientes) e impõe a ordem x_{c_1} >= x_{c_2} >= ...
+    /// dentro de cada classe por fixação orbital, para que as permutações equivalentes não sejam exploradas.
+    bool symmetry = true;
+
+    /// @brief Frequências das heurísticas primais (gulosa, arredondamento, mergulhos) e busca local.
+    HeuristicParams heuristics;
+
+    /// @brief Separação de cortes (coberturas com lifting e cliques) na raiz e, opcionalmente, na árvore.
+    CutParams cuts;
+
+    /// @brief Análise de conflitos: nós podados por inviabilidade ou pelo limite deixam nogoods (subconjuntos
+    /// pequenos das suas fixações), verificados nos nós seguintes antes do LP.
+    ConflictParams conflicts;
+
+    /// @brief Poda por relaxação lagrangiana em mochilas multidimensionais: cada nó é limitado por um passe
+    /// guloso com os multiplicadores da raiz (reotimizados no nó quando não podam) e o LP só é resolvido se
+    /// esse limite não podar. Ignorada quando o problema reduzido não tem a forma W x <= c com W >= 0.
+    LagrangianParams lagrangian;
+
+    /// @brief Tempo máximo de solve(), em segundos (<= 0: sem limite). Ao atingi-lo a busca para e
+    /// solve() devolve FEASIBLE com o melhor incumbente encontrado, ou LIMIT_REACHED se não houver.
+    double time_limit = 0.0;
+
+    /// @brief Número máximo de nós processados (<= 0: sem limite), com o mesmo comportamento.
+    long long node_limit = 0;
+
+    /// @brief Tolerâncias de otimalidade: nós cujo limite não supera o incumbente por mais que
+    /// max(absolute_gap, relative_gap * |incumbente|) são podados, e solve() devolve OK quando a árvore
+    /// restante é fechada por elas (o gap final fica em SolveStats::gap). Zero exige o ótimo exato.
+    double relative_gap = 0.0;
+    double absolute_gap = 0.0;
+
+    /// @brief Chamada a cada melhora do incumbente, com a solução já no espaço original.
+    /// @details Na busca paralela pode vir de qualquer thread, mas as chamadas são serializadas; a função
+    /// deve retornar rápido, pois as threads que encontram soluções esperam por ela.
+    std::function<void(const IncumbentUpdate&)> on_incumbent;
+
+    /// @brief Intervalo, em segundos, entre linhas de progresso no log (nível INFO) com nós processados,
+    /// nós abertos, incumbente, melhor limite e gap (<= 0: desligado).
+    double progress_interval = 0.0;
+
+    /// @brief Orçamento, em bytes, para os nós abertos da busca sequencial (0: sem limite).
+    /// @details Sob pressão os nós perdem a cópia do problema e a base do pai (passam a usar o LP
+    /// compartilhado), a busca mergulha em profundidade e, acima do orçamento, os nós de menor limite
+    /// vão para um arquivo temporário (ver MemoryBoundedSelector). Na busca paralela os nós já guardam
+    /// só as fixações e a opção é ignorada.
+    std::size_t node_memory_limit = 0;
+
+    /// @brief Diretório do arquivo de transbordo de nós (vazio: diretório temporário do sistema).
+    std::string spill_directory;
+
+    /// @brief Orçamento, em bytes, da tabela de relaxações resolvidas (0: desligada).
+    /// @details A tabela (LpCache) guarda limite e base de cada conjunto de fixações resolvido e é mantida
+    /// entre chamadas de solve() e resolve() do mesmo objeto: nas execuções seguintes sobre o mesmo modelo,
+    /// ou uma restrição dele, nós repetidos são podados sem LP ou partem da base guardada. Numa única
+    /// execução os conjuntos de fixações não se repetem e a tabela só custa.
+    std::size_t lp_cache_bytes = 0;
+
+    /// @brief Número de threads de busca. Com mais de uma thread cada uma mantém sua própria cópia
+    /// do problema (o GLPK não é thread-safe por objeto) com trilha de limites, e os nós abertos ficam
+    /// em deques por thread com roubo de trabalho; node_selection e lp_strategy valem só para a busca
+    /// sequencial. Zero usa std::thread::hardware_concurrency().
+    int num_threads = 1;
+};
+
+#endif // BRANCH_AND_BOUND_OPTIONS_H
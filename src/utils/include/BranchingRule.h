@@ -0,0 +1,122 @@
+#ifndef BRANCHING_RULE_H
+#define BRANCHING_RULE_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "GLPKSolver.h"
+
+/// @brief Regras de escolha da variável de ramificação disponíveis.
+enum class BranchingStrategy {
+    MOST_FRACTIONAL, // Variável mais próxima de 0.5 (comportamento original)
+    PSEUDO_COST,     // Maior degradação estimada pelos pseudo-custos aprendidos
+    RELIABILITY      // Pseudo-custos, com strong branching enquanto não forem confiáveis
+};
+
+/// @brief Pseudo-custos por variável: degradação média do objetivo por unidade de fracionariedade.
+/// @details Aprendidos a partir dos filhos resolvidos (e do strong branching). É compartilhado entre as
+/// threads da busca paralela, por isso todas as operações são protegidas por mutex.
+class PseudoCosts {
+public:
+    explicit PseudoCosts(int num_vars);
+
+    PseudoCosts(const PseudoCosts&) = delete;
+    PseudoCosts& operator=(const PseudoCosts&) = delete;
+
+    /// @brief Registra uma observação.
+    /// @param var Variável ramificada (base 0).
+    /// @param value Lado do filho (0: x_j = 0, 1: x_j = 1).
+    /// @param distance Distância entre o valor fracionário e o valor fixado (f ou 1 - f).
+    /// @param degradation Queda do objetivo da relaxação do pai para o filho.
+    void update(int var, int value, double distance, double degradation);
+
+    /// @brief Pseudo-custo por unidade na direção informada.
+    /// @details Sem observações para a variável, usa a média de todas as variáveis (ou 1 se não houver nenhuma).
+    double unitCost(int var, int value) const;
+
+    /// @brief Número de observações da variável na direção informada.
+    int observations(int var, int value) const;
+
+    /// @brief Número de observações da direção menos observada da variável.
+    int reliability(int var) const;
+
+    /// @brief Pontuação pelo produto das degradações estimadas nas duas direções.
+    double score(int var, double fractional_value) const;
+
+private:
+    double unitCostLocked(int var, int value) const;
+
+    mutable std::mutex mutex_;
+    std::vector<double> sum_[2];
+    std::vector<int> count_[2];
+    double total_sum_[2];
+    int total_count_[2];
+};
+
+/// @brief Dados do nó disponíveis para a regra de ramificação.
+struct BranchingContext {
+    GLPKSolver& solver;                      // LP do nó, já resolvido (base ótima carregada)
+    const std::vector<double>& solution;     // Solução da relaxação
+    double objective;                        // Objetivo da relaxação
+    long long& lp_iterations;                // Iterações do simplex da thread (somadas as do strong branching)
+};
+
+/// @brief Interface das regras de ramificação.
+/// @details select() pode ser chamado por várias threads ao mesmo tempo, cada uma com o seu LP.
+class BranchingRule {
+public:
+    virtual ~BranchingRule() = default;
+
+    /// @brief Escolhe a variável de ramificação (base 0) ou -1 se não houver variável fracionária.
+    virtual int select(const BranchingContext& context) const = 0;
+
+    /// @brief Nome da regra (para logs).
+    virtual const char* name() const = 0;
+};
+
+/// @brief Variável mais fracionária (mais próxima de 0.5).
+class MostFractionalRule : public BranchingRule {
+public:
+    int select(const BranchingContext& context) const override;
+    const char* name() const override { return "most-fractional"; }
+};
+
+/// @brief Ramificação por pseudo-custos.
+class PseudoCostRule : public BranchingRule {
+public:
+    explicit PseudoCostRule(const PseudoCosts& pseudo_costs);
+    int select(const BranchingContext& context) const override;
+    const char* name() const override { return "pseudo-cost"; }
+
+private:
+    const PseudoCosts& pseudo_costs_;
+};
+
+/// @brief Ramificação por confiabilidade (reliability branching).
+/// @details Variáveis com menos de reliability_threshold observações em alguma direção são avaliadas por
+/// strong branching (dual simplex com poucas iterações sobre as duas fixações); o resultado alimenta os
+/// pseudo-custos. As demais usam apenas a pontuação dos pseudo-custos.
+class ReliabilityRule : public BranchingRule {
+public:
+    ReliabilityRule(PseudoCosts& pseudo_costs, int reliability_threshold, int max_candidates, int iteration_limit);
+    int select(const BranchingContext& context) const override;
+    const char* name() const override { return "reliability"; }
+
+private:
+    PseudoCosts& pseudo_costs_;
+    int reliability_threshold_;
+    int max_candidates_;
+    int iteration_limit_;
+};
+
+/// @brief Cria a regra correspondente ao enum. As regras baseadas em pseudo-custos guardam uma referência
+/// para pseudo_costs, que deve sobreviver à regra.
+std::unique_ptr<BranchingRule> makeBranchingRule(
+    BranchingStrategy strategy,
+    PseudoCosts& pseudo_costs,
+    int reliability_threshold,
+    int max_candidates,
+    int iteration_limit
+);
+
+#endif // BRANCHING_RULE_H
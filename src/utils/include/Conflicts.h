@@ -0,0 +1,113 @@
+#ifndef CONFLICTS_H
+#define CONFLICTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+#include "ProblemModel.h"
+
+/// @brief Parâmetros da análise de conflitos.
+struct ConflictParams {
+    int pool_size = 1000; // Nogoods mantidos (0 desativa a análise); os mais antigos são substituídos
+    int max_size = 24;    // Nogoods com mais fixações são descartados (específicos demais para se repetir)
+};
+
+/// @brief Nogood: nenhuma solução com todas as fixações (índice base 0, valor) vale mais que bound.
+/// @details bound = -infinito quando as fixações tornam o problema inviável.
+struct Conflict {
+    std::vector<std::pair<int, int>> fixings;
+    double bound = -std::numeric_limits<double>::infinity();
+};
+
+/// @brief Deriva, de um nó podado, um subconjunto pequeno das fixações responsável pela poda.
+/// @details Os métodos são const e podem ser chamados por várias threads ao mesmo tempo.
+class ConflictAnalyzer {
+public:
+    /// @param model Modelo do problema; deve sobreviver ao analisador.
+    explicit ConflictAnalyzer(const ProblemModel& model);
+
+    /// @brief Explica a inviabilidade de uma linha violada pela propagação.
+    /// @details Escolhe, em ordem decrescente de contribuição, as fixações que aproximam a atividade
+    /// mínima (ou máxima) da linha do limite violado até que ele seja excedido.
+    /// @return false se as fixações não violam a linha (nenhum conflito).
+    bool explainRow(int row, const std::vector<std::pair<int, int>>& fixed_vars, Conflict& conflict) const;
+
+    /// @brief Explica a poda pelo limite de um LP resolvido até a otimalidade.
+    /// @details Com a solução dual do LP, liberar a fixação x_j = v para 0 <= x_j <= 1 aumenta o limite
+    /// em no máximo max(0, d_j) (v = 0) ou max(0, -d_j) (v = 1). As fixações de menor ganho são liberadas
+    /// enquanto o limite resultante não passar de cutoff; as demais formam o nogood.
+    /// @param fixed_vars Fixações do nó (todas as colunas fixadas no LP).
+    /// @param reduced_costs Custos reduzidos do LP (convenção do GLPK para maximização).
+    /// @param lp_objective Objetivo do LP.
+    /// @param cutoff Limite abaixo do qual nós são podados (incumbente mais a tolerância de gap).
+    static Conflict explainBound(
+        const std::vector<std::pair<int, int>>& fixed_vars,
+        const std::vector<double>& reduced_costs,
+        double lp_objective,
+        double cutoff
+    );
+
+private:
+    const ProblemModel& model_;
+};
+
+/// @brief Resultado da verificação de um nó contra o pool.
+struct ConflictCheck {
+    bool pruned = false; // O nó contém todas as fixações de um nogood
+    int implied = 0;     // Fixações acrescentadas pelos nogoods com uma única fixação livre
+    // Limite do nogood que podou o nó ou, sem poda, o maior entre os que fixaram variáveis
+    double bound = -std::numeric_limits<double>::infinity();
+};
+
+/// @brief Memória de trabalho de uma thread para ConflictPool::check() (reaproveitada entre nós).
+struct ConflictWorkspace {
+    std::vector<std::int8_t> value; // Por coluna: valor fixado ou livre (todas livres entre chamadas)
+    std::vector<int> matched;       // Por nogood: fixações presentes no nó (zeradas entre chamadas)
+    std::vector<int> touched;       // Nogoods com alguma fixação presente no nó
+};
+
+/// @brief Pool de nogoods compartilhado pelas threads de uma execução.
+/// @details Um nogood com limite B poda todo nó que contém suas fixações quando B não supera o corte
+/// corrente; como o incumbente só melhora, ele nunca deixa de valer. Se falta ao nó apenas uma das
+/// fixações e a variável está livre, o valor oposto é fixado. O pool tem capacidade fixa e substitui
+/// os nogoods mais antigos. Os nogoods são indexados por fixação: um nó só visita os que compartilham
+/// alguma fixação com ele (e os de até uma fixação), e só examina os que lhe faltam no máximo uma.
+/// As verificações das threads correm em paralelo; add() as exclui enquanto altera o pool.
+class ConflictPool {
+public:
+    ConflictPool(int num_cols, const ConflictParams& params);
+    ConflictPool(const ConflictPool&) = delete;
+    ConflictPool& operator=(const ConflictPool&) = delete;
+
+    /// @brief Inclui um nogood.
+    /// @return false se ele foi descartado (maior que max_size).
+    bool add(Conflict conflict);
+
+    /// @brief Verifica as fixações do nó contra os nogoods com limite <= cutoff.
+    /// @param fixed_vars Fixações do nó; as implicadas pelos nogoods são acrescentadas ao final.
+    ConflictCheck check(std::vector<std::pair<int, int>>& fixed_vars, double cutoff) const;
+
+    /// @brief Como check(fixed_vars, cutoff), sem alocar memória depois da primeira chamada com o workspace.
+    ConflictCheck check(std::vector<std::pair<int, int>>& fixed_vars, double cutoff,
+                        ConflictWorkspace& workspace) const;
+
+    std::size_t size() const;
+
+private:
+    int num_cols_;
+    ConflictParams params_;
+    // Nogood na posição id, indexado pelas suas fixações (ou em short_ se tiver no máximo uma)
+    void index(int id);
+    void unindex(int id);
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Conflict> entries_;
+    std::vector<std::vector<int>> occurrences_; // Por fixação (2 * coluna + valor): nogoods que a contêm
+    std::vector<int> short_;                    // Nogoods com no máximo uma fixação (verificados em todo nó)
+    std::size_t next_ = 0; // Próxima posição substituída com o pool cheio
+};
+
+#endif // CONFLICTS_H
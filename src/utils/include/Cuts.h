@@ -0,0 +1,122 @@
+#ifndef CUTS_H
+#define CUTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <glpk.h>
+#include "ProblemModel.h"
+
+/// @brief Parâmetros da separação de cortes.
+struct CutParams {
+    bool cover_cuts = true;        // Coberturas minimais com lifting sequencial
+    bool clique_cuts = true;       // Cliques do grafo de conflitos entre pares de variáveis
+    int root_rounds = 20;          // Rodadas de separação na raiz (0 desativa os cortes)
+    int tree_frequency = -1;       // -1: só na raiz; k: também nos nós com profundidade múltipla de k
+    int tree_rounds = 1;           // Rodadas de separação em cada nó da árvore
+    int max_cuts_per_round = 50;   // Cortes incluídos no LP por rodada (os de maior eficácia)
+    double min_violation = 1e-3;   // Violação mínima para um corte ser incluído
+    int max_age = 3;               // Separações consecutivas com o corte inativo antes de retirá-lo do LP
+};
+
+/// @brief Famílias de cortes.
+enum class CutType {
+    COVER,
+    CLIQUE
+};
+
+/// @brief Desigualdade válida sum(coefs[k] * x[vars[k]]) <= rhs (índices base 0).
+struct Cut {
+    CutType type;
+    std::vector<int> vars;
+    std::vector<double> coefs;
+    double rhs;
+
+    /// @brief Quanto a solução viola o corte (negativo se satisfeito).
+    double violation(const std::vector<double>& solution) const;
+
+    /// @brief Violação dividida pela norma euclidiana dos coeficientes.
+    double efficacy(const std::vector<double>& solution) const;
+};
+
+/// @brief Separação de cortes a partir das linhas mochila do modelo (a >= 0, a·x <= b).
+/// @details Os cortes gerados não dependem das fixações do nó e são válidos em toda a árvore.
+/// separate() é const e pode ser chamado por várias threads ao mesmo tempo.
+class CutSeparator {
+public:
+    /// @param model Modelo do problema; deve sobreviver ao separador.
+    CutSeparator(const ProblemModel& model, const CutParams& params);
+
+    /// @brief Cortes violados pela solução da relaxação, em ordem decrescente de eficácia.
+    std::vector<Cut> separate(const std::vector<double>& solution) const;
+
+    /// @brief Desigualdade de cobertura (com lifting) de uma linha mochila, se violada.
+    bool separateCover(int row, const std::vector<double>& solution, Cut& cut) const;
+
+    /// @brief Indica se x_i = x_j = 1 é impossível em alguma linha mochila.
+    bool conflict(int i, int j) const;
+
+    bool hasConflictGraph() const noexcept { return conflict_dim_ > 0; }
+
+private:
+    void separateCliques(const std::vector<double>& solution, std::vector<Cut>& cuts) const;
+
+    const ProblemModel& model_;
+    CutParams params_;
+    std::vector<int> knapsack_rows_;
+    int conflict_dim_;                  // Dimensão da matriz de conflitos (0 se não construída)
+    std::vector<std::uint64_t> conflicts_; // Matriz de adjacência em bits, linha a linha
+};
+
+/// @brief Pool de cortes compartilhado pelas threads de uma execução.
+/// @details Cada corte recebe um identificador sequencial. O pool descarta duplicatas, mantém a idade
+/// de cada corte (separações consecutivas em que esteve inativo) e inclui/identifica as linhas dos cortes
+/// nos problemas GLPK pelo nome da linha.
+class CutPool {
+public:
+    CutPool() = default;
+    CutPool(const CutPool&) = delete;
+    CutPool& operator=(const CutPool&) = delete;
+
+    /// @brief Inclui um corte.
+    /// @return Identificador do corte (o existente, se for duplicata) e se ele é novo.
+    std::pair<int, bool> add(Cut cut);
+
+    /// @brief Número de cortes já incluídos (os identificadores vão de 0 a size() - 1).
+    std::size_t size() const;
+
+    /// @brief Cópia do corte de identificador id.
+    Cut get(int id) const;
+
+    /// @brief Cortes do pool violados pela solução, exceto os marcados em skip (indexado pelo id).
+    std::vector<int> violated(
+        const std::vector<double>& solution,
+        double min_violation,
+        const std::vector<char>& skip
+    ) const;
+
+    /// @brief Atualiza a idade do corte: zera se ativo, incrementa se inativo.
+    /// @return Idade resultante.
+    int age(int id, bool active);
+
+    /// @brief Inclui o corte como nova linha do problema.
+    static void addToProblem(glp_prob* lp, int id, const Cut& cut);
+
+    /// @brief Identificador do corte da linha (base 1), ou -1 se a linha não for um corte.
+    static int idOfRow(glp_prob* lp, int row);
+
+private:
+    struct Entry {
+        Cut cut;
+        int age = 0;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+    std::unordered_multimap<std::uint64_t, int> index_; // Hash do corte -> identificador
+};
+
+#endif // CUTS_H
@@ -0,0 +1,95 @@
+#ifndef FIXING_ARENA_H
+#define FIXING_ARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+class FixingArena;
+
+/// @brief Elo de uma lista de fixações: uma fixação e o elo anterior (em direção à raiz).
+struct FixingLink {
+    FixingLink* parent = nullptr;       // Na lista livre da arena, o próximo elo livre
+    std::int32_t var = 0;               // Índice base 0
+    std::int32_t value = 0;
+    std::uint32_t length = 0;           // Fixações da raiz até este elo
+    std::atomic<std::uint32_t> refs{0}; // Cadeias e elos filhos que apontam para este elo
+};
+
+/// @brief Fixações de um nó, da raiz até o próprio nó, compartilhadas com os ancestrais.
+/// @details Os dois filhos de um nó apontam para o último elo do pai e acrescentam um elo cada: criar
+/// um filho não copia as fixações herdadas. Copiar a cadeia só incrementa uma contagem de referências
+/// (atômica, então nós podem migrar entre threads); o último elo liberado volta à arena. A arena
+/// precisa sobreviver a todas as cadeias criadas nela.
+class FixingChain {
+public:
+    FixingChain() noexcept = default;
+    FixingChain(const FixingChain& other) noexcept;
+    FixingChain(FixingChain&& other) noexcept;
+    FixingChain& operator=(const FixingChain& other) noexcept;
+    FixingChain& operator=(FixingChain&& other) noexcept;
+    ~FixingChain();
+
+    std::size_t size() const noexcept { return tail_ ? tail_->length : 0; }
+    bool empty() const noexcept { return tail_ == nullptr; }
+
+    /// @brief Arena dos elos (nula para a cadeia vazia).
+    FixingArena* arena() const noexcept { return arena_; }
+
+    /// @brief Escreve as fixações em out, na ordem em que foram feitas desde a raiz.
+    /// @details Reaproveita a capacidade de out: sem alocação quando ela já basta.
+    void materialize(std::vector<std::pair<int, int>>& out) const;
+
+    std::vector<std::pair<int, int>> toVector() const;
+
+private:
+    friend class FixingArena;
+
+    FixingChain(FixingLink* tail, FixingArena* arena) noexcept : tail_(tail), arena_(arena) {}
+
+    FixingLink* tail_ = nullptr;
+    FixingArena* arena_ = nullptr;
+};
+
+/// @brief Pool de elos de fixação de uma execução, alocados em blocos e reciclados.
+/// @details Os elos liberados entram numa lista livre e são reutilizados pelos próximos nós: depois que
+/// a árvore atinge seu tamanho de trabalho, criar nós não aloca memória. Pode ser usada por várias
+/// threads; a trava protege apenas a lista livre.
+class FixingArena {
+public:
+    static constexpr std::size_t BLOCK_LINKS = 4096;
+
+    FixingArena() = default;
+    FixingArena(const FixingArena&) = delete;
+    FixingArena& operator=(const FixingArena&) = delete;
+
+    /// @brief Cadeia base acrescida da fixação (var, value).
+    /// @param base Cadeia vazia ou criada nesta arena.
+    FixingChain extend(const FixingChain& base, int var, int value);
+
+    /// @brief Cadeia com as fixações informadas, na ordem dada.
+    FixingChain make(const std::vector<std::pair<int, int>>& fixings);
+
+    /// @brief Elos em uso.
+    std::size_t liveLinks() const;
+
+    /// @brief Elos alocados (em uso ou livres).
+    std::size_t capacity() const;
+
+private:
+    friend class FixingChain;
+
+    // Devolve o elo e, em cascata, os ancestrais que ficam sem referências
+    void release(FixingLink* link) noexcept;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<FixingLink[]>> blocks_;
+    FixingLink* free_ = nullptr;
+    std::size_t live_ = 0;
+};
+
+#endif // FIXING_ARENA_H
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <climits>
 #include <glpk.h>
 #include <stdexcept>
 #include <string>
@@ -18,6 +19,26 @@ struct GLPKProbDeleter {
 
 using GLPProbPtr = std::unique_ptr<glp_prob, GLPKProbDeleter>;
 
+/// @brief Parâmetros do simplex repassados ao glp_smcp.
+/// @details O padrão é o dual simplex sem presolve: após fixar uma variável, a base ótima do pai
+/// continua dual viável e a reotimização costuma levar poucas iterações.
+struct SimplexParams {
+    int method = GLP_DUALP;              // GLP_PRIMAL, GLP_DUALP ou GLP_DUAL
+    bool presolve = false;               // O presolve do GLPK descarta a base inicial
+    int iteration_limit = INT_MAX;       // Limite de iterações por chamada
+    int time_limit_ms = INT_MAX;         // Limite de tempo por chamada (ms)
+    int message_level = GLP_MSG_ERR;     // Nível de mensagens do GLPK (repassadas ao Logger)
+};
+
+/// @brief Base do simplex (status de linhas e colunas) usada para warm start.
+/// @details Os vetores usam índice base 1, como no GLPK; a posição 0 não é utilizada.
+struct LpBasis {
+    std::vector<int> row_stat;
+    std::vector<int> col_stat;
+
+    bool empty() const noexcept { return col_stat.empty(); }
+};
+
 class GLPKSolver {
 public:
     /// @brief Construtor padrão.
@@ -45,8 +66,43 @@ public:
     /// @details Este método resolve o problema GLPK e armazena a solução e o valor objetivo.
     /// @param solution Vetor onde a solução será armazenada.
     /// @param objective_value Variável onde o valor objetivo será armazenado.
-    /// @return O status da solução: OK, INFEASIBLE, UNBOUNDED, ERROR, FRACTIONAL
+    /// @return O status da solução: OK, INFEASIBLE, UNBOUNDED, ERROR, FRACTIONAL, ou LP_LIMIT quando o
+    /// simplex para no limite de iterações ou de tempo (a base alcançada fica no problema para continuar)
     SolveStatus solve(std::vector<double>& solution, double& objective_value);
+
+    /// @brief Define os parâmetros usados nas próximas chamadas de solve().
+    void setSimplexParams(const SimplexParams& params) noexcept { params_ = params; }
+    const SimplexParams& getSimplexParams() const noexcept { return params_; }
+
+    /// @brief Custos reduzidos das colunas (índice base 0) da última chamada de solve().
+    /// @details Deve ser chamado logo após solve(): probeFixing() e restoreBasis() invalidam a solução dual.
+    void getReducedCosts(std::vector<double>& reduced_costs) const;
+
+    /// @brief Salva a base corrente (status de todas as linhas e colunas).
+    LpBasis saveBasis() const;
+
+    /// @brief Salva a base corrente em basis, reaproveitando a capacidade dos seus vetores.
+    void saveBasis(LpBasis& basis) const;
+
+    /// @brief Restaura uma base salva anteriormente.
+    /// @details A base é ignorada se as dimensões não corresponderem ao problema atual
+    /// (por exemplo, após a inclusão de cortes).
+    /// @return true se a base foi aplicada.
+    bool restoreBasis(const LpBasis& basis);
+
+    /// @brief Avalia tentativamente a fixação de uma variável (strong branching).
+    /// @details Fixa a coluna, reotimiza com o dual simplex limitado a iteration_limit iterações a partir
+    /// da base corrente e restaura limites e base ao final. Se o limite de iterações for atingido, o valor
+    /// retornado é o objetivo da base dual viável corrente, que continua sendo um limite superior válido.
+    /// @param var Índice da variável (base 0).
+    /// @param value Valor da fixação.
+    /// @param iteration_limit Máximo de iterações do dual simplex.
+    /// @param objective Limite do objetivo com a fixação (somente se o retorno for OK).
+    /// @return OK, INFEASIBLE ou ERROR.
+    SolveStatus probeFixing(int var, double value, int iteration_limit, double& objective);
+
+    /// @brief Iterações do simplex gastas na última chamada de solve().
+    int lastIterationCount() const noexcept { return last_iterations_; }
     
     /// @brief Retorna o ponteiro para o problema GLPK.
     /// @details Este método retorna o ponteiro para o problema GLPK.
@@ -64,6 +120,12 @@ private:
     /// @brief Ponteiro único para o problema GLPK.
     /// @details Este ponteiro único é responsável por gerenciar a memória do problema GLPK. Segue: <glp_prob, GLPKProbDeleter>
     GLPProbPtr problem_;
+
+    /// @brief Parâmetros do simplex aplicados em cada chamada de solve().
+    SimplexParams params_;
+
+    /// @brief Iterações da última chamada de solve().
+    int last_iterations_ = 0;
 };
 
 #endif // GLPK_SOLVER_H
\ No newline at end of file
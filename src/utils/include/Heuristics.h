@@ -0,0 +1,176 @@
+#ifndef HEURISTICS_H
+#define HEURISTICS_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "GLPKSolver.h"
+#include "Incumbent.h"
+#include "ProblemModel.h"
+
+/// @brief Frequências e limites das heurísticas primais.
+/// @details Frequência em profundidade da árvore: -1 desativa, 0 executa só na raiz e k executa nos nós
+/// cuja profundidade é múltipla de k.
+struct HeuristicParams {
+    int greedy_frequency = 0;               // Construção gulosa pela razão lucro/peso
+    int rounding_frequency = 1;             // Arredondamento da relaxação com reparo
+    int fractional_diving_frequency = 10;   // Mergulho fixando a variável menos fracionária
+    int coefficient_diving_frequency = 10;  // Mergulho fixando a variável com menos travas
+    int diving_max_depth = 50;              // Máximo de relaxações resolvidas por mergulho
+    bool local_search = true;               // 1-opt/2-swap sobre cada novo incumbente
+};
+
+/// @brief Contadores de uma heurística. Atômicos: as threads da busca paralela compartilham as heurísticas.
+struct HeuristicStats {
+    std::atomic<long long> calls{0};
+    std::atomic<long long> successes{0};     // Execuções que melhoraram o incumbente
+    std::atomic<long long> lp_iterations{0};
+    std::atomic<long long> time_us{0};
+};
+
+/// @brief Dados do nó disponíveis para as heurísticas.
+struct HeuristicContext {
+    const std::vector<double>& relaxation;              // Solução da relaxação do nó
+    double lp_objective;                                // Objetivo da relaxação
+    const std::vector<std::pair<int, int>>& fixed_vars; // Fixações do nó (respeitadas pelas heurísticas)
+    int depth;
+    double incumbent;                                   // Valor do incumbente no início da chamada
+    GLPKSolver* solver;                                 // LP do nó já resolvido (nulo se indisponível)
+};
+
+/// @brief Interface das heurísticas executadas nos nós.
+/// @details run() pode ser chamado por várias threads ao mesmo tempo, cada uma com o seu LP.
+/// Heurísticas que alteram o LP devem restaurar limites e base antes de retornar.
+class PrimalHeuristic {
+public:
+    PrimalHeuristic(const ProblemModel& model, int frequency);
+    virtual ~PrimalHeuristic() = default;
+
+    /// @brief Procura uma solução viável a partir do nó.
+    /// @param solution Solução 0/1 encontrada (somente se o retorno for true).
+    /// @param lp_iterations Acumula as iterações do simplex gastas.
+    /// @return true se encontrou uma solução candidata (a viabilidade é conferida pelo chamador).
+    virtual bool run(const HeuristicContext& context, std::vector<int>& solution, long long& lp_iterations) const = 0;
+
+    /// @brief Nome da heurística (para logs).
+    virtual const char* name() const = 0;
+
+    /// @brief Indica se a heurística deve ser executada em um nó da profundidade informada.
+    bool shouldRun(int depth) const noexcept;
+
+    HeuristicStats& stats() noexcept { return stats_; }
+    const HeuristicStats& stats() const noexcept { return stats_; }
+
+protected:
+    const ProblemModel& model_;
+
+private:
+    int frequency_;
+    HeuristicStats stats_;
+};
+
+/// @brief Construção gulosa: respeita as fixações do nó e inclui as variáveis livres em ordem decrescente
+/// de lucro por peso normalizado (soma de a_ij / b_i nas linhas <=) enquanto couberem.
+class GreedyHeuristic : public PrimalHeuristic {
+public:
+    GreedyHeuristic(const ProblemModel& model, int frequency);
+    bool run(const HeuristicContext& context, std::vector<int>& solution, long long& lp_iterations) const override;
+    const char* name() const override { return "greedy"; }
+
+private:
+    std::vector<int> order_; // Variáveis em ordem decrescente de razão lucro/peso
+};
+
+/// @brief Arredonda a relaxação para o inteiro mais próximo, remove as variáveis menos confiáveis
+/// (menor valor na relaxação) das linhas violadas e completa com as que ainda couberem.
+class RoundingHeuristic : public PrimalHeuristic {
+public:
+    RoundingHeuristic(const ProblemModel& model, int frequency);
+    bool run(const HeuristicContext& context, std::vector<int>& solution, long long& lp_iterations) const override;
+    const char* name() const override { return "rounding"; }
+};
+
+/// @brief Regras de escolha da variável fixada a cada passo do mergulho.
+enum class DivingRule {
+    FRACTIONAL,  // Variável mais próxima de um inteiro, fixada nesse inteiro
+    COEFFICIENT  // Variável com menos travas (linhas que podem ser violadas) na direção do arredondamento
+};
+
+/// @brief Mergulho na relaxação: fixa uma variável fracionária, reotimiza e repete até a relaxação ficar
+/// inteira, inviável ou sem chance de superar o incumbente. Uma fixação que torna o LP inviável é
+/// trocada pelo valor oposto uma vez. Limites e base do LP do nó são restaurados ao final.
+class DivingHeuristic : public PrimalHeuristic {
+public:
+    DivingHeuristic(const ProblemModel& model, int frequency, DivingRule rule, int max_depth);
+    bool run(const HeuristicContext& context, std::vector<int>& solution, long long& lp_iterations) const override;
+    const char* name() const override;
+
+private:
+    // Escolhe a variável e o valor da próxima fixação; retorna -1 se a relaxação já for inteira
+    int selectVariable(const std::vector<double>& relaxation, const std::vector<char>& fixed, int& value) const;
+
+    DivingRule rule_;
+    int max_depth_;
+    std::vector<int> up_locks_;   // Linhas que x_j = 1 pode violar
+    std::vector<int> down_locks_; // Linhas que x_j = 0 pode violar
+};
+
+/// @brief Busca local sobre soluções viáveis: 1-opt (inclui variáveis que cabem) e 2-swap (troca uma
+/// variável da solução por uma de maior lucro fora dela) até não haver movimento de melhora.
+/// @details As colunas são visitadas em ordem decrescente de lucro: o 1-opt é um único passe guloso, e
+/// o 2-swap só considera como entrada as colunas livres mais lucrativas. Cada chamada tem um orçamento
+/// fixo de colunas visitadas, esgotado o qual a busca para com a melhor solução encontrada.
+class LocalSearch {
+public:
+    explicit LocalSearch(const ProblemModel& model);
+
+    /// @brief Melhora a solução no lugar.
+    /// @return true se a solução foi melhorada.
+    bool improve(std::vector<int>& solution) const;
+
+    HeuristicStats& stats() noexcept { return stats_; }
+    const HeuristicStats& stats() const noexcept { return stats_; }
+
+private:
+    const ProblemModel& model_;
+    HeuristicStats stats_;
+    std::vector<int> by_profit_; // Colunas em ordem decrescente de lucro
+};
+
+/// @brief Conjunto de heurísticas primais de uma execução do Branch and Bound.
+/// @details Executa as heurísticas de nó conforme as frequências, confere a viabilidade das soluções no
+/// modelo, atualiza o incumbente e aplica a busca local a cada novo incumbente.
+class PrimalHeuristics {
+public:
+    /// @param model Modelo do problema; deve sobreviver ao objeto.
+    PrimalHeuristics(const ProblemModel& model, const HeuristicParams& params);
+
+    /// @brief Executa as heurísticas programadas para o nó.
+    /// @return true se o incumbente foi melhorado.
+    bool runAtNode(const HeuristicContext& context, Incumbent& incumbent, long long& lp_iterations);
+
+    /// @brief Confere a viabilidade de uma solução candidata e tenta torná-la incumbente.
+    /// @details Se ela atualizar o incumbente, a busca local tenta melhorá-la.
+    /// @param source Estatísticas da heurística de origem (sucesso contabilizado se houver melhora).
+    /// @return true se o incumbente foi melhorado.
+    bool submit(std::vector<int> solution, Incumbent& incumbent, HeuristicStats* source = nullptr);
+
+    /// @brief Aplica a busca local a uma solução que acabou de se tornar incumbente.
+    /// @return true se a busca local melhorou o incumbente.
+    bool polish(std::vector<int> solution, Incumbent& incumbent);
+
+    /// @brief Registra no log as estatísticas de cada heurística.
+    void logStats() const;
+
+    const std::vector<std::unique_ptr<PrimalHeuristic>>& heuristics() const noexcept { return heuristics_; }
+    const LocalSearch& localSearch() const noexcept { return local_search_; }
+
+private:
+    const ProblemModel& model_;
+    bool use_local_search_;
+    std::vector<std::unique_ptr<PrimalHeuristic>> heuristics_;
+    LocalSearch local_search_;
+};
+
+#endif // HEURISTICS_H
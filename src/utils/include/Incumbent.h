@@ -0,0 +1,49 @@
+#ifndef INCUMBENT_H
+#define INCUMBENT_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/// @brief Melhor solução inteira conhecida durante a busca, compartilhável entre threads.
+/// @details O valor objetivo é atômico para que a poda por limite leia o incumbente sem travas;
+/// a solução completa só é copiada, sob mutex, quando há melhora.
+class Incumbent {
+public:
+    using Listener = std::function<void(double objective, const std::vector<int>& solution)>;
+
+    Incumbent();
+
+    Incumbent(const Incumbent&) = delete;
+    Incumbent& operator=(const Incumbent&) = delete;
+
+    /// @brief Valor objetivo do incumbente (-infinito se ainda não houver).
+    double value() const noexcept { return objective_.load(std::memory_order_acquire); }
+
+    /// @brief Substitui o incumbente se objective for estritamente melhor.
+    /// @return true se o incumbente foi atualizado.
+    bool tryUpdate(double objective, const std::vector<int>& solution);
+
+    /// @brief Indica se alguma solução já foi registrada.
+    bool hasSolution() const;
+
+    /// @brief Cópia da melhor solução registrada.
+    std::vector<int> solution() const;
+
+    /// @brief Descarta o incumbente.
+    void reset();
+
+    /// @brief Define a função chamada a cada melhora.
+    /// @details A chamada ocorre dentro de tryUpdate, sob a trava do incumbente: as notificações são
+    /// serializadas e chegam em ordem estritamente crescente de valor, mesmo na busca paralela.
+    void setListener(Listener listener);
+
+private:
+    std::atomic<double> objective_;
+    mutable std::mutex mutex_;
+    std::vector<int> solution_;
+    Listener listener_;
+};
+
+#endif // INCUMBENT_H
@@ -0,0 +1,55 @@
+#ifndef INSTANCE_GENERATOR_H
+#define INSTANCE_GENERATOR_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <glpk.h>
+
+/// @brief Correlação entre lucros e pesos das instâncias de mochila geradas.
+enum class KnapsackCorrelation {
+    UNCORRELATED, // Lucros e pesos independentes em [1, R]
+    WEAKLY,       // Lucro = peso médio do item + ruído em [-R/10, R/10] (mínimo 1)
+    STRONGLY      // Lucro = peso médio do item + R/10 (as mais difíceis para o Branch and Bound)
+};
+
+/// @brief Parâmetros de uma instância de mochila multidimensional.
+struct KnapsackParams {
+    int num_items = 30;          // n: variáveis binárias
+    int num_constraints = 5;     // m: restrições de capacidade
+    double tightness = 0.5;      // Capacidade de cada restrição como fração da soma dos seus pesos
+    KnapsackCorrelation correlation = KnapsackCorrelation::UNCORRELATED;
+    int max_weight = 1000;       // R: pesos sorteados em [1, R]
+    std::uint64_t seed = 1;
+};
+
+/// @brief Instância de mochila multidimensional: max p·x sujeito a W x <= c, x binário.
+struct KnapsackInstance {
+    int num_items = 0;
+    int num_constraints = 0;
+    std::vector<double> profits;    // n lucros
+    std::vector<double> weights;    // m x n pesos, por linha
+    std::vector<double> capacities; // m capacidades
+
+    /// @brief Cria o problema GLPK (maximização, variáveis binárias).
+    glp_prob* toGlpk() const;
+
+    /// @brief Escreve a instância no formato de texto denso lido por ProblemReader.
+    void writeDenseText(std::ostream& out) const;
+};
+
+/// @brief Gerador determinístico de instâncias de mochila multidimensional para testes e benchmarks.
+/// @details A mesma semente produz a mesma instância em qualquer plataforma: os sorteios usam
+/// std::mt19937_64 com redução própria para o intervalo, em vez das distribuições da biblioteca
+/// padrão, cuja implementação varia entre compiladores.
+class InstanceGenerator {
+public:
+    /// @throws std::invalid_argument se dimensões, folga ou peso máximo forem inválidos.
+    static KnapsackInstance multiKnapsack(const KnapsackParams& params);
+
+    /// @brief Nome curto da correlação ("uncorrelated", "weakly" ou "strongly").
+    static const char* correlationName(KnapsackCorrelation correlation);
+};
+
+#endif // INSTANCE_GENERATOR_H
@@ -0,0 +1,116 @@
+#ifndef KNAPSACK_ENGINES_H
+#define KNAPSACK_ENGINES_H
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "Incumbent.h"
+#include "ProblemModel.h"
+
+/// @brief Algoritmo exato usado por BranchAndBound::solve().
+enum class SolverEngine {
+    AUTO,                 // Escolhido pela estrutura do problema reduzido (ver BranchAndBoundOptions::engine)
+    LP_BRANCH_AND_BOUND,  // Branch and bound com relaxação linear (GLPK) em cada nó
+    COMBINATORIAL,        // Mochila de uma restrição: branch and bound com o limite de Dantzig, sem LP
+    DYNAMIC_PROGRAMMING   // Mochila com pesos e capacidades inteiros pequenos
+};
+
+/// @brief Nome legível do algoritmo, para logs.
+const char* engineName(SolverEngine engine);
+
+/// @brief Problema na forma de mochila 0-1 (multidimensional): maximizar p'x com W x <= c, W >= 0.
+/// @details Extraída do modelo quando toda linha tem coeficientes não negativos, limite superior finito
+/// e limite inferior não restritivo (<= 0). Os lucros são os coeficientes do objetivo, sem a constante.
+/// A forma é decidida numa passada sobre as linhas do modelo, sem alocar memória; os pesos densos só
+/// são copiados se couberem em ProblemModel::DENSE_MAX_ENTRIES posições. Caso contrário os pesos são
+/// lidos das linhas esparsas do modelo (rows).
+struct KnapsackForm {
+    int num_items = 0;
+    std::vector<double> profits;
+    std::vector<int> rows;                    // Linha do modelo de cada restrição da forma
+    std::vector<double> capacities;
+    std::vector<std::vector<double>> weights; // Por restrição, densos (vazio sem hasDenseWeights())
+    bool integral_weights = false;            // Todos os pesos são inteiros
+
+    /// @brief Extrai a forma de mochila do modelo (que deve ser de maximização).
+    /// @return false se alguma linha não tiver a forma W x <= c com W >= 0.
+    static bool extract(const ProblemModel& model, KnapsackForm& form);
+
+    bool hasDenseWeights() const noexcept { return weights.size() == capacities.size(); }
+
+    /// @brief Indica se há pesos densos, pesos e capacidades são inteiros e o número de estados da
+    /// programação dinâmica, prod(c_i + 1), fica dentro de max_states, com n * estados <= max_cells
+    /// decisões guardadas.
+    bool fitsDynamicProgramming(std::size_t max_states, std::size_t max_cells) const;
+};
+
+/// @brief Parada e poda compartilhadas com a busca em árvore.
+struct EngineControl {
+    std::function<bool()> should_stop;         // Consultada periodicamente (limites de tempo e de nós)
+    std::function<double(double)> cutoff;      // Incumbente -> maior limite podado (tolerância de gap)
+    std::function<void(long long)> count_nodes; // Nós explorados desde a última chamada
+};
+
+/// @brief Branch and bound combinatório para a mochila de uma restrição.
+/// @details Itens em ordem decrescente de lucro/peso; a busca em profundidade tenta primeiro incluir cada
+/// item, e cada nó é limitado pela relaxação de Dantzig (itens em ordem até encher a capacidade, mais a
+/// fração do primeiro que não cabe), calculada em O(log n) com somas de prefixo e busca binária. Com
+/// lucros inteiros o limite é arredondado para baixo. Itens de lucro <= 0 ficam fora, itens sem peso
+/// entram e itens mais pesados que a capacidade ficam fora antes da busca.
+class CombinatorialKnapsack {
+public:
+    /// @param model Modelo reduzido; deve sobreviver ao objeto.
+    /// @param form Forma de mochila do modelo, com exatamente uma linha.
+    CombinatorialKnapsack(const ProblemModel& model, const KnapsackForm& form);
+
+    /// @brief Busca a solução ótima, registrando no incumbente cada melhora (valores do modelo).
+    /// @return true se a busca terminou; false se parou por should_stop.
+    bool solve(Incumbent& incumbent, const EngineControl& control);
+
+    /// @brief Limite de Dantzig da raiz (valor do modelo): vale para o que ficou sem explorar.
+    double rootBound() const noexcept { return root_bound_; }
+
+    /// @brief Maior limite entre os nós podados só pela tolerância de gap (-infinito se nenhum).
+    double closedBound() const noexcept { return closed_bound_; }
+
+private:
+    // Limite de Dantzig dos itens [first, n) com a capacidade restante
+    double dantzigBound(int first, double capacity) const;
+
+    const ProblemModel& model_;
+    std::vector<int> order_;           // Coluna de cada item, em ordem decrescente de lucro/peso
+    std::vector<double> profit_;
+    std::vector<double> weight_;
+    std::vector<double> profit_prefix_; // Soma dos lucros dos itens [0, k)
+    std::vector<double> weight_prefix_;
+    std::vector<int> base_solution_;   // Colunas decididas antes da busca (itens sem peso)
+    double capacity_ = 0.0;
+    double base_value_ = 0.0;          // Objetivo de base_solution_ (com a constante)
+    bool integral_profits_ = false;
+    double root_bound_ = 0.0;
+    double closed_bound_ = -std::numeric_limits<double>::infinity();
+};
+
+/// @brief Programação dinâmica sobre as capacidades usadas, para mochilas com pesos inteiros pequenos.
+/// @details value[u] é o maior lucro com consumo de no máximo u (vetor de capacidades codificado em base
+/// mista); cada item é processado com u em ordem decrescente, como na mochila 0-1 clássica. As decisões
+/// ficam em um bit por (item, estado) para reconstruir a solução.
+class DynamicProgrammingKnapsack {
+public:
+    static constexpr std::size_t MAX_STATES = std::size_t{1} << 20;
+    static constexpr std::size_t MAX_CELLS = std::size_t{1} << 27; // Bits de decisão (16 MiB)
+
+    /// @param form Forma de mochila com fitsDynamicProgramming(MAX_STATES, MAX_CELLS).
+    DynamicProgrammingKnapsack(const ProblemModel& model, const KnapsackForm& form);
+
+    /// @brief Calcula a solução ótima e a registra no incumbente.
+    /// @return true se terminou; false se parou por should_stop (nenhuma solução é registrada).
+    bool solve(Incumbent& incumbent, const EngineControl& control);
+
+private:
+    const ProblemModel& model_;
+    const KnapsackForm& form_;
+};
+
+#endif // KNAPSACK_ENGINES_H
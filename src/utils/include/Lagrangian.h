@@ -0,0 +1,90 @@
+#ifndef LAGRANGIAN_H
+#define LAGRANGIAN_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "KnapsackEngines.h"
+#include "ProblemModel.h"
+
+/// @brief Parâmetros da poda por relaxação lagrangiana (ver LagrangianBound).
+struct LagrangianParams {
+    bool enabled = false;     // Limite lagrangiano em cada nó antes do LP
+    int root_iterations = 200; // Iterações do subgradiente na raiz
+    int node_iterations = 10;  // Iterações extras num nó cujo limite com os multiplicadores da raiz não podou (0: nenhuma)
+};
+
+/// @brief Memória de trabalho de uma thread para LagrangianBound::bound() (reaproveitada entre nós).
+struct LagrangianWorkspace {
+    std::vector<signed char> state;  // Por coluna: -1 livre, 0 ou 1 fixada
+    std::vector<double> multipliers;
+    std::vector<double> best_multipliers;
+    std::vector<double> reduced;     // Lucros menos a penalidade das linhas relaxadas
+    std::vector<int> order;          // Colunas com peso na linha mantida, por lucro reduzido / peso
+    std::vector<double> used;        // Consumo das linhas relaxadas pela solução da relaxação
+};
+
+/// @brief Limite lagrangiano para mochilas multidimensionais (todas as linhas W x <= c com W >= 0).
+/// @details Uma linha (a mais apertada, c_k / soma dos pesos) é mantida e as demais entram no objetivo
+/// com multiplicadores u >= 0: L(u) = u'c + max { (p - u'W) x : w_k x <= c_k, 0 <= x <= 1, fixações },
+/// resolvido por um único passe guloso sobre os itens em ordem de lucro reduzido / peso (relaxação de
+/// Dantzig). L(u) limita o LP do nó, e os multiplicadores da raiz vêm de otimização por subgradiente
+/// (passo de Polyak). Nos nós, a ordem da raiz é reaproveitada e o limite custa O(n); só quando ele não
+/// poda, e há incumbente, algumas iterações de subgradiente partem dos multiplicadores da raiz antes de
+/// desistir para o LP. O limite é um pouco mais fraco que o do LP com cortes, mas muito mais barato.
+/// bound() pode ser chamado por várias threads, cada uma com o seu LagrangianWorkspace.
+class LagrangianBound {
+public:
+    /// @brief Cria o limite para o modelo (de maximização) e otimiza os multiplicadores da raiz.
+    /// @return Nulo se o modelo não tiver a forma de mochila, não tiver linhas ou tiver pesos demais para
+    /// a cópia densa (ver KnapsackForm).
+    static std::unique_ptr<LagrangianBound> create(const ProblemModel& model, const LagrangianParams& params);
+
+    /// @brief Limite superior do objetivo (valor do modelo) com as fixações; -infinito se a linha mantida
+    /// não comporta os itens fixados em 1.
+    /// @param cutoff Maior valor que poda o nó: só acima dele os multiplicadores são reotimizados.
+    double bound(const std::vector<std::pair<int, int>>& fixings, double cutoff, LagrangianWorkspace& workspace) const;
+
+    /// @brief Limite na raiz com os multiplicadores otimizados.
+    double rootBound() const noexcept { return root_bound_; }
+
+    /// @brief Linha mantida (índice na forma de mochila).
+    int keptRow() const noexcept { return kept_row_; }
+
+    const std::vector<double>& multipliers() const noexcept { return multipliers_; }
+
+private:
+    LagrangianBound(const ProblemModel& model, KnapsackForm form, const LagrangianParams& params);
+
+    // Prepara o workspace para o modelo (na primeira chamada da thread)
+    void prepare(LagrangianWorkspace& workspace) const;
+
+    // Lucros reduzidos e ordem gulosa para os multiplicadores; retorna u'c mais a constante do objetivo
+    double price(const std::vector<double>& multipliers, std::vector<double>& reduced, std::vector<int>& order) const;
+
+    // Passe guloso com as fixações de workspace.state; com used, acumula o consumo das linhas relaxadas
+    double greedy(double base, const std::vector<double>& reduced, const std::vector<int>& order,
+                  const std::vector<std::pair<int, int>>& fixings, const std::vector<signed char>& state,
+                  std::vector<double>* used) const;
+
+    // Subgradiente a partir de multipliers (atualizados para os melhores); retorna o menor limite
+    double optimize(const std::vector<std::pair<int, int>>& fixings, double target, int iterations,
+                    std::vector<double>& multipliers, LagrangianWorkspace& workspace) const;
+
+    // Arredonda para baixo quando o objetivo só assume valores inteiros mais a constante
+    double roundBound(double bound) const;
+
+    const ProblemModel& model_;
+    KnapsackForm form_;
+    LagrangianParams params_;
+    int kept_row_ = 0;
+    std::vector<int> weightless_;       // Colunas sem peso na linha mantida
+    bool integral_objective_ = false;
+    std::vector<double> multipliers_;   // Por linha da forma (zero na mantida)
+    std::vector<double> root_reduced_;
+    std::vector<int> root_order_;
+    double root_base_ = 0.0;
+    double root_bound_ = 0.0;
+};
+
+#endif // LAGRANGIAN_H
@@ -0,0 +1,116 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+/// @brief Níveis de log, do mais detalhado ao mais grave.
+enum class LogLevel : int {
+    TRACE = 0,   // Eventos por nó/variável (caminho quente)
+    DEBUG = 1,   // Decisões por nó (podas, incumbentes) e saída do GLPK
+    INFO = 2,    // Eventos do solver como um todo
+    WARNING = 3,
+    ERROR = 4,
+    OFF = 5
+};
+
+/// @brief Nível mínimo compilado. Chamadas abaixo dele são eliminadas pelo compilador.
+/// @details Pode ser definido pelo CMake (-DBB_LOG_MIN_LEVEL=<0..5>). Por padrão, builds de release
+/// (NDEBUG) descartam TRACE e DEBUG, e builds de debug mantêm todos os níveis.
+#ifndef BB_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define BB_LOG_MIN_LEVEL 2
+#else
+#define BB_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+/// @brief Logger global com nível em tempo de execução e saída bufferizada.
+/// @details As linhas são acumuladas em um buffer e escritas no destino quando ele enche, quando
+/// chega uma mensagem de aviso ou erro, em flush() ou ao fim do programa. É seguro chamar de
+/// várias threads.
+class Logger {
+public:
+    static Logger& instance();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /// @brief Define o nível mínimo em tempo de execução (padrão: INFO).
+    void setLevel(LogLevel level) noexcept { level_.store(static_cast<int>(level), std::memory_order_relaxed); }
+    LogLevel level() const noexcept { return static_cast<LogLevel>(level_.load(std::memory_order_relaxed)); }
+
+    /// @brief Indica se uma mensagem do nível informado seria escrita.
+    bool enabled(LogLevel level) const noexcept {
+        return static_cast<int>(level) >= BB_LOG_MIN_LEVEL &&
+               static_cast<int>(level) >= level_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Troca o destino das mensagens (padrão: std::clog). O stream deve sobreviver ao logger.
+    void setSink(std::ostream& sink);
+
+    /// @brief Tamanho do buffer, em bytes, a partir do qual as mensagens são descarregadas.
+    void setBufferCapacity(std::size_t bytes);
+
+    /// @brief Formata e enfileira uma linha "[tag][NÍVEL] mensagem".
+    void write(LogLevel level, const char* tag, const std::string& message);
+
+    /// @brief Escreve imediatamente tudo o que está no buffer.
+    void flush();
+
+    /// @brief Redireciona a saída de terminal do GLPK da thread atual para o logger (nível DEBUG).
+    /// @details O hook do GLPK é por ambiente, e o ambiente é por thread; a chamada é idempotente e
+    /// barata, então pode ser feita antes de cada uso do GLPK.
+    static void captureGlpkOutput();
+
+    /// @brief Converte "trace", "debug", "info", "warning", "error" ou "off" em nível.
+    /// @throws std::invalid_argument para nomes desconhecidos.
+    static LogLevel parseLevel(const std::string& name);
+
+private:
+    Logger();
+    ~Logger();
+
+    std::atomic<int> level_;
+    std::mutex mutex_;
+    std::ostream* sink_;
+    std::string buffer_;
+    std::size_t capacity_;
+};
+
+/// @brief Linha de log em construção; é enviada ao logger quando destruída.
+class LogLine {
+public:
+    LogLine(LogLevel level, const char* tag) : level_(level), tag_(tag) {}
+    ~LogLine() { Logger::instance().write(level_, tag_, stream_.str()); }
+
+    LogLine(const LogLine&) = delete;
+    LogLine& operator=(const LogLine&) = delete;
+
+    std::ostream& stream() { return stream_; }
+
+private:
+    LogLevel level_;
+    const char* tag_;
+    std::ostringstream stream_;
+};
+
+// Os argumentos de "<<" só são avaliados se o nível estiver habilitado; abaixo de BB_LOG_MIN_LEVEL
+// a condição é constante e a instrução inteira é removida.
+#define BB_LOG(level, tag)                                                   \
+    if (static_cast<int>(level) < BB_LOG_MIN_LEVEL ||                        \
+        !Logger::instance().enabled(level)) {                                \
+    } else                                                                   \
+        LogLine((level), (tag)).stream()
+
+#define BB_LOG_TRACE(tag) BB_LOG(LogLevel::TRACE, tag)
+#define BB_LOG_DEBUG(tag) BB_LOG(LogLevel::DEBUG, tag)
+#define BB_LOG_INFO(tag) BB_LOG(LogLevel::INFO, tag)
+#define BB_LOG_WARNING(tag) BB_LOG(LogLevel::WARNING, tag)
+#define BB_LOG_ERROR(tag) BB_LOG(LogLevel::ERROR, tag)
+
+#endif // LOGGER_H
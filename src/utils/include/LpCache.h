@@ -0,0 +1,101 @@
+#ifndef LP_CACHE_H
+#define LP_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "GLPKSolver.h"
+#include "ProblemModel.h"
+
+/// @brief Chave de um conjunto de fixações: hash de Zobrist e um segundo hash independente para
+/// confirmar a entrada. Ambos são XOR de valores por (coluna, valor), logo não dependem da ordem.
+struct LpCacheKey {
+    std::uint64_t hash = 0;
+    std::uint64_t check = 0;
+};
+
+/// @brief Resultado guardado da relaxação de um conjunto de fixações.
+struct CachedLp {
+    double bound = 0.0;        // Objetivo do LP (com os cortes da execução); -infinito se inviável
+    bool bound_valid = false;  // O limite vale para o modelo atual (ver LpCache::prepare)
+    std::shared_ptr<const LpBasis> basis; // Base ótima (nula se não coube no orçamento)
+};
+
+/// @brief Tabela de transposição de relaxações, mantida entre execuções sobre o mesmo modelo.
+/// @details Dentro de uma árvore os conjuntos de fixações nunca se repetem (dois nós sempre divergem na
+/// variável ramificada no ancestral comum); eles se repetem quando o mesmo modelo, ou uma variação
+/// dele, é resolvido de novo, como em BranchAndBound::resolve(). A tabela é endereçada diretamente
+/// pelo hash (uma entrada por posição, sempre substituída), com orçamento de memória para as posições
+/// e as bases. Um limite guardado só poda enquanto o modelo reduzido for o mesmo ou uma restrição
+/// dele; a base serve de partida para o simplex enquanto a estrutura (matriz e colunas) for a mesma.
+/// lookup e store podem ser chamados por várias threads ao mesmo tempo.
+class LpCache {
+public:
+    /// @param memory_limit Orçamento em bytes (um oitavo para as posições, o resto para as bases).
+    explicit LpCache(std::size_t memory_limit);
+
+    LpCache(const LpCache&) = delete;
+    LpCache& operator=(const LpCache&) = delete;
+
+    /// @brief Chave das fixações (índices base 0 do modelo reduzido).
+    static LpCacheKey keyOf(const std::vector<std::pair<int, int>>& fixings);
+
+    /// @brief Associa a tabela ao modelo de uma nova execução.
+    /// @details Com outra estrutura (linhas, colunas, coeficientes ou mapeamento para as colunas
+    /// originais) a tabela é esvaziada. Com a mesma estrutura os limites guardados continuam válidos
+    /// só se o objetivo for igual e nenhuma linha tiver perdido limite; as bases continuam.
+    /// @param original_columns Coluna original de cada coluna do modelo (presolve).
+    void prepare(const ProblemModel& model, const std::vector<int>& original_columns);
+
+    /// @brief Procura as fixações; atualiza os contadores de acertos e falhas.
+    bool lookup(const LpCacheKey& key, CachedLp& result) const;
+
+    /// @brief Guarda (ou substitui) o resultado das fixações.
+    /// @param bound Objetivo do LP, ou -infinito se inviável.
+    /// @param basis Base ótima (opcional); descartada se não couber no orçamento.
+    void store(const LpCacheKey& key, double bound, std::shared_ptr<const LpBasis> basis);
+
+    std::size_t memoryLimit() const noexcept { return memory_limit_; }
+    std::size_t size() const;
+    std::size_t memoryBytes() const;
+    long long hits() const;
+    long long misses() const;
+
+private:
+    struct Slot {
+        std::uint64_t hash = 0; // Zero: posição vazia
+        std::uint64_t check = 0;
+        double bound = 0.0;
+        std::uint32_t epoch = 0;
+        std::shared_ptr<const LpBasis> basis;
+    };
+
+    static constexpr std::size_t STRIPES = 64;
+
+    static std::size_t basisBytes(const LpBasis& basis);
+    void clear();
+
+    std::size_t memory_limit_;
+    std::vector<Slot> slots_;
+    mutable std::array<std::mutex, STRIPES> stripes_; // Trava da posição i: stripes_[i % STRIPES]
+
+    // Modelo da última execução: estrutura (hash), limites das linhas e objetivo
+    std::uint64_t structure_ = 0;
+    std::vector<double> row_lower_;
+    std::vector<double> row_upper_;
+    std::vector<double> objective_;
+    double objective_constant_ = 0.0;
+    std::uint32_t epoch_ = 1; // Limites de entradas de épocas anteriores não podam
+
+    std::atomic<std::size_t> used_slots_{0};
+    std::atomic<std::size_t> basis_bytes_{0};
+    mutable std::atomic<long long> hits_{0};
+    mutable std::atomic<long long> misses_{0};
+};
+
+#endif // LP_CACHE_H
@@ -0,0 +1,29 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/// @brief Arquivo mapeado em memória somente para leitura (mmap).
+/// @details O conteúdo fica acessível como string_view enquanto o objeto existir, sem cópia para
+/// buffers intermediários. Arquivos vazios resultam em uma visão vazia.
+class MappedFile {
+public:
+    /// @brief Mapeia o arquivo inteiro.
+    /// @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view view() const noexcept { return {data_, size_}; }
+    std::size_t size() const noexcept { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,51 @@
+#ifndef NODE_H
+#define NODE_H
+
+#include <vector>
+#include <utility>
+#include <memory>
+#include "FixingArena.h"
+#include "GLPKSolver.h"
+
+// Enum para representar o tipo de nó
+enum class NodeType {
+    ROOT,
+    LEFT_CHILD,  // x_j = 0
+    RIGHT_CHILD  // x_j = 1
+};
+
+// Estrutura para representar um nó na árvore de Branch and Bound
+struct Node {
+    std::unique_ptr<GLPKSolver> solver;
+    FixingChain fixings; // Fixações desde a raiz, compartilhadas com o pai e o irmão
+    std::shared_ptr<const LpBasis> warm_basis; // Base ótima do pai, compartilhada pelos dois filhos
+    double bound;    // Limite superior do nó (objetivo da relaxação do pai)
+    double estimate; // Estimativa do melhor inteiro na subárvore (best-estimate)
+    int depth;
+    NodeType type;
+
+    // Ramificação que gerou o nó, usada para aprender pseudo-custos (branch_var = -1 na raiz)
+    int branch_var;
+    int branch_value;
+    double branch_distance; // |valor fracionário no pai - valor fixado|
+
+    // Construtor principal
+    Node(
+        std::unique_ptr<GLPKSolver> solver,
+        FixingChain fixed,
+        double b,
+        NodeType t
+    );
+
+    // Construtor de movimento
+    Node(Node&& other) noexcept;
+
+    // Operações de cópia desabilitadas
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
+
+    // Operador de atribuição por movimento
+    Node& operator=(Node&& other) noexcept;
+};
+
+#endif // NODE_H
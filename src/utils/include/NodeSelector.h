@@ -0,0 +1,211 @@
+#ifndef NODE_SELECTOR_H
+#define NODE_SELECTOR_H
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Node.h"
+#include "NodeSpillFile.h"
+
+/// @brief Estratégias de seleção de nós disponíveis.
+enum class NodeSelection {
+    DEPTH_FIRST,   // Pilha: mergulha na árvore (x_j = 1 primeiro)
+    BREADTH_FIRST, // Fila: explora por níveis
+    BEST_BOUND,    // Heap pelo maior limite superior
+    BEST_ESTIMATE, // Heap pela maior estimativa do inteiro da subárvore
+    HYBRID         // Profundidade até o primeiro incumbente, depois best-bound com mergulhos
+};
+
+/// @brief Interface da estratégia de seleção de nós.
+/// @details Armazena os nós abertos e decide qual será processado a seguir. O Branch and Bound
+/// apenas insere os filhos criados e retira o próximo nó; a ordem fica a cargo da implementação.
+class NodeSelector {
+public:
+    virtual ~NodeSelector() = default;
+
+    /// @brief Insere um nó aberto.
+    virtual void push(Node&& node) = 0;
+
+    /// @brief Remove e retorna o próximo nó a ser processado.
+    /// @details O comportamento é indefinido se o seletor estiver vazio.
+    virtual Node pop() = 0;
+
+    virtual bool empty() const = 0;
+    virtual std::size_t size() const = 0;
+
+    /// @brief Maior limite entre os nós abertos (-infinito se vazio).
+    /// @details Percorre os nós nas estratégias que não os ordenam pelo limite; usado apenas em
+    /// relatórios de progresso e no fim da busca.
+    virtual double bestBound() const = 0;
+
+    /// @brief Remove e retorna todos os nós abertos, em ordem arbitrária.
+    /// @details Usado para reorganizar o conjunto aberto (por exemplo, ao transbordar para disco).
+    virtual std::vector<Node> releaseAll() = 0;
+
+    /// @brief Notifica a estratégia de que o incumbente foi atualizado.
+    virtual void onIncumbentUpdate(double /*objective*/) {}
+
+    /// @brief Nome da estratégia (para logs).
+    virtual const char* name() const = 0;
+};
+
+/// @brief Busca em profundidade (pilha).
+class DepthFirstSelector : public NodeSelector {
+public:
+    void push(Node&& node) override;
+    Node pop() override;
+    bool empty() const override { return stack_.empty(); }
+    std::size_t size() const override { return stack_.size(); }
+    double bestBound() const override;
+    std::vector<Node> releaseAll() override;
+    const char* name() const override { return "depth-first"; }
+
+private:
+    std::vector<Node> stack_;
+};
+
+/// @brief Busca em largura (fila).
+class BreadthFirstSelector : public NodeSelector {
+public:
+    void push(Node&& node) override;
+    Node pop() override;
+    bool empty() const override { return queue_.empty(); }
+    std::size_t size() const override { return queue_.size(); }
+    double bestBound() const override;
+    std::vector<Node> releaseAll() override;
+    const char* name() const override { return "breadth-first"; }
+
+private:
+    std::deque<Node> queue_;
+};
+
+/// @brief Seleção pelo maior limite superior (best-bound).
+/// @details Empates são desfeitos pelo nó mais profundo, que tende a chegar antes a soluções inteiras.
+class BestBoundSelector : public NodeSelector {
+public:
+    void push(Node&& node) override;
+    Node pop() override;
+    bool empty() const override { return heap_.empty(); }
+    std::size_t size() const override { return heap_.size(); }
+    double bestBound() const override;
+    std::vector<Node> releaseAll() override;
+    const char* name() const override { return "best-bound"; }
+
+private:
+    // std::priority_queue só expõe top() const, o que impede mover o nó para fora;
+    // por isso o heap é mantido manualmente com std::push_heap/std::pop_heap.
+    std::vector<Node> heap_;
+};
+
+/// @brief Seleção pela maior estimativa do valor inteiro da subárvore (best-estimate).
+class BestEstimateSelector : public NodeSelector {
+public:
+    void push(Node&& node) override;
+    Node pop() override;
+    bool empty() const override { return heap_.empty(); }
+    std::size_t size() const override { return heap_.size(); }
+    double bestBound() const override;
+    std::vector<Node> releaseAll() override;
+    const char* name() const override { return "best-estimate"; }
+
+private:
+    std::vector<Node> heap_;
+};
+
+/// @brief Estratégia híbrida.
+/// @details Enquanto não há incumbente, mergulha em profundidade. Depois do primeiro incumbente,
+/// passa a escolher o nó de melhor limite e mergulha a partir dele (plunging) por no máximo
+/// `max_plunge_depth` nós consecutivos antes de voltar ao heap.
+class HybridSelector : public NodeSelector {
+public:
+    explicit HybridSelector(int max_plunge_depth = 10);
+
+    void push(Node&& node) override;
+    Node pop() override;
+    bool empty() const override { return plunge_.empty() && heap_.empty(); }
+    std::size_t size() const override { return plunge_.size() + heap_.size(); }
+    double bestBound() const override;
+    std::vector<Node> releaseAll() override;
+    void onIncumbentUpdate(double objective) override;
+    const char* name() const override { return "hybrid"; }
+
+private:
+    void flushPlunge();
+
+    int max_plunge_depth_;
+    int plunge_count_;
+    bool has_incumbent_;
+    std::vector<Node> plunge_; // Pilha do mergulho atual (ou da busca em profundidade inicial)
+    std::vector<Node> heap_;   // Heap por limite
+};
+
+/// @brief Limita a memória ocupada pelos nós abertos de outra estratégia.
+/// @details Mantém uma estimativa dos bytes dos nós abertos (nodeBytes) e reage em três níveis,
+/// em frações do orçamento:
+/// - a partir de COMPACT_FRACTION, os nós inseridos são compactados: perdem a cópia do problema e a
+///   base do pai e ficam só com as fixações, sendo resolvidos no LP compartilhado da busca;
+/// - a partir de PLUNGE_FRACTION, os novos nós vão para uma pilha e a busca mergulha em profundidade,
+///   o que limita o crescimento do conjunto aberto, até a ocupação voltar a COMPACT_FRACTION;
+/// - acima do orçamento, os nós em memória são compactados e os de menor limite vão para um
+///   NodeSpillFile até a ocupação voltar a COMPACT_FRACTION. Quando a memória esvazia, os nós do
+///   arquivo voltam em lotes, os de maior limite primeiro; os dominados pelo incumbente são
+///   descartados sem leitura.
+class MemoryBoundedSelector : public NodeSelector {
+public:
+    static constexpr double COMPACT_FRACTION = 0.5;
+    static constexpr double PLUNGE_FRACTION = 0.75;
+    static constexpr double RELOAD_FRACTION = 0.25; // Ocupação alvo de cada lote lido do arquivo
+
+    /// @param inner Estratégia que ordena os nós em memória.
+    /// @param budget_bytes Orçamento para os nós abertos (> 0).
+    /// @param problem_bytes Tamanho estimado de uma cópia do problema (estimateProblemBytes).
+    /// @param spill_directory Diretório do arquivo de transbordo (vazio: temporário do sistema).
+    /// @throws std::invalid_argument se inner for nulo ou o orçamento for zero.
+    MemoryBoundedSelector(std::unique_ptr<NodeSelector> inner, std::size_t budget_bytes,
+                          std::size_t problem_bytes, std::string spill_directory = "");
+
+    void push(Node&& node) override;
+    Node pop() override;
+    bool empty() const override;
+    std::size_t size() const override;
+    double bestBound() const override;
+    std::vector<Node> releaseAll() override;
+    void onIncumbentUpdate(double objective) override;
+    const char* name() const override { return inner_->name(); }
+
+    /// @brief Bytes estimados de um nó: estrutura, fixações, cópia do problema e metade da base
+    /// (compartilhada pelos dois filhos).
+    std::size_t nodeBytes(const Node& node) const;
+
+    /// @brief Estimativa da memória de um glp_prob (elementos da matriz, linhas e colunas).
+    static std::size_t estimateProblemBytes(int rows, int cols, int nonzeros);
+
+    std::size_t bytesInUse() const noexcept { return bytes_; }
+    std::size_t peakBytes() const noexcept { return peak_bytes_; }
+    long long compactedNodes() const noexcept { return compacted_; }
+    long long spilledNodes() const noexcept { return spilled_; }
+
+private:
+    void compact(Node& node);
+    void spill();
+    void reload();
+    void endPlunge();
+
+    std::unique_ptr<NodeSelector> inner_;
+    std::size_t budget_;
+    std::size_t problem_bytes_;
+    NodeSpillFile spill_file_;
+    std::vector<Node> plunge_; // Pilha do mergulho sob pressão
+    bool plunging_ = false;
+    std::size_t bytes_ = 0;
+    std::size_t peak_bytes_ = 0;
+    long long compacted_ = 0;
+    long long spilled_ = 0;
+};
+
+/// @brief Cria a estratégia correspondente ao enum.
+std::unique_ptr<NodeSelector> makeNodeSelector(NodeSelection selection, int max_plunge_depth = 10);
+
+#endif // NODE_SELECTOR_H
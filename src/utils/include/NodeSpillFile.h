@@ -0,0 +1,66 @@
+#ifndef NODE_SPILL_FILE_H
+#define NODE_SPILL_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Node.h"
+
+/// @brief Arquivo temporário com nós abertos compactados, para buscas maiores que a memória.
+/// @details Cada nó é gravado só com suas fixações e dados de ramificação (sem problema LP nem base)
+/// ao fim do arquivo. Um índice em memória (limite, posição e tamanho do registro: 24 bytes por nó)
+/// é mantido como heap pelo limite, de modo que os nós mais promissores são lidos primeiro.
+/// O arquivo é criado na primeira gravação, já removido do diretório (o sistema libera o espaço ao
+/// fechá-lo), e volta ao tamanho zero sempre que todos os nós foram lidos. As fixações dos nós lidos
+/// são recriadas na arena dos nós gravados, que precisa sobreviver ao arquivo.
+class NodeSpillFile {
+public:
+    /// @param directory Diretório do arquivo (vazio: diretório temporário do sistema).
+    explicit NodeSpillFile(std::string directory = "");
+    ~NodeSpillFile();
+
+    NodeSpillFile(const NodeSpillFile&) = delete;
+    NodeSpillFile& operator=(const NodeSpillFile&) = delete;
+
+    /// @brief Grava um nó. O problema LP e a base do nó, se houver, não são gravados.
+    /// @throws std::runtime_error se o arquivo não puder ser criado ou escrito.
+    void write(const Node& node);
+
+    /// @brief Remove e lê o nó de maior limite. Indefinido se o arquivo estiver vazio.
+    /// @throws std::runtime_error em falha de leitura.
+    Node readBest();
+
+    /// @brief Descarta, sem ler, os nós com limite <= cutoff.
+    /// @return Número de nós descartados.
+    std::size_t discardDominated(double cutoff);
+
+    /// @brief Maior limite entre os nós gravados (-infinito se vazio).
+    double bestBound() const;
+
+    bool empty() const noexcept { return index_.empty(); }
+    std::size_t size() const noexcept { return index_.size(); }
+
+private:
+    struct Entry {
+        double bound;
+        std::uint64_t offset;
+        std::uint32_t size;
+    };
+
+    struct BoundLess {
+        bool operator()(const Entry& a, const Entry& b) const;
+    };
+
+    void open();
+
+    std::string directory_;
+    int fd_ = -1;
+    std::uint64_t end_ = 0;     // Fim dos dados gravados
+    std::vector<Entry> index_;  // Heap pelo limite
+    std::vector<char> buffer_;  // Registro em montagem/leitura
+    std::vector<std::pair<int, int>> fixings_; // Fixações do registro em montagem/leitura
+    FixingArena* arena_ = nullptr; // Arena das fixações gravadas
+};
+
+#endif // NODE_SPILL_FILE_H
@@ -0,0 +1,58 @@
+#ifndef PRESOLVE_H
+#define PRESOLVE_H
+
+#include <vector>
+#include "GLPKSolver.h"
+
+/// @brief Contadores das reduções aplicadas pelo presolve.
+struct PresolveStats {
+    int fixed_cols = 0;        // Variáveis fixadas (propagação e fixação dual)
+    int dominated_cols = 0;    // Variáveis fixadas em 0 por dominância
+    int removed_rows = 0;      // Linhas redundantes ou sem variáveis livres
+    int tightened_coefs = 0;   // Coeficientes reduzidos
+    int passes = 0;
+};
+
+/// @brief Mapeamento de uma solução do problema reduzido para o espaço original.
+class Postsolve {
+public:
+    /// @brief Reconstrói a solução original a partir da solução do problema reduzido.
+    std::vector<int> restore(const std::vector<int>& reduced_solution) const;
+
+    int originalCols() const noexcept { return static_cast<int>(fixed_value_.size()); }
+    int reducedCols() const noexcept { return static_cast<int>(original_index_.size()); }
+
+    /// @brief Coluna original (base 0) da coluna reduzida informada.
+    int originalIndex(int reduced_col) const { return original_index_[reduced_col]; }
+
+private:
+    friend class Presolver;
+
+    std::vector<int> original_index_; // Coluna reduzida -> coluna original
+    std::vector<int> fixed_value_;    // Valor das colunas removidas (-1 para as mantidas)
+};
+
+/// @brief Presolve para problemas binários com linhas lineares.
+/// @details Repete até o ponto fixo (ou o limite de passadas):
+/// - propagação das linhas: fixa variáveis que não cabem (a_j maior que a folga) e detecta inviabilidade;
+/// - remoção de linhas redundantes (atividade máxima dentro do limite) ou sem variáveis livres;
+/// - fixação dual: variável sem travas em uma direção vai para o lado que não piora o objetivo;
+/// - redução de coeficientes em linhas <=: se a linha fica redundante com x_j = 0, a_j e b diminuem;
+/// - colunas dominadas: se c_j >= c_k, a coluna de j é menor ou igual à de k e x_j + x_k <= 1 é
+///   implicado por alguma linha, existe ótimo com x_k = 0.
+/// O problema reduzido guarda a contribuição das variáveis fixadas na constante do objetivo, então o
+/// valor ótimo dele é igual ao do original.
+class Presolver {
+public:
+    /// @brief Reduz o problema (que não é modificado).
+    /// @param postsolve Recebe o mapeamento de volta para o espaço original.
+    /// @return Problema reduzido, ou nulo se o presolve provou que o problema é inviável.
+    GLPProbPtr run(glp_prob* problem, Postsolve& postsolve);
+
+    const PresolveStats& stats() const noexcept { return stats_; }
+
+private:
+    PresolveStats stats_;
+};
+
+#endif // PRESOLVE_H
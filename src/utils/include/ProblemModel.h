@@ -0,0 +1,131 @@
+#ifndef PROBLEM_MODEL_H
+#define PROBLEM_MODEL_H
+
+#include <cstddef>
+#include <vector>
+#include <glpk.h>
+#include "AlignedAllocator.h"
+
+/// @brief Cópia imutável, em memória, da formulação do problema (matriz por linhas e por colunas).
+/// @details Construída uma única vez a partir do glp_prob lido, evita consultas ao GLPK
+/// (glp_get_mat_row etc.) nos laços de propagação, heurísticas e verificação de viabilidade.
+/// Índices de linhas e colunas são base 0. Os coeficientes ficam em memória alinhada e, quando a
+/// matriz é densa e cabe no limite de memória, também em uma cópia densa por linhas (com as linhas
+/// completadas com zeros até um múltiplo de 8), lida pelos kernels vetoriais de SimdKernels.h.
+class ProblemModel {
+public:
+    /// @brief Maior número de posições de uma cópia densa da matriz (4M doubles, 32 MB).
+    static constexpr std::size_t DENSE_MAX_ENTRIES = std::size_t(1) << 22;
+
+    /// @brief Extrai a formulação de um problema GLPK (o problema não é modificado).
+    static ProblemModel fromGlpk(glp_prob* problem);
+
+    int numRows() const noexcept { return num_rows_; }
+    int numCols() const noexcept { return num_cols_; }
+    bool isMaximization() const noexcept { return maximize_; }
+
+    // Matriz por linhas (CSR): entradas [rowStart(i), rowStart(i + 1))
+    int rowStart(int row) const noexcept { return row_start_[row]; }
+    int rowEnd(int row) const noexcept { return row_start_[row + 1]; }
+    int rowCol(int k) const noexcept { return row_cols_[k]; }
+    double rowValue(int k) const noexcept { return row_values_[k]; }
+
+    // Matriz por colunas (CSC): entradas [colStart(j), colStart(j + 1))
+    int colStart(int col) const noexcept { return col_start_[col]; }
+    int colEnd(int col) const noexcept { return col_start_[col + 1]; }
+    int colRow(int k) const noexcept { return col_rows_[k]; }
+    double colValue(int k) const noexcept { return col_values_[k]; }
+
+    /// @brief Indica se a cópia densa por linhas foi construída.
+    bool hasDenseRows() const noexcept { return !dense_.empty(); }
+
+    /// @brief Distância, em elementos, entre o início de duas linhas densas consecutivas.
+    int denseStride() const noexcept { return dense_stride_; }
+
+    /// @brief Linha densa (numCols() coeficientes seguidos de zeros); requer hasDenseRows().
+    const double* denseRow(int row) const noexcept { return dense_.data() + static_cast<size_t>(row) * dense_stride_; }
+
+    /// @brief Atividade da linha para uma solução 0/1 (numCols() posições).
+    double rowActivity(int row, const int* solution) const noexcept;
+
+    /// @brief Atividade da linha para uma solução fracionária (numCols() posições).
+    double rowActivity(int row, const double* solution) const noexcept;
+
+    /// @brief Limites das linhas; ±infinito quando o lado não existe.
+    double rowLower(int row) const noexcept { return row_lower_[row]; }
+    double rowUpper(int row) const noexcept { return row_upper_[row]; }
+    const double* rowLowerData() const noexcept { return row_lower_.data(); }
+    const double* rowUpperData() const noexcept { return row_upper_.data(); }
+
+    double objective(int col) const noexcept { return objective_[col]; }
+    const std::vector<double>& objective() const noexcept { return objective_; }
+    double objectiveConstant() const noexcept { return objective_constant_; }
+
+    /// @brief Valor do objetivo (incluindo a constante) para uma solução 0/1.
+    double objectiveValue(const std::vector<int>& solution) const;
+
+    /// @brief Verifica se uma solução 0/1 satisfaz todas as linhas com a tolerância informada.
+    /// @details Não aloca memória; interrompe na primeira linha violada.
+    bool isFeasible(const std::vector<int>& solution, double tolerance = 1e-6) const;
+
+private:
+    int num_rows_ = 0;
+    int num_cols_ = 0;
+    bool maximize_ = true;
+    std::vector<int> row_start_;
+    AlignedVector<int> row_cols_;
+    AlignedVector<double> row_values_;
+    std::vector<int> col_start_;
+    AlignedVector<int> col_rows_;
+    AlignedVector<double> col_values_;
+    AlignedVector<double> row_lower_;
+    AlignedVector<double> row_upper_;
+    std::vector<double> objective_;
+    double objective_constant_ = 0.0;
+    int dense_stride_ = 0;
+    AlignedVector<double> dense_; // Matriz densa por linhas (vazia se não construída)
+};
+
+/// @brief Atividades das linhas para uma solução 0/1, mantidas incrementalmente.
+/// @details Trocar o valor de uma variável atualiza apenas as linhas da sua coluna; as consultas
+/// de folga e de viabilidade não alocam memória.
+class RowActivity {
+public:
+    /// @param model Modelo do problema; deve sobreviver ao objeto.
+    RowActivity(const ProblemModel& model, const std::vector<int>& solution, double tolerance = 1e-6);
+
+    /// @brief Recalcula todas as atividades para outra solução.
+    void assign(const std::vector<int>& solution);
+
+    double operator[](int row) const noexcept { return activity_[row]; }
+
+    /// @brief Folga até o limite superior da linha (infinito se não houver).
+    double slack(int row) const noexcept { return model_.rowUpper(row) - activity_[row]; }
+
+    /// @brief Passa a variável de 0 para 1.
+    void add(int col) noexcept;
+
+    /// @brief Passa a variável de 1 para 0.
+    void remove(int col) noexcept;
+
+    /// @brief Indica se passar a variável para 1 mantém todas as linhas dela dentro dos limites.
+    bool canAdd(int col) const noexcept;
+
+    /// @brief Indica se passar a variável para 0 mantém todas as linhas dela dentro dos limites.
+    bool canRemove(int col) const noexcept;
+
+    bool rowViolated(int row) const noexcept {
+        return activity_[row] > model_.rowUpper(row) + tolerance_ ||
+               activity_[row] < model_.rowLower(row) - tolerance_;
+    }
+
+    /// @brief Indica se todas as linhas estão dentro dos limites.
+    bool feasible() const noexcept;
+
+private:
+    const ProblemModel& model_;
+    double tolerance_;
+    AlignedVector<double> activity_;
+};
+
+#endif // PROBLEM_MODEL_H
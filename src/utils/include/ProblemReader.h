@@ -2,21 +2,45 @@
 #define PROBLEM_READER_H
 
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <glpk.h>
-#include <fstream>
-#include <sstream>
+
+/// @brief Formatos de arquivo de instância aceitos pelo leitor.
+enum class InstanceFormat {
+    AUTO,       // Detectado pela extensão (.mps, .lp, .bbin) ou pelo conteúdo
+    DENSE_TEXT, // "n m", objetivo com n coeficientes e m linhas densas "a_1 ... a_n b" (a·x <= b, maximização)
+    FREE_MPS,   // MPS livre (campos separados por espaços), com OBJSENSE, RANGES e marcadores de inteiros
+    CPLEX_LP,   // Formato LP do CPLEX (seções maximize/minimize, subject to, bounds, binary, general, end)
+    BINARY      // Formato binário .bbin (BinaryInstance.h), carregado sem interpretação de texto
+};
 
 /// @brief Classe responsável por ler o arquivo problema e criar uma instância do GLPK.
+/// @details O arquivo é mapeado em memória e os números são convertidos com std::from_chars; a matriz
+/// é montada esparsa (coeficientes nulos são descartados) e carregada de uma vez no GLPK. Todas as
+/// variáveis precisam ser binárias: colunas contínuas (fora de INTORG e sem BV/LI/UI no MPS, fora das
+/// seções Binary/General no LP) e colunas com limites fora de [0, 1] são rejeitadas.
 class ProblemReader {
 public:
     /// @brief Construtor padrão (vazio).
     ProblemReader() {}
 
     /// @brief Função principal que lê o arquivo e cria o problema GLPK.
-    /// @param filepath O caminho do arquivo a ser lido.
+    /// @param filepath O caminho do arquivo a ser lido (formato detectado automaticamente).
     /// @return Um ponteiro para o problema GLPK criado.
     glp_prob* read(const std::string &filepath);
+
+    /// @brief Lê o arquivo no formato informado.
+    glp_prob* read(const std::string &filepath, InstanceFormat format);
+
+    /// @brief Interpreta uma instância já em memória.
+    /// @param name Nome usado para detectar o formato pela extensão (pode ser vazio).
+    glp_prob* parse(std::string_view contents, InstanceFormat format, const std::string &name = "");
+
+    /// @brief Formato de uma instância: binário pelo identificador; os demais pela extensão do nome e,
+    /// sem extensão conhecida, pelo conteúdo.
+    /// @throws std::invalid_argument se o formato não for reconhecido.
+    static InstanceFormat detectFormat(const std::string &name, std::string_view contents);
 };
 
 #endif // PROBLEM_READER_H
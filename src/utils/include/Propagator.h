@@ -0,0 +1,73 @@
+#ifndef PROPAGATOR_H
+#define PROPAGATOR_H
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include "ProblemModel.h"
+
+/// @brief Memória de trabalho de uma thread para o Propagator (reaproveitada entre nós).
+struct PropagatorWorkspace {
+    std::vector<std::int8_t> value; // Por coluna: valor fixado ou livre
+    std::vector<double> min_activity;
+    std::vector<double> max_activity;
+    std::vector<int> queue;         // Linhas a examinar
+    std::vector<char> queued;
+    std::vector<char> fixed;        // Colunas já fixadas, em fixByReducedCost()
+};
+
+/// @brief Fixações implícitas de variáveis binárias em um nó.
+/// @details Reúne as duas reduções aplicadas a cada nó da árvore:
+/// - propagação de restrições: com as variáveis já fixadas, calcula a atividade mínima e máxima de cada
+///   linha e fixa as variáveis livres que não cabem na folga restante (ex.: em a·x <= b, x_j = 0 se
+///   a_j excede a folga). Uma linha cuja atividade mínima já viola o limite torna o nó inviável;
+/// - fixação por custo reduzido: depois da relaxação, uma variável não básica cujo custo reduzido
+///   indica que mudar de lado leva o limite abaixo do incumbente é fixada no valor atual.
+/// Todas as variáveis do modelo são tratadas como binárias. Os métodos são const e podem ser chamados
+/// por várias threads ao mesmo tempo.
+class Propagator {
+public:
+    /// @param model Modelo do problema; deve sobreviver ao propagador.
+    explicit Propagator(const ProblemModel& model);
+
+    /// @brief Propaga as fixações do nó sobre as linhas do modelo até o ponto fixo.
+    /// @param fixed_vars Fixações do nó (índice base 0, valor); as fixações implícitas são acrescentadas ao final.
+    /// @param infeasible_row Se não nulo, recebe a linha violada quando o nó é inviável.
+    /// @return false se o nó é inviável.
+    bool propagate(std::vector<std::pair<int, int>>& fixed_vars, int* infeasible_row = nullptr) const;
+
+    /// @brief Como propagate(fixed_vars, infeasible_row), sem alocar memória depois da primeira chamada
+    /// com o workspace.
+    bool propagate(std::vector<std::pair<int, int>>& fixed_vars, PropagatorWorkspace& workspace,
+                   int* infeasible_row = nullptr) const;
+
+    /// @brief Fixa as variáveis que não podem melhorar o incumbente segundo os custos reduzidos.
+    /// @param solution Solução da relaxação do nó.
+    /// @param reduced_costs Custos reduzidos da relaxação (convenção do GLPK para maximização).
+    /// @param lp_objective Objetivo da relaxação do nó.
+    /// @param incumbent Valor do incumbente.
+    /// @param fixed_vars Fixações do nó; as novas fixações são acrescentadas ao final.
+    /// @return Número de variáveis fixadas.
+    int fixByReducedCost(
+        const std::vector<double>& solution,
+        const std::vector<double>& reduced_costs,
+        double lp_objective,
+        double incumbent,
+        std::vector<std::pair<int, int>>& fixed_vars
+    ) const;
+
+    /// @brief Como a versão acima, sem alocar memória depois da primeira chamada com o workspace.
+    int fixByReducedCost(
+        const std::vector<double>& solution,
+        const std::vector<double>& reduced_costs,
+        double lp_objective,
+        double incumbent,
+        std::vector<std::pair<int, int>>& fixed_vars,
+        PropagatorWorkspace& workspace
+    ) const;
+
+private:
+    const ProblemModel& model_;
+};
+
+#endif // PROPAGATOR_H
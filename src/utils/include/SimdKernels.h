@@ -0,0 +1,28 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+/// @brief Kernels numéricos dos laços mais quentes (atividade de linhas e verificação de limites).
+/// @details Com __AVX2__ (opção BB_NATIVE_ARCH do CMake) usam intrínsecos de 256 bits; sem ela,
+/// uma versão portável com quatro acumuladores independentes, que o compilador consegue vetorizar
+/// parcialmente e que não depende de reassociação de ponto flutuante. Nenhum kernel aloca memória.
+namespace simd {
+
+/// @brief sum(a[k] * x[k]) para k em [0, n).
+double dot(const double* a, const double* x, int n) noexcept;
+
+/// @brief sum(a[k] * x[k]) com x inteiro (solução 0/1), para k em [0, n).
+double dot(const double* a, const int* x, int n) noexcept;
+
+/// @brief sum(values[k] * x[index[k]]) para k em [0, len).
+double sparseDot(const double* values, const int* index, int len, const double* x) noexcept;
+
+/// @brief sum(values[k] * x[index[k]]) com x inteiro, para k em [0, len).
+double sparseDot(const double* values, const int* index, int len, const int* x) noexcept;
+
+/// @brief Indica se algum activity[i] está fora de [lower[i] - tol, upper[i] + tol], i em [0, n).
+bool anyOutside(const double* activity, const double* lower, const double* upper, int n,
+                double tolerance) noexcept;
+
+} // namespace simd
+
+#endif // SIMD_KERNELS_H
@@ -0,0 +1,97 @@
+#ifndef SOLVE_STATS_H
+#define SOLVE_STATS_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "KnapsackEngines.h"
+
+/// @brief Estatísticas de uma execução de BranchAndBound::solve().
+/// @details Os contadores de nós e de tempo por fase são acumulados por thread, sem sincronização,
+/// e somados no fim da busca; na busca paralela os tempos por fase são, portanto, a soma das
+/// threads e podem superar o tempo de parede. Objetivo e limite estão no sentido original do problema.
+struct SolveStats {
+    SolverEngine engine = SolverEngine::LP_BRANCH_AND_BOUND; // Algoritmo usado (nunca AUTO)
+
+    // Árvore
+    long long nodes = 0;            // Nós processados
+    long long nodes_pruned = 0;     // Podados pelo limite (do pai, da relaxação, após cortes ou heurística)
+    long long nodes_infeasible = 0; // Podados por inviabilidade (propagação, simplex ou cortes)
+    long long nodes_integer = 0;    // Relaxação inteira (melhorando ou não o incumbente)
+    long long nodes_branched = 0;   // Ramificados
+    int max_depth = 0;              // Maior profundidade de um nó processado
+    long long peak_open_nodes = 0;  // Máximo de nós abertos ao mesmo tempo
+    long long lp_iterations = 0;    // Iterações do simplex em todas as threads
+    long long lp_limit_resolves = 0; // Relaxações de nós retomadas sem limite após o limite de SimplexParams
+    long long conflicts_learned = 0;     // Nogoods incluídos no pool de conflitos
+    long long nodes_conflict_pruned = 0; // Podados por um nogood (também contados como podados ou inviáveis)
+    long long lp_cache_hits = 0;         // Nós cujas fixações estavam na tabela de relaxações
+    long long lp_cache_misses = 0;
+    long long nodes_cache_pruned = 0;    // Podados pelo limite guardado, sem resolver o LP
+    long long nodes_lagrangian_pruned = 0; // Podados pelo limite lagrangiano, sem resolver o LP
+
+    // Memória dos nós abertos (apenas com BranchAndBoundOptions::node_memory_limit)
+    long long nodes_compacted = 0;   // Nós que perderam a cópia do problema e a base do pai
+    long long nodes_spilled = 0;     // Nós gravados no arquivo de transbordo
+    long long peak_open_bytes = 0;   // Pico estimado de memória dos nós abertos
+
+    // Limites ao fim da execução (infinito enquanto não houver incumbente)
+    double best_bound = std::numeric_limits<double>::infinity(); // Melhor limite dual
+    double gap = std::numeric_limits<double>::infinity();        // Gap relativo (relativeGap)
+
+    // Tempos, em segundos
+    double seconds = 0.0;             // Total de solve()
+    double presolve_seconds = 0.0;
+    double search_seconds = 0.0;      // Busca em árvore (parede)
+    double setup_seconds = 0.0;       // Aplicação das fixações, da base do pai e dos cortes do pool ao LP
+    double lp_seconds = 0.0;          // Simplex das relaxações dos nós
+    double propagation_seconds = 0.0; // Propagação e fixação por custo reduzido
+    double lagrangian_seconds = 0.0;  // Limite lagrangiano: multiplicadores da raiz e limites dos nós
+    double cut_seconds = 0.0;         // Separação de cortes e reotimizações
+    double heuristic_seconds = 0.0;   // Heurísticas primais
+    double branching_seconds = 0.0;   // Regra de ramificação (inclui strong branching)
+    double child_seconds = 0.0;       // Criação dos filhos (inclui as cópias do problema em COPY_PER_NODE)
+
+    /// @brief Acumula os contadores de uma thread de busca (somas, e máximos para profundidade e pico).
+    void accumulate(const SolveStats& other) {
+        nodes += other.nodes;
+        nodes_pruned += other.nodes_pruned;
+        nodes_infeasible += other.nodes_infeasible;
+        nodes_integer += other.nodes_integer;
+        nodes_branched += other.nodes_branched;
+        max_depth = std::max(max_depth, other.max_depth);
+        peak_open_nodes = std::max(peak_open_nodes, other.peak_open_nodes);
+        lp_iterations += other.lp_iterations;
+        lp_limit_resolves += other.lp_limit_resolves;
+        conflicts_learned += other.conflicts_learned;
+        nodes_conflict_pruned += other.nodes_conflict_pruned;
+        lp_cache_hits += other.lp_cache_hits;
+        lp_cache_misses += other.lp_cache_misses;
+        nodes_cache_pruned += other.nodes_cache_pruned;
+        nodes_lagrangian_pruned += other.nodes_lagrangian_pruned;
+        nodes_compacted += other.nodes_compacted;
+        nodes_spilled += other.nodes_spilled;
+        peak_open_bytes = std::max(peak_open_bytes, other.peak_open_bytes);
+        setup_seconds += other.setup_seconds;
+        lp_seconds += other.lp_seconds;
+        propagation_seconds += other.propagation_seconds;
+        lagrangian_seconds += other.lagrangian_seconds;
+        cut_seconds += other.cut_seconds;
+        heuristic_seconds += other.heuristic_seconds;
+        branching_seconds += other.branching_seconds;
+        child_seconds += other.child_seconds;
+    }
+};
+
+/// @brief Gap relativo |limite - incumbente| / max(|incumbente|, 1e-9); infinito sem incumbente.
+inline double relativeGap(double incumbent, double bound) {
+    if (!std::isfinite(incumbent)) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (!std::isfinite(bound)) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return std::abs(bound - incumbent) / std::max(std::abs(incumbent), 1e-9);
+}
+
+#endif // SOLVE_STATS_H
@@ -1,7 +1,15 @@
+#ifndef SOLVE_STATUS_H
+#define SOLVE_STATUS_H
+
 enum class SolveStatus {
     OK,
     INFEASIBLE,
     UNBOUNDED,
     ERROR,
-    FRACTIONAL
-};
\ No newline at end of file
+    FRACTIONAL,
+    LIMIT_REACHED, // Limite de tempo ou de nós atingido antes de encontrar uma solução viável
+    FEASIBLE,      // Limite atingido com incumbente: solução viável, sem prova de otimalidade
+    LP_LIMIT       // Simplex interrompido pelo limite de iterações ou de tempo de SimplexParams (relaxação sem ótimo)
+};
+
+#endif // SOLVE_STATUS_H
@@ -0,0 +1,51 @@
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "ProblemModel.h"
+
+/// @brief Memória de trabalho de uma thread para ColumnSymmetry::propagate() (reaproveitada entre nós).
+struct SymmetryWorkspace {
+    std::vector<std::int8_t> value; // Por coluna: valor fixado ou livre (todas livres entre chamadas)
+    std::vector<int> touched;       // Classes com alguma coluna fixada
+};
+
+/// @brief Simetria entre colunas idênticas e fixação orbital.
+/// @details Colunas com o mesmo coeficiente no objetivo e os mesmos coeficientes em todas as linhas
+/// são intercambiáveis: permutar seus valores em uma solução viável dá outra solução viável de mesmo
+/// objetivo. Em cada classe c_1 < c_2 < ... < c_k basta, portanto, procurar soluções ordenadas
+/// x_{c_1} >= x_{c_2} >= ... >= x_{c_k}, e a busca deixa de explorar as permutações equivalentes:
+/// fixar x_{c_i} = 1 fixa em 1 as colunas anteriores da classe, e x_{c_i} = 0 fixa em 0 as posteriores.
+/// As restrições de ordem não entram no LP (a relaxação continua válida) e os incumbentes vindos das
+/// heurísticas podem ser não ordenados. Todas as variáveis do modelo são tratadas como binárias.
+/// Os métodos são const e podem ser chamados por várias threads ao mesmo tempo.
+class ColumnSymmetry {
+public:
+    /// @brief Agrupa as colunas idênticas do modelo (comparação exata dos coeficientes).
+    static ColumnSymmetry detect(const ProblemModel& model);
+
+    /// @brief Aplica as restrições de ordem às fixações do nó.
+    /// @param fixed_vars Fixações do nó (índice base 0, valor); as implicadas são acrescentadas ao final.
+    /// @return false se as fixações violam a ordem de alguma classe (x_{c_i} = 0 e x_{c_j} = 1 com i < j).
+    bool propagate(std::vector<std::pair<int, int>>& fixed_vars) const;
+
+    /// @brief Como propagate(fixed_vars), sem alocar memória depois da primeira chamada com o workspace.
+    bool propagate(std::vector<std::pair<int, int>>& fixed_vars, SymmetryWorkspace& workspace) const;
+
+    /// @brief Classes com pelo menos duas colunas, cada uma em ordem crescente de índice.
+    const std::vector<std::vector<int>>& classes() const noexcept { return classes_; }
+
+    /// @brief Número de colunas que pertencem a alguma classe.
+    int symmetricColumns() const noexcept { return symmetric_columns_; }
+
+    bool empty() const noexcept { return classes_.empty(); }
+
+private:
+    std::vector<std::vector<int>> classes_;
+    std::vector<int> class_of_; // Classe de cada coluna (-1 se não houver)
+    int symmetric_columns_ = 0;
+};
+
+#endif // SYMMETRY_H
@@ -0,0 +1,55 @@
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <glpk.h>
+#include <utility>
+#include <vector>
+
+/// @brief Nó deixado aberto por uma execução interrompida, no espaço original do problema.
+struct OpenNode {
+    std::vector<std::pair<int, int>> fixings; // (coluna base 0, valor)
+    double bound;                             // Limite do nó no sentido original do objetivo
+};
+
+/// @brief Ponto de partida de uma nova resolução, colhido de uma execução anterior.
+/// @details A solução vira o incumbente inicial se continuar viável. Os nós abertos substituem a raiz
+/// e só são válidos para o mesmo modelo ou para uma restrição dele (ModelDelta::apply devolve true):
+/// as regiões fechadas pela execução anterior foram podadas por inviabilidade ou por não superarem
+/// a solução anterior, e continuam podadas enquanto essa solução for viável. Com a solução anterior
+/// inviável os nós abertos são ignorados e a busca recomeça da raiz.
+struct WarmStart {
+    std::vector<int> solution;        // Vazia: sem solução anterior
+    std::vector<OpenNode> open_nodes; // Fronteira da árvore (só com frontier_complete)
+    // open_nodes descreve toda a fronteira; vazia significa que a árvore anterior foi esgotada
+    bool frontier_complete = false;
+};
+
+/// @brief Alterações pequenas em um modelo já resolvido: objetivo, limites de linhas e coeficientes.
+/// @details Índices base 0. O objetivo usa o sentido do próprio problema.
+struct ModelDelta {
+    struct RowBounds {
+        int row;
+        double lower; // -infinito: sem limite inferior
+        double upper; // +infinito: sem limite superior
+    };
+    struct Coefficient {
+        int row;
+        int col;
+        double value; // Zero remove o elemento
+    };
+
+    std::vector<std::pair<int, double>> objective; // (coluna, novo coeficiente)
+    std::vector<RowBounds> row_bounds;
+    std::vector<Coefficient> coefficients;
+
+    bool empty() const noexcept { return objective.empty() && row_bounds.empty() && coefficients.empty(); }
+
+    /// @brief Aplica as alterações ao problema.
+    /// @return true se o modelo só ficou mais restrito: nenhuma linha perdeu limite, e nenhum
+    /// coeficiente (do objetivo ou das linhas) mudou de valor.
+    /// @throws std::invalid_argument para índices fora do problema ou lower > upper; nesse caso o
+    /// problema não é alterado.
+    bool apply(glp_prob* problem) const;
+};
+
+#endif // WARM_START_H
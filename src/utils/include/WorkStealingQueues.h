@@ -0,0 +1,100 @@
+#ifndef WORK_STEALING_QUEUES_H
+#define WORK_STEALING_QUEUES_H
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/// @brief Conjunto de deques por thread com roubo de trabalho.
+/// @details Cada thread insere e retira do fim do seu próprio deque (ordem de profundidade, boa
+/// localidade da trilha de limites) e, quando fica sem trabalho, rouba do início do deque de outra
+/// thread, onde estão os nós mais rasos, que tendem a gerar mais trabalho.
+///
+/// O término é detectado por um contador de tarefas pendentes: ele é incrementado antes de cada
+/// inserção e só é decrementado (taskDone) depois que a tarefa retirada terminou de inserir seus
+/// filhos. Assim, pending() == 0 implica que todos os deques estão vazios e nenhuma thread ainda
+/// pode produzir trabalho, mesmo que os deques se esvaziem simultaneamente.
+template <typename T>
+class WorkStealingQueues {
+public:
+    explicit WorkStealingQueues(int num_workers) {
+        lanes_.reserve(static_cast<std::size_t>(num_workers));
+        for (int i = 0; i < num_workers; ++i) {
+            lanes_.push_back(std::make_unique<Lane>());
+        }
+    }
+
+    WorkStealingQueues(const WorkStealingQueues&) = delete;
+    WorkStealingQueues& operator=(const WorkStealingQueues&) = delete;
+
+    /// @brief Insere uma tarefa no deque da thread worker.
+    void push(int worker, T&& item) {
+        pending_.fetch_add(1, std::memory_order_acq_rel);
+        Lane& lane = *lanes_[static_cast<std::size_t>(worker)];
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        lane.items.push_back(std::move(item));
+    }
+
+    /// @brief Retira uma tarefa: primeiro do próprio deque, senão rouba de outra thread.
+    /// @return std::nullopt se nenhum deque tinha trabalho no momento.
+    std::optional<T> pop(int worker) {
+        const std::size_t count = lanes_.size();
+        const std::size_t self = static_cast<std::size_t>(worker);
+        {
+            Lane& lane = *lanes_[self];
+            std::lock_guard<std::mutex> lock(lane.mutex);
+            if (!lane.items.empty()) {
+                std::optional<T> item(std::move(lane.items.back()));
+                lane.items.pop_back();
+                return item;
+            }
+        }
+        for (std::size_t k = 1; k < count; ++k) {
+            Lane& victim = *lanes_[(self + k) % count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.items.empty()) {
+                std::optional<T> item(std::move(victim.items.front()));
+                victim.items.pop_front();
+                return item;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Marca como concluída uma tarefa retirada por pop().
+    void taskDone() {
+        pending_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /// @brief Visita as tarefas à espera em todos os deques (cada deque travado durante a visita).
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (const std::unique_ptr<Lane>& lane : lanes_) {
+            std::lock_guard<std::mutex> lock(lane->mutex);
+            for (const T& item : lane->items) {
+                visit(item);
+            }
+        }
+    }
+
+    /// @brief Tarefas inseridas e ainda não concluídas.
+    long long pending() const {
+        return pending_.load(std::memory_order_acquire);
+    }
+
+private:
+    // Cada deque fica em sua própria linha de cache para evitar falso compartilhamento das travas
+    struct alignas(64) Lane {
+        mutable std::mutex mutex;
+        std::deque<T> items;
+    };
+
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    std::atomic<long long> pending_{0};
+};
+
+#endif // WORK_STEALING_QUEUES_H
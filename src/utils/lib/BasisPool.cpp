@@ -0,0 +1,81 @@
+#include "BasisPool.h"
+#include <algorithm>
+#include <new>
+
+namespace {
+    // Capacidade para count elementos, dobrando a atual (crescimento do pool em tempo amortizado constante)
+    template <class T>
+    void reserveFor(std::vector<T>& items, std::size_t count) {
+        if (items.capacity() < count) {
+            items.reserve(std::max(count, 2 * items.capacity()));
+        }
+    }
+}
+
+BasisPool::~BasisPool() {
+    for (void* block : blocks_) {
+        ::operator delete(block);
+    }
+}
+
+std::shared_ptr<const LpBasis> BasisPool::save(const GLPKSolver& solver) {
+    LpBasis* basis;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_bases_.empty()) {
+            bases_.push_back(std::make_unique<LpBasis>());
+            reserveFor(free_bases_, bases_.size()); // O Recycler devolve sem realocar
+            free_bases_.push_back(bases_.back().get());
+        }
+        basis = free_bases_.back();
+        free_bases_.pop_back();
+    }
+    // Se a alocação do bloco de controle falhar, o construtor do shared_ptr devolve a base pelo Recycler
+    std::shared_ptr<const LpBasis> saved(basis, Recycler{this}, BlockAllocator<LpBasis>(this));
+    solver.saveBasis(*basis);
+    return saved;
+}
+
+void BasisPool::Recycler::operator()(LpBasis* basis) const noexcept {
+    std::lock_guard<std::mutex> lock(pool->mutex_);
+    pool->free_bases_.push_back(basis); // Capacidade reservada em save(): não realoca
+}
+
+void* BasisPool::allocateBlock(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (block_size_ == 0) {
+        block_size_ = bytes;
+    }
+    if (bytes != block_size_) {
+        return ::operator new(bytes);
+    }
+    if (free_blocks_.empty()) {
+        reserveFor(blocks_, blocks_.size() + 1);
+        reserveFor(free_blocks_, blocks_.size() + 1);
+        void* block = ::operator new(block_size_);
+        blocks_.push_back(block);
+        return block;
+    }
+    void* block = free_blocks_.back();
+    free_blocks_.pop_back();
+    return block;
+}
+
+void BasisPool::releaseBlock(void* block, std::size_t bytes) noexcept {
+    if (bytes != block_size_) {
+        ::operator delete(block);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_blocks_.push_back(block); // Capacidade reservada em allocateBlock: não realoca
+}
+
+std::size_t BasisPool::liveBases() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bases_.size() - free_bases_.size();
+}
+
+std::size_t BasisPool::capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bases_.size();
+}
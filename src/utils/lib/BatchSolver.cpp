@@ -0,0 +1,245 @@
+#include "BatchSolver.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include "BranchAndBound.h"
+#include "Logger.h"
+#include "ProblemReader.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+    // Dígitos suficientes para distinguir objetivos próximos sem poluir valores inteiros
+    constexpr int OUTPUT_PRECISION = 15;
+
+    std::string jsonEscape(const std::string& text) {
+        std::ostringstream out;
+        for (const unsigned char c : text) {
+            switch (c) {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\r': out << "\\r"; break;
+                case '\t': out << "\\t"; break;
+                default:
+                    if (c < 0x20) {
+                        out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                            << std::dec << std::setfill(' ');
+                    } else {
+                        out << c;
+                    }
+            }
+        }
+        return out.str();
+    }
+
+    std::string csvQuote(const std::string& text) {
+        if (text.find_first_of(",\"\n\r") == std::string::npos) {
+            return text;
+        }
+        std::string quoted = "\"";
+        for (const char c : text) {
+            quoted += c;
+            if (c == '"') {
+                quoted += '"';
+            }
+        }
+        return quoted + "\"";
+    }
+
+    std::string joinSolution(const std::vector<int>& solution, char separator) {
+        std::string joined;
+        for (size_t j = 0; j < solution.size(); ++j) {
+            if (j > 0) {
+                joined += separator;
+            }
+            joined += std::to_string(solution[j]);
+        }
+        return joined;
+    }
+
+    void addDirectory(const fs::path& directory, std::vector<std::string>& files) {
+        std::vector<std::string> entries;
+        for (const fs::directory_entry& entry : fs::directory_iterator(directory)) {
+            if (entry.is_regular_file()) {
+                entries.push_back(entry.path().string());
+            }
+        }
+        std::sort(entries.begin(), entries.end());
+        files.insert(files.end(), entries.begin(), entries.end());
+    }
+
+    void addManifest(const fs::path& manifest, std::vector<std::string>& files) {
+        std::ifstream in(manifest);
+        if (!in) {
+            throw std::invalid_argument("Manifesto não encontrado: " + manifest.string());
+        }
+        std::string line;
+        while (std::getline(in, line)) {
+            const size_t begin = line.find_first_not_of(" \t\r");
+            if (begin == std::string::npos || line[begin] == '#') {
+                continue;
+            }
+            const size_t end = line.find_last_not_of(" \t\r");
+            fs::path path = line.substr(begin, end - begin + 1);
+            if (path.is_relative()) {
+                path = manifest.parent_path() / path;
+            }
+            files.push_back(path.string());
+        }
+    }
+}
+
+BatchSolver::BatchSolver(BranchAndBoundOptions options, int jobs)
+    : options_(std::move(options)),
+      jobs_(jobs > 0 ? jobs : std::max(1, static_cast<int>(std::thread::hardware_concurrency()))) {}
+
+BatchResult BatchSolver::solveOne(const std::string& instance) const {
+    BatchResult result;
+    result.instance = instance;
+    try {
+        ProblemReader reader;
+        GLPProbPtr problem(reader.read(instance), GLPKProbDeleter());
+
+        BranchAndBound bb(options_);
+        result.status = bb.solve(std::move(problem), result.solution, result.objective);
+        result.stats = bb.stats();
+        result.has_solution = !result.solution.empty();
+    } catch (const std::exception& e) {
+        result.status = SolveStatus::ERROR;
+        result.error = e.what();
+        BB_LOG_WARNING("BatchSolver") << "Falha ao resolver " << instance << ": " << e.what();
+    }
+    return result;
+}
+
+std::vector<BatchResult> BatchSolver::run(const std::vector<std::string>& instances, const ResultCallback& on_result) const {
+    std::vector<BatchResult> results(instances.size());
+    std::atomic<size_t> next{0};
+    std::mutex callback_mutex;
+
+    auto worker = [&]() {
+        for (size_t k = next.fetch_add(1); k < instances.size(); k = next.fetch_add(1)) {
+            results[k] = solveOne(instances[k]);
+            if (on_result) {
+                std::lock_guard<std::mutex> lock(callback_mutex);
+                on_result(results[k]);
+            }
+        }
+        // Cada thread possui seu próprio ambiente do GLPK, liberado ao fim do trabalho
+        glp_free_env();
+    };
+
+    const int num_workers = static_cast<int>(std::min<size_t>(static_cast<size_t>(jobs_), instances.size()));
+    BB_LOG_INFO("BatchSolver") << "Resolvendo " << instances.size() << " instâncias com " << num_workers
+                               << " threads.";
+    std::vector<std::thread> threads;
+    threads.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
+
+std::vector<std::string> BatchSolver::expandInputs(const std::vector<std::string>& inputs) {
+    std::vector<std::string> files;
+    for (const std::string& input : inputs) {
+        if (!input.empty() && input[0] == '@') {
+            addManifest(input.substr(1), files);
+        } else if (fs::is_directory(input)) {
+            addDirectory(input, files);
+        } else if (fs::exists(input)) {
+            files.push_back(input);
+        } else {
+            throw std::invalid_argument("Entrada não encontrada: " + input);
+        }
+    }
+    return files;
+}
+
+void BatchSolver::writeHeader(std::ostream& out, OutputFormat format, bool include_solution) {
+    if (format == OutputFormat::CSV) {
+        out << "instance,status,objective,gap,nodes,lp_iterations,seconds"
+            << (include_solution ? ",solution" : "") << ",error\n";
+    }
+}
+
+void BatchSolver::write(std::ostream& out, const BatchResult& result, OutputFormat format, bool include_solution) {
+    std::ostringstream line;
+    line << std::setprecision(OUTPUT_PRECISION);
+    const bool has_objective = result.has_solution && std::isfinite(result.objective);
+    const bool has_gap = has_objective && std::isfinite(result.stats.gap);
+
+    if (format == OutputFormat::JSON_LINES) {
+        line << "{\"instance\":\"" << jsonEscape(result.instance) << "\""
+             << ",\"status\":\"" << statusName(result.status) << "\""
+             << ",\"objective\":";
+        if (has_objective) {
+            line << result.objective;
+        } else {
+            line << "null";
+        }
+        line << ",\"gap\":";
+        if (has_gap) {
+            line << result.stats.gap;
+        } else {
+            line << "null";
+        }
+        line << ",\"nodes\":" << result.stats.nodes
+             << ",\"lp_iterations\":" << result.stats.lp_iterations
+             << ",\"seconds\":" << result.stats.seconds;
+        if (include_solution) {
+            line << ",\"solution\":";
+            if (result.has_solution) {
+                line << "[" << joinSolution(result.solution, ',') << "]";
+            } else {
+                line << "null";
+            }
+        }
+        if (!result.error.empty()) {
+            line << ",\"error\":\"" << jsonEscape(result.error) << "\"";
+        }
+        line << "}\n";
+    } else {
+        line << csvQuote(result.instance) << "," << statusName(result.status) << ",";
+        if (has_objective) {
+            line << result.objective;
+        }
+        line << ",";
+        if (has_gap) {
+            line << result.stats.gap;
+        }
+        line << "," << result.stats.nodes << "," << result.stats.lp_iterations << "," << result.stats.seconds;
+        if (include_solution) {
+            line << "," << (result.has_solution ? joinSolution(result.solution, ' ') : "");
+        }
+        line << "," << csvQuote(result.error) << "\n";
+    }
+    // Uma única escrita por linha: a saída pode ser consumida enquanto o lote ainda executa
+    out << line.str() << std::flush;
+}
+
+const char* BatchSolver::statusName(SolveStatus status) {
+    switch (status) {
+        case SolveStatus::OK: return "optimal";
+        case SolveStatus::INFEASIBLE: return "infeasible";
+        case SolveStatus::UNBOUNDED: return "unbounded";
+        case SolveStatus::FRACTIONAL: return "fractional";
+        case SolveStatus::LIMIT_REACHED: return "limit";
+        case SolveStatus::FEASIBLE: return "feasible";
+        case SolveStatus::LP_LIMIT:
+        case SolveStatus::ERROR: break;
+    }
+    return "error";
+}
@@ -0,0 +1,244 @@
+#include "BinaryInstance.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "ProblemModel.h"
+
+namespace {
+    constexpr char MAGIC[8] = {'B', 'B', 'I', 'N', 'S', 'T', '\r', '\n'};
+    constexpr std::uint64_t BYTE_ORDER_MARK = 0x0102030405060708ULL;
+    constexpr std::uint32_t FLAG_MAXIMIZE = 1;
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t flags;
+        std::uint64_t byte_order;
+        std::int32_t num_rows;
+        std::int32_t num_cols;
+        std::int64_t num_nonzeros;
+        double objective_constant;
+        std::uint64_t payload_size;
+        std::uint64_t checksum;
+    };
+    static_assert(sizeof(Header) == 64, "O cabeçalho do formato binário deve ter 64 bytes");
+
+    size_t padded(size_t bytes) {
+        return (bytes + 7) / 8 * 8;
+    }
+
+    // Posição (em bytes, a partir do fim do cabeçalho) de cada seção
+    struct Layout {
+        size_t objective;
+        size_t col_lower;
+        size_t col_upper;
+        size_t row_lower;
+        size_t row_upper;
+        size_t values;
+        size_t row_start;
+        size_t col_index;
+        size_t size;
+
+        Layout(size_t rows, size_t cols, size_t nonzeros) {
+            objective = 0;
+            col_lower = objective + cols * sizeof(double);
+            col_upper = col_lower + cols * sizeof(double);
+            row_lower = col_upper + cols * sizeof(double);
+            row_upper = row_lower + rows * sizeof(double);
+            values = row_upper + rows * sizeof(double);
+            row_start = values + (nonzeros + 1) * sizeof(double);
+            col_index = row_start + padded((rows + 1) * sizeof(std::int32_t));
+            size = col_index + padded((nonzeros + 1) * sizeof(std::int32_t));
+        }
+    };
+
+    // FNV-1a sobre palavras de 64 bits (o conteúdo tem tamanho múltiplo de 8)
+    std::uint64_t checksum(const char* data, size_t size) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (size_t k = 0; k < size; k += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, data + k, sizeof(word));
+            hash = (hash ^ word) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    int boundType(double lower, double upper) {
+        const bool has_lower = std::isfinite(lower);
+        const bool has_upper = std::isfinite(upper);
+        if (has_lower && has_upper) {
+            return lower == upper ? GLP_FX : GLP_DB;
+        }
+        if (has_upper) {
+            return GLP_UP;
+        }
+        return has_lower ? GLP_LO : GLP_FR;
+    }
+
+    [[noreturn]] void fail(const std::string& message) {
+        throw std::invalid_argument("Instância binária inválida: " + message);
+    }
+}
+
+bool BinaryInstance::matches(std::string_view contents) noexcept {
+    return contents.size() >= sizeof(MAGIC) && std::memcmp(contents.data(), MAGIC, sizeof(MAGIC)) == 0;
+}
+
+void BinaryInstance::write(glp_prob* problem, const std::string& path) {
+    const ProblemModel model = ProblemModel::fromGlpk(problem);
+    const int num_rows = model.numRows();
+    const int num_cols = model.numCols();
+    const size_t nonzeros = static_cast<size_t>(model.rowStart(num_rows));
+    const Layout layout(num_rows, num_cols, nonzeros);
+
+    std::vector<char> payload(layout.size, 0);
+    auto section = [&](size_t offset, size_t index, auto value) {
+        std::memcpy(payload.data() + offset + index * sizeof(value), &value, sizeof(value));
+    };
+    for (int j = 0; j < num_cols; ++j) {
+        const int type = glp_get_col_type(problem, j + 1);
+        const bool has_lower = type == GLP_LO || type == GLP_DB || type == GLP_FX;
+        const bool has_upper = type == GLP_UP || type == GLP_DB || type == GLP_FX;
+        section(layout.objective, j, model.objective(j));
+        section(layout.col_lower, j, has_lower ? glp_get_col_lb(problem, j + 1) : -INF);
+        section(layout.col_upper, j, has_upper ? glp_get_col_ub(problem, j + 1) : INF);
+    }
+    for (int i = 0; i < num_rows; ++i) {
+        section(layout.row_lower, i, model.rowLower(i));
+        section(layout.row_upper, i, model.rowUpper(i));
+    }
+    for (int i = 0; i <= num_rows; ++i) {
+        section(layout.row_start, i, static_cast<std::int32_t>(model.rowStart(i)));
+    }
+    for (size_t k = 0; k < nonzeros; ++k) {
+        section(layout.values, k + 1, model.rowValue(static_cast<int>(k)));
+        section(layout.col_index, k + 1, static_cast<std::int32_t>(model.rowCol(static_cast<int>(k)) + 1));
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.flags = model.isMaximization() ? FLAG_MAXIMIZE : 0;
+    header.byte_order = BYTE_ORDER_MARK;
+    header.num_rows = num_rows;
+    header.num_cols = num_cols;
+    header.num_nonzeros = static_cast<std::int64_t>(nonzeros);
+    header.objective_constant = model.objectiveConstant();
+    header.payload_size = layout.size;
+    header.checksum = checksum(payload.data(), payload.size());
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    if (!out) {
+        throw std::runtime_error("Falha ao gravar a instância binária: " + path);
+    }
+}
+
+glp_prob* BinaryInstance::load(std::string_view contents) {
+    // As seções são lidas no lugar e precisam de alinhamento de 8 bytes (garantido pelo mmap)
+    if (reinterpret_cast<std::uintptr_t>(contents.data()) % alignof(double) != 0) {
+        std::vector<double> aligned((contents.size() + sizeof(double) - 1) / sizeof(double));
+        std::memcpy(aligned.data(), contents.data(), contents.size());
+        return load(std::string_view(reinterpret_cast<const char*>(aligned.data()), contents.size()));
+    }
+
+    if (!matches(contents) || contents.size() < sizeof(Header)) {
+        fail("identificador ausente ou arquivo truncado.");
+    }
+    Header header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    if (header.byte_order != BYTE_ORDER_MARK) {
+        fail("ordem de bytes incompatível.");
+    }
+    if (header.version == 0 || header.version > VERSION) {
+        fail("versão " + std::to_string(header.version) + " não suportada.");
+    }
+    if (header.num_rows < 0 || header.num_cols < 0 || header.num_nonzeros < 0) {
+        fail("dimensões negativas.");
+    }
+    // Os inícios das linhas são int32: mais não-nulos que isso não são representáveis, e o limite
+    // mantém os deslocamentos do Layout longe de estouro
+    if (header.num_nonzeros > std::numeric_limits<std::int32_t>::max()) {
+        fail("número de não-nulos acima do limite do formato.");
+    }
+    const size_t num_rows = static_cast<size_t>(header.num_rows);
+    const size_t num_cols = static_cast<size_t>(header.num_cols);
+    const size_t nonzeros = static_cast<size_t>(header.num_nonzeros);
+    const Layout layout(num_rows, num_cols, nonzeros);
+    if (header.payload_size != layout.size || contents.size() != sizeof(Header) + layout.size) {
+        fail("tamanho do conteúdo não confere com o cabeçalho.");
+    }
+    const char* payload = contents.data() + sizeof(Header);
+    if (checksum(payload, layout.size) != header.checksum) {
+        fail("checksum não confere.");
+    }
+
+    const double* objective = reinterpret_cast<const double*>(payload + layout.objective);
+    const double* col_lower = reinterpret_cast<const double*>(payload + layout.col_lower);
+    const double* col_upper = reinterpret_cast<const double*>(payload + layout.col_upper);
+    const double* row_lower = reinterpret_cast<const double*>(payload + layout.row_lower);
+    const double* row_upper = reinterpret_cast<const double*>(payload + layout.row_upper);
+    const double* values = reinterpret_cast<const double*>(payload + layout.values);
+    const std::int32_t* row_start = reinterpret_cast<const std::int32_t*>(payload + layout.row_start);
+    const std::int32_t* col_index = reinterpret_cast<const std::int32_t*>(payload + layout.col_index);
+
+    // O GLPK aborta com índices inválidos: a estrutura é conferida antes de criar o problema
+    if (row_start[0] != 0 || static_cast<size_t>(row_start[num_rows]) != nonzeros) {
+        fail("início das linhas inconsistente.");
+    }
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (row_start[i + 1] < row_start[i]) {
+            fail("início das linhas inconsistente.");
+        }
+    }
+    for (size_t k = 1; k <= nonzeros; ++k) {
+        if (col_index[k] < 1 || static_cast<size_t>(col_index[k]) > num_cols) {
+            fail("índice de coluna fora do intervalo.");
+        }
+    }
+    std::vector<std::int32_t> last_row(num_cols + 1, -1); // Última linha em que cada coluna apareceu
+    for (size_t i = 0; i < num_rows; ++i) {
+        for (std::int32_t k = row_start[i] + 1; k <= row_start[i + 1]; ++k) {
+            if (last_row[col_index[k]] == static_cast<std::int32_t>(i)) {
+                fail("coluna " + std::to_string(col_index[k]) + " repetida na linha " + std::to_string(i + 1) + ".");
+            }
+            last_row[col_index[k]] = static_cast<std::int32_t>(i);
+        }
+    }
+
+    // Todas as variáveis são binárias, como nos formatos de texto (ProblemReader)
+    for (size_t j = 0; j < num_cols; ++j) {
+        if (!(col_lower[j] >= 0.0 && col_upper[j] <= 1.0 && col_lower[j] <= col_upper[j])) {
+            fail("a variável x" + std::to_string(j + 1) + " não é binária.");
+        }
+    }
+
+    glp_prob* lp = glp_create_prob();
+    glp_set_obj_dir(lp, header.flags & FLAG_MAXIMIZE ? GLP_MAX : GLP_MIN);
+    glp_set_obj_coef(lp, 0, header.objective_constant);
+    if (num_rows > 0) {
+        glp_add_rows(lp, header.num_rows);
+    }
+    if (num_cols > 0) {
+        glp_add_cols(lp, header.num_cols);
+    }
+    for (int j = 0; j < header.num_cols; ++j) {
+        glp_set_col_bnds(lp, j + 1, boundType(col_lower[j], col_upper[j]),
+                         std::isfinite(col_lower[j]) ? col_lower[j] : 0.0,
+                         std::isfinite(col_upper[j]) ? col_upper[j] : 0.0);
+        glp_set_obj_coef(lp, j + 1, objective[j]);
+    }
+    for (int i = 0; i < header.num_rows; ++i) {
+        glp_set_row_bnds(lp, i + 1, boundType(row_lower[i], row_upper[i]),
+                         std::isfinite(row_lower[i]) ? row_lower[i] : 0.0,
+                         std::isfinite(row_upper[i]) ? row_upper[i] : 0.0);
+        // Linha i ocupa as posições [row_start[i] + 1, row_start[i + 1]], lidas pelo GLPK a partir do índice 1
+        glp_set_mat_row(lp, i + 1, row_start[i + 1] - row_start[i], col_index + row_start[i], values + row_start[i]);
+    }
+    return lp;
+}
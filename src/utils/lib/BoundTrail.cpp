@@ -0,0 +1,48 @@
+#include "BoundTrail.h"
+#include <stdexcept>
+
+BoundTrail::BoundTrail(glp_prob* problem)
+    : problem_(problem) {
+    if (!problem_) {
+        throw std::invalid_argument("BoundTrail requer um problema GLPK não nulo");
+    }
+}
+
+void BoundTrail::moveTo(const std::vector<std::pair<int, int>>& fixed_vars) {
+    // Tamanho do prefixo comum entre o estado atual e o nó de destino
+    std::size_t common = 0;
+    while (common < trail_.size() && common < fixed_vars.size() &&
+           trail_[common].var == fixed_vars[common].first &&
+           trail_[common].value == fixed_vars[common].second) {
+        ++common;
+    }
+
+    undoTo(common);
+
+    // Aplica as fixações restantes, guardando os limites anteriores
+    for (std::size_t k = common; k < fixed_vars.size(); ++k) {
+        const int col = fixed_vars[k].first + 1;
+        const int value = fixed_vars[k].second;
+        trail_.push_back(Entry{
+            fixed_vars[k].first,
+            value,
+            glp_get_col_type(problem_, col),
+            glp_get_col_lb(problem_, col),
+            glp_get_col_ub(problem_, col)
+        });
+        glp_set_col_bnds(problem_, col, GLP_FX, value, value);
+    }
+}
+
+void BoundTrail::reset() {
+    undoTo(0);
+}
+
+void BoundTrail::undoTo(std::size_t size) {
+    // Desfaz em ordem inversa para restaurar corretamente variáveis fixadas mais de uma vez
+    while (trail_.size() > size) {
+        const Entry& entry = trail_.back();
+        glp_set_col_bnds(problem_, entry.var + 1, entry.old_type, entry.old_lb, entry.old_ub);
+        trail_.pop_back();
+    }
+}
@@ -1,63 +1,103 @@
 #include "BranchAndBound.h"
-#include <queue>
-#include <stack>
+#include "WorkStealingQueues.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
-#include <iostream> // Para logs
+#include "Logger.h"
+#include "Presolve.h"
 
 namespace {
     constexpr double INTEGER_TOLERANCE = 1e-6;
+
+    // Queda relativa mínima do limite por rodada de cortes e rodadas seguidas abaixo dela até parar
+    constexpr double CUT_MIN_IMPROVEMENT = 1e-4;
+    constexpr int CUT_MAX_STALLED_ROUNDS = 2;
+
+    // Nó de uma execução anterior: só fixações, resolvido no LP da thread
+    Node seedNode(const OpenNode& open_node, FixingArena& arena) {
+        const int depth = static_cast<int>(open_node.fixings.size());
+        Node node(nullptr, arena.make(open_node.fixings), open_node.bound, NodeType::ROOT);
+        node.depth = depth;
+        node.estimate = open_node.bound;
+        return node;
+    }
+
+    // Soma em seconds o tempo decorrido até o fim do escopo (cobre todos os retornos antecipados)
+    class PhaseTimer {
+    public:
+        explicit PhaseTimer(double& seconds)
+            : seconds_(seconds), start_(std::chrono::steady_clock::now()) {}
+        ~PhaseTimer() {
+            seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+        }
+
+        std::chrono::steady_clock::time_point start() const { return start_; }
+
+    private:
+        double& seconds_;
+        std::chrono::steady_clock::time_point start_;
+    };
+}
+
+bool BranchAndBound::SearchControl::shouldStop() {
+    if (limit_reached.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if ((node_limit > 0 && nodes.load(std::memory_order_relaxed) >= node_limit) ||
+        (has_deadline && std::chrono::steady_clock::now() >= deadline)) {
+        limit_reached.store(true, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
 }
 
-// Construtor principal
-Node::Node(
-    std::unique_ptr<GLPKSolver> solver,
-    std::vector<std::pair<int, int>> fixed,
-    double b,
-    NodeType t
-) : solver(std::move(solver)),
-    fixed_vars(std::move(fixed)),
-    bound(b),
-    type(t) {}
-
-// Construtor de movimento
-Node::Node(Node&& other) noexcept
-    : solver(std::move(other.solver)),
-      fixed_vars(std::move(other.fixed_vars)),
-      bound(other.bound),
-      type(other.type) {}
-
-// Operador de atribuição por movimento
-Node& Node::operator=(Node&& other) noexcept {
-    if (this != &other) {
-        solver = std::move(other.solver);
-        fixed_vars = std::move(other.fixed_vars);
-        bound = other.bound;
-        type = other.type;
-    }
-    return *this;
+bool BranchAndBound::SearchControl::progressDue() {
+    if (progress_interval <= 0.0) {
+        return false;
+    }
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto due = next_progress.load(std::memory_order_relaxed);
+    if (now < due) {
+        return false;
+    }
+    const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(progress_interval)).count();
+    return next_progress.compare_exchange_strong(due, now + interval, std::memory_order_relaxed);
 }
 
 // Construtor da classe BranchAndBound
 BranchAndBound::BranchAndBound() 
-    : best_objective_(-std::numeric_limits<double>::infinity()) {}
+    : BranchAndBound(BranchAndBoundOptions()) {}
+
+BranchAndBound::BranchAndBound(BranchAndBoundOptions options)
+    : options_(options),
+      best_objective_(-std::numeric_limits<double>::infinity()) {}
 
 // Copia um problema GLPK
 GLPProbPtr BranchAndBound::copyProblem(glp_prob* original) const {
     if (!original) {
-        std::cerr << "[BranchAndBound][ERRO] Não é possível copiar um problema nulo." << std::endl;
+        BB_LOG_ERROR("BranchAndBound") << "Não é possível copiar um problema nulo.";
         throw std::invalid_argument("Não é possível copiar um problema nulo");
     }
-    std::cout << "[BranchAndBound][INFO] Copiando problema GLPK." << std::endl;
+    BB_LOG_TRACE("BranchAndBound") << "Copiando problema GLPK.";
     GLPProbPtr copy(glp_create_prob());
     if (!copy) {
-        std::cerr << "[BranchAndBound][ERRO] Falha ao criar um novo problema GLPK." << std::endl;
+        BB_LOG_ERROR("BranchAndBound") << "Falha ao criar um novo problema GLPK.";
         throw std::runtime_error("Falha ao criar um novo problema GLPK");
     }
     glp_copy_prob(copy.get(), original, GLP_ON);
-    std::cout << "[BranchAndBound][INFO] Problema copiado com sucesso." << std::endl;
+    BB_LOG_TRACE("BranchAndBound") << "Problema copiado com sucesso.";
     return copy;
 }
 
@@ -68,13 +108,13 @@ void BranchAndBound::addFixedConstraints(
     glp_prob* lp, 
     const std::vector<std::pair<int, int>>& fixed_vars) const {
     if (!lp) {
-        std::cerr << "[BranchAndBound][AVISO] Problema GLPK nulo fornecido para adicionar restrições." << std::endl;
+        BB_LOG_WARNING("BranchAndBound") << "Problema GLPK nulo fornecido para adicionar restrições.";
         return;
     }
-    std::cout << "[BranchAndBound][INFO] Adicionando restrições fixas ao problema." << std::endl;
+    BB_LOG_TRACE("BranchAndBound") << "Adicionando restrições fixas ao problema.";
     for (const auto& [var_idx, fixed_value] : fixed_vars) {
-        std::cout << "[BranchAndBound][DEBUG] Fixando variável x" << var_idx + 1 
-                  << " ao valor " << fixed_value << "." << std::endl;
+        BB_LOG_TRACE("BranchAndBound") << "Fixando variável x" << var_idx + 1 
+                                        << " ao valor " << fixed_value << ".";
         glp_set_col_bnds(lp, var_idx + 1, GLP_FX, fixed_value, fixed_value);
     }
 }
@@ -83,19 +123,19 @@ void BranchAndBound::addFixedConstraints(
 SolveStatus BranchAndBound::solutionIsInteger(
     const std::vector<double>& solution, 
     int& fractional_var) const {
-    std::cout << "[BranchAndBound][INFO] Verificando se a solução é inteira." << std::endl;
+    BB_LOG_TRACE("BranchAndBound") << "Verificando se a solução é inteira.";
     fractional_var = selectBranchingVariable(solution);
     if (fractional_var == -1) {
-        std::cout << "[BranchAndBound][INFO] Solução é inteira." << std::endl;
+        BB_LOG_TRACE("BranchAndBound") << "Solução é inteira.";
         for (double val : solution) {
             if (val < -INTEGER_TOLERANCE || val > 1.0 + INTEGER_TOLERANCE) {
-                std::cerr << "[BranchAndBound][AVISO] Solução é inviável." << std::endl;
+                BB_LOG_DEBUG("BranchAndBound") << "Solução é inviável.";
                 return SolveStatus::INFEASIBLE;
             }
         }
         return SolveStatus::OK;
     }
-    std::cout << "[BranchAndBound][INFO] Solução é fracionária." << std::endl;
+    BB_LOG_TRACE("BranchAndBound") << "Solução é fracionária.";
     return SolveStatus::FRACTIONAL;
 }
 
@@ -108,8 +148,8 @@ int BranchAndBound::selectBranchingVariable(const std::vector<double>& solution)
     for (size_t i = 0; i < solution.size(); ++i) {
         double value = solution[i];
         if (value < -INTEGER_TOLERANCE || value > 1.0 + INTEGER_TOLERANCE) {
-            std::cout << "[BranchAndBound][DEBUG] Variável x" << i + 1 
-                      << " inviável: " << value << std::endl;
+            BB_LOG_TRACE("BranchAndBound") << "Variável x" << i + 1 
+                                            << " inviável: " << value;
             return -1; // Nó inviável
         }
     }
@@ -127,172 +167,1267 @@ int BranchAndBound::selectBranchingVariable(const std::vector<double>& solution)
     return fractional_var;
 }
 
+// Estima o melhor objetivo inteiro alcançável pelo filho (best-estimate)
+// Cada variável fracionária é arredondada para o lado mais barato, e a variável de
+// ramificação para o lado do filho; a perda de objetivo estimada é descontada do pai.
+double BranchAndBound::estimateChildObjective(
+    const std::vector<double>& solution,
+    double node_objective,
+    int branching_var,
+    int value) const {
+    // Perda por unidade em cada direção: pseudo-custo quando já observado, senão |c_j|
+    auto unit_cost = [this](int var, int side) {
+        if (pseudo_costs_ && pseudo_costs_->observations(var, side) > 0) {
+            return pseudo_costs_->unitCost(var, side);
+        }
+        return std::abs(objective_coefs_[var]);
+    };
+
+    double degradation = 0.0;
+    for (size_t i = 0; i < solution.size(); ++i) {
+        const double frac = solution[i] - std::floor(solution[i]);
+        if (frac <= INTEGER_TOLERANCE || frac >= 1.0 - INTEGER_TOLERANCE) {
+            continue;
+        }
+        const int var = static_cast<int>(i);
+        const double down = frac * unit_cost(var, 0);
+        const double up = (1.0 - frac) * unit_cost(var, 1);
+        if (var == branching_var) {
+            degradation += value == 0 ? down : up;
+        } else {
+            degradation += std::min(down, up);
+        }
+    }
+    return node_objective - degradation;
+}
+
 // Cria nós filhos a partir de um nó atual
+template <typename NodeSink>
 void BranchAndBound::createChildNodes(Node&& current_node,
+                                    const std::vector<std::pair<int, int>>& fixed_vars,
                                     int branching_var,
-                                    std::function<void(Node&&)> node_processor) {
+                                    double node_objective,
+                                    const std::vector<double>& relaxed_solution,
+                                    std::shared_ptr<const LpBasis> parent_basis,
+                                    NodeSink& node_sink) {
     if (branching_var == -1) {
-        std::cerr << "[BranchAndBound][AVISO] Variável de ramificação inválida (-1)." << std::endl;
+        BB_LOG_WARNING("BranchAndBound") << "Variável de ramificação inválida (-1).";
         return;
     }
-    std::cout << "[BranchAndBound][INFO] Criando nós filhos para a variável de ramificação x" 
-              << branching_var + 1 << "." << std::endl;
+    BB_LOG_TRACE("BranchAndBound") << "Criando nós filhos para a variável de ramificação x" 
+                                    << branching_var + 1 << ".";
+
+    // O objetivo da relaxação do nó atual é um limite superior válido para ambos os filhos.
+    // Com a trilha compartilhada (SHARED_TRAIL) o nó não possui solver e os filhos também não:
+    // basta a lista de fixações.
+    const int child_depth = current_node.depth + 1;
+    const double frac = relaxed_solution[branching_var] - std::floor(relaxed_solution[branching_var]);
+
+    // Os filhos compartilham as fixações do nó, acrescidas das implicadas durante o processamento
+    FixingChain parent_fixings = std::move(current_node.fixings);
+    for (std::size_t k = parent_fixings.size(); k < fixed_vars.size(); ++k) {
+        parent_fixings = fixing_arena_->extend(parent_fixings, fixed_vars[k].first, fixed_vars[k].second);
+    }
 
     // Cria nó filho esquerdo (x_j = 0)
-    auto left_problem = copyProblem(current_node.solver->getProblem());
-    std::vector<std::pair<int, int>> left_fixed = current_node.fixed_vars;
-    left_fixed.emplace_back(branching_var, 0);
-    auto left_solver = std::make_unique<GLPKSolver>(std::move(left_problem));
-    node_processor(Node(std::move(left_solver), std::move(left_fixed), 
-                      current_node.bound, NodeType::LEFT_CHILD));
-    std::cout << "[BranchAndBound][DEBUG] Nó filho esquerdo criado com x" << branching_var + 1 << " = 0." << std::endl;
+    std::unique_ptr<GLPKSolver> left_solver;
+    if (current_node.solver) {
+        left_solver = std::make_unique<GLPKSolver>(copyProblem(current_node.solver->getProblem()));
+    }
+    Node left(std::move(left_solver), fixing_arena_->extend(parent_fixings, branching_var, 0),
+              node_objective, NodeType::LEFT_CHILD);
+    left.depth = child_depth;
+    left.warm_basis = parent_basis;
+    left.branch_var = branching_var;
+    left.branch_value = 0;
+    left.branch_distance = frac;
+    left.estimate = estimateChildObjective(relaxed_solution, node_objective, branching_var, 0);
+    node_sink(std::move(left));
+    BB_LOG_TRACE("BranchAndBound") << "Nó filho esquerdo criado com x" << branching_var + 1 << " = 0.";
 
     // Cria nó filho direito (x_j = 1)
-    auto right_problem = copyProblem(current_node.solver->getProblem());
-    std::vector<std::pair<int, int>> right_fixed = current_node.fixed_vars;
-    right_fixed.emplace_back(branching_var, 1);
-    auto right_solver = std::make_unique<GLPKSolver>(std::move(right_problem));
-    node_processor(Node(std::move(right_solver), std::move(right_fixed), 
-                  current_node.bound, NodeType::RIGHT_CHILD));
-    std::cout << "[BranchAndBound][DEBUG] Nó filho direito criado com x" << branching_var + 1 << " = 1." << std::endl;
+    // O nó atual é consumido aqui, então o filho direito herda o problema dele sem cópia
+    std::unique_ptr<GLPKSolver> right_solver = std::move(current_node.solver);
+    Node right(std::move(right_solver), fixing_arena_->extend(parent_fixings, branching_var, 1),
+               node_objective, NodeType::RIGHT_CHILD);
+    right.depth = child_depth;
+    right.warm_basis = std::move(parent_basis);
+    right.branch_var = branching_var;
+    right.branch_value = 1;
+    right.branch_distance = 1.0 - frac;
+    right.estimate = estimateChildObjective(relaxed_solution, node_objective, branching_var, 1);
+    node_sink(std::move(right));
+    BB_LOG_TRACE("BranchAndBound") << "Nó filho direito criado com x" << branching_var + 1 << " = 1.";
 }
 
 // Verifica se a solução é viável
-bool BranchAndBound::isSolutionFeasible(glp_prob* problem, const std::vector<int>& solution) const {
-    const int num_rows = glp_get_num_rows(problem);
-    for (int row = 1; row <= num_rows; ++row) {
-        double lhs = 0.0;
-        const int num_cols = glp_get_num_cols(problem);
-        int* indices = new int[num_cols + 1];
-        double* coefs = new double[num_cols + 1];
-        int len = glp_get_mat_row(problem, row, indices, coefs);
-        
-        for (int i = 1; i <= len; ++i) {
-            int col = indices[i];
-            lhs += coefs[i] * solution[col - 1];
+bool BranchAndBound::isSolutionFeasible(const std::vector<int>& solution) const {
+    return model_->isFeasible(solution, INTEGER_TOLERANCE);
+}
+
+// Resolve o problema usando a estratégia de seleção definida nas opções
+SolveStatus BranchAndBound::solve(
+    GLPProbPtr original_problem, 
+    std::vector<int>& solution, 
+    double& objective_value) {
+    return solve(std::move(original_problem), solution, objective_value,
+                 makeNodeSelector(options_.node_selection, options_.max_plunge_depth));
+}
+
+// Resolve o problema usando busca em profundidade ou em largura
+SolveStatus BranchAndBound::solve(
+    GLPProbPtr original_problem, 
+    std::vector<int>& solution, 
+    double& objective_value, 
+    bool use_depth_first) {
+    return solve(std::move(original_problem), solution, objective_value,
+                 makeNodeSelector(use_depth_first ? NodeSelection::DEPTH_FIRST
+                                                  : NodeSelection::BREADTH_FIRST));
+}
+
+// Rodadas de separação de cortes sobre a relaxação do nó
+SolveStatus BranchAndBound::separateCuts(
+    GLPKSolver& solver,
+    std::vector<double>& relaxed_solution,
+    double& objective,
+    int depth,
+    const Incumbent& incumbent,
+    SearchLp& search_lp) {
+    const CutParams& params = options_.cuts;
+    int rounds = params.tree_rounds;
+    if (depth == 0) {
+        rounds = params.root_rounds;
+    } else if (params.tree_frequency <= 0 || depth % params.tree_frequency != 0) {
+        return SolveStatus::OK;
+    }
+
+    glp_prob* lp = solver.getProblem();
+    const double initial_objective = objective;
+    int total_cuts = 0;
+    int stalled_rounds = 0;
+    int round = 0;
+    for (; round < rounds; ++round) {
+        // Cortes que já estão no LP
+        std::vector<char> in_lp(cut_pool_->size(), 0);
+        for (int row = 1; row <= glp_get_num_rows(lp); ++row) {
+            const int id = CutPool::idOfRow(lp, row);
+            if (id >= 0) {
+                in_lp.resize(std::max(in_lp.size(), static_cast<size_t>(id) + 1), 0);
+                in_lp[id] = 1;
+            }
         }
+
+        // Primeiro os cortes novos (já ordenados por eficácia), depois os do pool violados de novo
+        std::vector<int> selected;
+        for (Cut& cut : cut_separator_->separate(relaxed_solution)) {
+            const int id = cut_pool_->add(std::move(cut)).first;
+            if (static_cast<size_t>(id) >= in_lp.size()) {
+                in_lp.resize(static_cast<size_t>(id) + 1, 0);
+            }
+            if (!in_lp[id]) {
+                in_lp[id] = 1;
+                selected.push_back(id);
+            }
+        }
+        for (int id : cut_pool_->violated(relaxed_solution, params.min_violation, in_lp)) {
+            selected.push_back(id);
+        }
+        if (static_cast<int>(selected.size()) > params.max_cuts_per_round) {
+            selected.resize(static_cast<size_t>(params.max_cuts_per_round));
+        }
+        if (selected.empty()) {
+            break;
+        }
+        for (int id : selected) {
+            CutPool::addToProblem(lp, id, cut_pool_->get(id));
+        }
+        total_cuts += static_cast<int>(selected.size());
+
+        // As novas linhas entram na base com a folga: a base continua dual viável para o dual simplex
+        const double previous_objective = objective;
+        const SolveStatus status = solveRelaxation(solver, relaxed_solution, objective, search_lp);
+        if (status != SolveStatus::OK) {
+            return status;
+        }
+        if (objective <= incumbent.value()) {
+            ++round;
+            break;
+        }
+        // Encerra quando o limite praticamente deixa de cair
+        if (previous_objective - objective < CUT_MIN_IMPROVEMENT * std::max(1.0, std::abs(objective))) {
+            if (++stalled_rounds >= CUT_MAX_STALLED_ROUNDS) {
+                ++round;
+                break;
+            }
+        } else {
+            stalled_rounds = 0;
+        }
+    }
+
+    // Envelhecimento: cortes com a folga na base (inativos) por max_age separações saem do LP
+    std::vector<int> aged_rows{0}; // Base 1 para glp_del_rows
+    for (int row = 1; row <= glp_get_num_rows(lp); ++row) {
+        const int id = CutPool::idOfRow(lp, row);
+        if (id < 0) {
+            continue;
+        }
+        const bool active = glp_get_row_stat(lp, row) != GLP_BS;
+        if (cut_pool_->age(id, active) >= params.max_age && !active) {
+            aged_rows.push_back(row);
+        }
+    }
+    if (aged_rows.size() > 1) {
+        glp_del_rows(lp, static_cast<int>(aged_rows.size()) - 1, aged_rows.data());
+        // Só linhas básicas foram retiradas, então a base continua ótima; a reotimização apenas
+        // atualiza a solução guardada no problema (lida depois pelos custos reduzidos)
+        const SolveStatus status = solveRelaxation(solver, relaxed_solution, objective, search_lp);
+        if (status != SolveStatus::OK) {
+            return status;
+        }
+    }
+
+    if (total_cuts > 0 || aged_rows.size() > 1) {
+        const LogLevel level = depth == 0 ? LogLevel::INFO : LogLevel::DEBUG;
+        BB_LOG(level, "BranchAndBound") << "Cortes: " << total_cuts << " incluídos em " << round
+                                        << " rodadas, " << aged_rows.size() - 1 << " retirados; limite "
+                                        << initial_objective << " -> " << objective << ".";
+    }
+    return SolveStatus::OK;
+}
+
+SolveStatus BranchAndBound::solveRelaxation(GLPKSolver& solver, std::vector<double>& relaxed_solution,
+                                            double& objective, SearchLp& lp) const {
+    SolveStatus status = solver.solve(relaxed_solution, objective);
+    lp.lp_iterations += solver.lastIterationCount();
+    if (status == SolveStatus::LP_LIMIT) {
+        // O limite do simplex vale para heurísticas e strong branching; um nó precisa do ótimo da
+        // relaxação, tanto para podar quanto para ramificar
+        ++lp.stats.lp_limit_resolves;
+        SimplexParams unlimited = options_.simplex;
+        unlimited.iteration_limit = std::numeric_limits<int>::max();
+        unlimited.time_limit_ms = std::numeric_limits<int>::max();
+        solver.setSimplexParams(unlimited);
+        status = solver.solve(relaxed_solution, objective);
+        lp.lp_iterations += solver.lastIterationCount();
+        solver.setSimplexParams(options_.simplex);
+    }
+    return status;
+}
+
+// Inclui no LP os cortes do pool que ainda não foram repassados a ele
+void BranchAndBound::syncCuts(GLPKSolver& solver, std::size_t& synced_cuts) {
+    const std::size_t pool_size = cut_pool_->size();
+    if (synced_cuts >= pool_size) {
+        return;
+    }
+    glp_prob* lp = solver.getProblem();
+    std::vector<char> in_lp(pool_size, 0);
+    for (int row = 1; row <= glp_get_num_rows(lp); ++row) {
+        const int id = CutPool::idOfRow(lp, row);
+        if (id >= 0 && static_cast<size_t>(id) < pool_size) {
+            in_lp[id] = 1;
+        }
+    }
+    for (std::size_t id = synced_cuts; id < pool_size; ++id) {
+        if (!in_lp[id]) {
+            CutPool::addToProblem(lp, static_cast<int>(id), cut_pool_->get(static_cast<int>(id)));
+        }
+    }
+    synced_cuts = pool_size;
+}
+
+// Resolve a relaxação de um nó e decide entre podar, atualizar o incumbente ou ramificar
+template <typename NodeSink>
+BranchAndBound::NodeOutcome BranchAndBound::processNode(
+    Node&& current_node,
+    SearchLp& lp,
+    Incumbent& incumbent,
+    NodeSink& node_sink) {
+    BB_LOG_TRACE("BranchAndBound") << "Processando o próximo nó.";
+    SolveStats& stats = lp.stats;
+    std::vector<std::pair<int, int>>& fixed_vars = lp.fixed_vars;
+    current_node.fixings.materialize(fixed_vars);
+    stats.max_depth = std::max(stats.max_depth, current_node.depth);
+
+    // O limite herdado do pai já pode estar dominado pelo incumbente
+    if (prunedByBound(current_node.bound, incumbent, lp)) {
+        BB_LOG_DEBUG("BranchAndBound") << "Nó podado pelo limite do pai.";
+        return NodeOutcome::PRUNED;
+    }
+
+    // Nogoods aprendidos em outros nós podam o nó ou fixam variáveis antes do LP
+    if (conflict_pool_) {
+        const PhaseTimer timer(stats.propagation_seconds);
+        const ConflictCheck check = conflict_pool_->check(fixed_vars, pruneCutoff(incumbent.value()), lp.conflicts);
+        if (check.pruned || check.implied > 0) {
+            // Registra o limite se o nogood só vale pela tolerância de gap
+            prunedByBound(check.bound, incumbent, lp);
+        }
+        if (check.pruned) {
+            BB_LOG_DEBUG("BranchAndBound") << "Nó podado por um nogood do pool de conflitos.";
+            ++stats.nodes_conflict_pruned;
+            return std::isinf(check.bound) ? NodeOutcome::INFEASIBLE : NodeOutcome::PRUNED;
+        }
+    }
+
+    // Fixações implícitas pelas restrições e pela ordem das colunas idênticas, alternadas até o
+    // ponto fixo: um nó inviável é podado sem resolver o LP
+    if (options_.propagation || symmetry_) {
+        const PhaseTimer timer(stats.propagation_seconds);
+        const size_t explicit_fixings = fixed_vars.size();
+        bool feasible = true;
+        int infeasible_row = -1;
+        size_t round_start = 0;
+        do {
+            round_start = fixed_vars.size();
+            if (options_.propagation) {
+                feasible = propagator_->propagate(fixed_vars, lp.propagation, &infeasible_row);
+            }
+            if (feasible && symmetry_) {
+                feasible = symmetry_->propagate(fixed_vars, lp.symmetry);
+            }
+        } while (feasible && options_.propagation && symmetry_ && fixed_vars.size() > round_start);
+        if (!feasible) {
+            Conflict conflict;
+            if (conflict_pool_ && infeasible_row >= 0 &&
+                conflict_analyzer_->explainRow(infeasible_row, fixed_vars, conflict)) {
+                learnConflict(std::move(conflict), stats);
+            }
+            BB_LOG_DEBUG("BranchAndBound") << "Nó podado: propagação provou inviabilidade.";
+            return NodeOutcome::INFEASIBLE;
+        }
+        if (fixed_vars.size() > explicit_fixings) {
+            BB_LOG_TRACE("BranchAndBound") << "Propagação fixou " 
+                                            << fixed_vars.size() - explicit_fixings 
+                                            << " variáveis.";
+        }
+    }
+
+    // Limite lagrangiano (passe guloso, sem simplex): o LP só é resolvido se ele não podar
+    if (lagrangian_) {
+        double bound;
+        {
+            const PhaseTimer timer(stats.lagrangian_seconds);
+            bound = lagrangian_->bound(fixed_vars, pruneCutoff(incumbent.value()), lp.lagrangian);
+        }
+        if (prunedByBound(bound, incumbent, lp)) {
+            BB_LOG_DEBUG("BranchAndBound") << "Nó podado pelo limite lagrangiano.";
+            ++stats.nodes_lagrangian_pruned;
+            return std::isinf(bound) ? NodeOutcome::INFEASIBLE : NodeOutcome::PRUNED;
+        }
+    }
+
+    // Mesmas fixações já resolvidas numa execução anterior: poda pelo limite guardado, se ele ainda
+    // vale para o modelo, ou parte da base guardada em vez da do pai
+    std::shared_ptr<const LpBasis> start_basis = current_node.warm_basis;
+    LpCacheKey cache_key;
+    if (lp_cache_) {
+        cache_key = LpCache::keyOf(fixed_vars);
+        CachedLp cached;
+        if (lp_cache_->lookup(cache_key, cached)) {
+            ++stats.lp_cache_hits;
+            if (cached.bound_valid && prunedByBound(cached.bound, incumbent, lp)) {
+                BB_LOG_DEBUG("BranchAndBound") << "Nó podado pelo limite guardado na tabela de relaxações.";
+                ++stats.nodes_cache_pruned;
+                return std::isinf(cached.bound) ? NodeOutcome::INFEASIBLE : NodeOutcome::PRUNED;
+            }
+            if (cached.basis) {
+                start_basis = std::move(cached.basis);
+            }
+        } else {
+            ++stats.lp_cache_misses;
+        }
+    }
+
+    // Adiciona restrições de variáveis fixas
+    const bool shared_lp = !current_node.solver;
+    GLPKSolver& node_solver = shared_lp ? *lp.solver : *current_node.solver;
+    {
+        const PhaseTimer timer(stats.setup_seconds);
+        if (shared_lp && cut_pool_) {
+            syncCuts(node_solver, lp.synced_cuts);
+        }
+        if (shared_lp) {
+            lp.trail->moveTo(fixed_vars);
+        } else {
+            addFixedConstraints(node_solver.getProblem(), fixed_vars);
+        }
+        node_solver.setSimplexParams(options_.simplex);
+        if (options_.warm_start && start_basis) {
+            node_solver.restoreBasis(*start_basis);
+        }
+    }
+
+    // Resolve a relaxação linear, partindo da base do pai quando disponível
+    BB_LOG_TRACE("BranchAndBound") << "Resolvendo a relaxação linear.";
+    const int num_cols = glp_get_num_cols(node_solver.getProblem());
+    std::vector<double>& relaxed_solution = lp.relaxed_solution;
+    relaxed_solution.resize(num_cols);
+    double current_objective;
+    SolveStatus solve_status;
+    {
+        const PhaseTimer timer(stats.lp_seconds);
+        solve_status = solveRelaxation(node_solver, relaxed_solution, current_objective, lp);
+    }
+
+    // Verifica se o nó é viável e se o limite é promissor
+    if (solve_status != SolveStatus::OK) {
+        // A API do GLPK não expõe o raio de Farkas do dual simplex: o nogood é o conjunto de fixações
+        // do nó, guardado se for pequeno (ele volta a aparecer quando outra ordem de ramificação ou a
+        // propagação chegam às mesmas fixações)
+        if (glp_get_status(node_solver.getProblem()) == GLP_NOFEAS) {
+            if (conflict_pool_) {
+                learnConflict(Conflict{fixed_vars, -std::numeric_limits<double>::infinity()}, stats);
+            }
+            if (lp_cache_) {
+                lp_cache_->store(cache_key, -std::numeric_limits<double>::infinity(), nullptr);
+            }
+        }
+        BB_LOG_DEBUG("BranchAndBound") << "Nó podado por inviabilidade.";
+        return NodeOutcome::INFEASIBLE;
+    }
+    if (lp_cache_) {
+        lp_cache_->store(cache_key, current_objective, basis_pool_->save(node_solver));
+    }
+    // Aprende o pseudo-custo da ramificação que gerou este nó (o limite do nó é o objetivo do pai)
+    if (current_node.branch_var >= 0) {
+        pseudo_costs_->update(current_node.branch_var, current_node.branch_value,
+                              current_node.branch_distance, current_node.bound - current_objective);
+    }
+    if (prunedByBound(current_objective, incumbent, lp)) {
+        if (conflict_pool_) {
+            std::vector<double>& duals = lp.reduced_costs;
+            node_solver.getReducedCosts(duals);
+            learnConflict(ConflictAnalyzer::explainBound(fixed_vars, duals, current_objective,
+                                                         pruneCutoff(incumbent.value())), stats);
+        }
+        BB_LOG_DEBUG("BranchAndBound") << "Nó podado devido a limite não promissor.";
+        return NodeOutcome::PRUNED; // Poda o nó
+    }
+
+    // Fortalece a relaxação com cortes; cortes válidos tornando o LP inviável provam que o nó não tem inteiros
+    if (cut_separator_) {
+        {
+            const PhaseTimer timer(stats.cut_seconds);
+            solve_status = separateCuts(node_solver, relaxed_solution, current_objective,
+                                        current_node.depth, incumbent, lp);
+        }
+        if (solve_status != SolveStatus::OK) {
+            BB_LOG_DEBUG("BranchAndBound") << "Nó podado por inviabilidade após os cortes.";
+            return NodeOutcome::INFEASIBLE;
+        }
+        if (prunedByBound(current_objective, incumbent, lp)) {
+            BB_LOG_DEBUG("BranchAndBound") << "Nó podado pelo limite após os cortes.";
+            return NodeOutcome::PRUNED;
+        }
+    }
+
+    // Verifica se a solução é inteira
+    int fractional_var;
+    SolveStatus integer_status = solutionIsInteger(relaxed_solution, fractional_var);
+
+    if (integer_status == SolveStatus::OK) {
+        BB_LOG_DEBUG("BranchAndBound") << "Solução inteira encontrada com valor objetivo " 
+                                        << current_objective << ".";
+        std::vector<int> candidate_solution(relaxed_solution.size());
+        std::transform(
+            relaxed_solution.begin(), relaxed_solution.end(),
+            candidate_solution.begin(),
+            [](double val) { return static_cast<int>(std::round(val)); }
+        ); // Apenas arredondando a solução de double para int
         
-        delete[] indices;
-        delete[] coefs;
-        
-        const double rhs = glp_get_row_ub(problem, row);
-        if (lhs > rhs + INTEGER_TOLERANCE) {
-            return false;
+        if (isSolutionFeasible(candidate_solution) &&
+            incumbent.tryUpdate(current_objective, candidate_solution)) {
+            BB_LOG_INFO("BranchAndBound") << "Novo incumbente com valor objetivo " << current_objective << ".";
+            const PhaseTimer timer(stats.heuristic_seconds);
+            heuristics_->polish(std::move(candidate_solution), incumbent);
+            return NodeOutcome::INCUMBENT_UPDATED;
+        }
+        return NodeOutcome::INTEGER;
+    }
+    if (integer_status != SolveStatus::FRACTIONAL) {
+        return NodeOutcome::INFEASIBLE;
+    }
+
+    // Os custos reduzidos são lidos antes das heurísticas e da regra de ramificação,
+    // que reotimizam o LP (mergulhos, strong branching) e invalidam a solução dual.
+    std::vector<double>& reduced_costs = lp.reduced_costs;
+    reduced_costs.clear();
+    if (options_.reduced_cost_fixing) {
+        node_solver.getReducedCosts(reduced_costs);
+    }
+
+    // Heurísticas primais: um incumbente melhor pode fechar o próprio nó
+    const HeuristicContext heuristic_context{relaxed_solution, current_objective, fixed_vars,
+                                             current_node.depth, incumbent.value(), &node_solver};
+    bool improved;
+    {
+        const PhaseTimer timer(stats.heuristic_seconds);
+        improved = heuristics_->runAtNode(heuristic_context, incumbent, lp.lp_iterations);
+    }
+    if (improved && prunedByBound(current_objective, incumbent, lp)) {
+        // Os custos reduzidos lidos antes das heurísticas ainda explicam o limite do nó
+        if (conflict_pool_ && !reduced_costs.empty()) {
+            learnConflict(ConflictAnalyzer::explainBound(fixed_vars, reduced_costs, current_objective,
+                                                         pruneCutoff(incumbent.value())), stats);
+        }
+        BB_LOG_DEBUG("BranchAndBound") << "Nó podado pelo incumbente da heurística.";
+        return NodeOutcome::PRUNED;
+    }
+
+    // Fixação por custo reduzido: vale para os filhos, que herdam as fixações do nó
+    if (options_.reduced_cost_fixing) {
+        const PhaseTimer timer(stats.propagation_seconds);
+        const int fixed = propagator_->fixByReducedCost(relaxed_solution, reduced_costs, current_objective,
+                                                        incumbent.value(), fixed_vars, lp.propagation);
+        if (fixed > 0) {
+            BB_LOG_TRACE("BranchAndBound") << "Custos reduzidos fixaram " << fixed << " variáveis.";
         }
     }
+
+    BB_LOG_TRACE("BranchAndBound") << "Solução fracionária encontrada. Criando nós filhos.";
+    {
+        const PhaseTimer timer(stats.branching_seconds);
+        const BranchingContext context{node_solver, relaxed_solution, current_objective, lp.lp_iterations};
+        fractional_var = branching_rule_->select(context);
+    }
+    const PhaseTimer timer(stats.child_seconds);
+    std::shared_ptr<const LpBasis> basis;
+    if (options_.warm_start) {
+        basis = basis_pool_->save(node_solver);
+    }
+    createChildNodes(std::move(current_node), fixed_vars, fractional_var, current_objective,
+                     relaxed_solution, std::move(basis), node_sink);
+    return NodeOutcome::BRANCHED;
+}
+
+// Poda por limite, com as tolerâncias de gap das opções
+bool BranchAndBound::prunedByBound(double bound, const Incumbent& incumbent, SearchLp& lp) const {
+    const double primal = incumbent.value();
+    if (bound <= primal) {
+        return true;
+    }
+    if (bound > pruneCutoff(primal)) {
+        return false;
+    }
+    lp.closed_bound = std::max(lp.closed_bound, bound);
     return true;
 }
 
-// Resolve o problema usando o algoritmo Branch and Bound
+// Incumbente mais a tolerância de gap (sem incumbente, nada além de -infinito é podado)
+double BranchAndBound::pruneCutoff(double primal) const {
+    if (!std::isfinite(primal)) {
+        return primal;
+    }
+    return primal + std::max(options_.absolute_gap, options_.relative_gap * std::abs(primal));
+}
+
+// Nogood de um nó podado; os grandes demais são descartados pelo pool
+void BranchAndBound::learnConflict(Conflict conflict, SolveStats& stats) const {
+    if (conflict_pool_->add(std::move(conflict))) {
+        ++stats.conflicts_learned;
+    }
+}
+
+// Contabiliza o resultado de um nó
+void BranchAndBound::recordOutcome(SolveStats& stats, NodeOutcome outcome) {
+    ++stats.nodes;
+    switch (outcome) {
+        case NodeOutcome::PRUNED: ++stats.nodes_pruned; break;
+        case NodeOutcome::INFEASIBLE: ++stats.nodes_infeasible; break;
+        case NodeOutcome::INTEGER:
+        case NodeOutcome::INCUMBENT_UPDATED: ++stats.nodes_integer; break;
+        case NodeOutcome::BRANCHED: ++stats.nodes_branched; break;
+    }
+}
+
+// Linha de progresso: tempo, nós processados e abertos, incumbente, melhor limite e gap
+void BranchAndBound::logProgress(const SearchControl& control, const Incumbent& incumbent,
+                                 long long processed, long long open_nodes, double open_bound) const {
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - control.start).count();
+    const double primal = incumbent.value();
+    // Sem nós abertos, o limite é o próprio incumbente
+    const double bound = open_nodes > 0 ? std::max(open_bound, primal) : primal;
+    const double gap = relativeGap(primal, bound);
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1) << elapsed << " s | nós " << processed
+         << " | abertos " << open_nodes << std::defaultfloat << std::setprecision(10) << " | incumbente ";
+    if (std::isfinite(primal)) {
+        line << control.objective_sign * primal;
+    } else {
+        line << "-";
+    }
+    line << " | limite " << control.objective_sign * bound << " | gap ";
+    if (std::isfinite(gap)) {
+        line << std::fixed << std::setprecision(2) << 100.0 * gap << "%";
+    } else {
+        line << "-";
+    }
+    BB_LOG_INFO("Progresso") << line.str();
+}
+
+// Resumo das estatísticas da busca
+void BranchAndBound::logStats() const {
+    BB_LOG_INFO("BranchAndBound") << "Nós: " << stats_.nodes << " (podados pelo limite " << stats_.nodes_pruned
+                                   << ", inviáveis " << stats_.nodes_infeasible << ", inteiros " << stats_.nodes_integer
+                                   << ", ramificados " << stats_.nodes_branched << "); profundidade máxima "
+                                   << stats_.max_depth << "; pico de nós abertos " << stats_.peak_open_nodes << ".";
+    BB_LOG_INFO("BranchAndBound") << "Iterações do simplex: " << stats_.lp_iterations << "; relaxações retomadas "
+                                   << "após o limite do simplex: " << stats_.lp_limit_resolves << ".";
+    if (conflict_pool_) {
+        BB_LOG_INFO("BranchAndBound") << "Conflitos: " << stats_.conflicts_learned << " nogoods aprendidos, "
+                                       << stats_.nodes_conflict_pruned << " nós podados pelo pool.";
+    }
+    if (lp_cache_) {
+        BB_LOG_INFO("BranchAndBound") << "Tabela de relaxações: " << stats_.lp_cache_hits << " acertos, "
+                                       << stats_.lp_cache_misses << " falhas, " << stats_.nodes_cache_pruned
+                                       << " nós podados; " << lp_cache_->size() << " entradas, "
+                                       << lp_cache_->memoryBytes() << " bytes.";
+    }
+    if (lagrangian_) {
+        BB_LOG_INFO("BranchAndBound") << "Relaxação lagrangiana: " << stats_.nodes_lagrangian_pruned
+                                       << " nós podados sem LP.";
+    }
+    if (stats_.peak_open_bytes > 0) {
+        BB_LOG_INFO("BranchAndBound") << "Memória dos nós abertos: pico de " << stats_.peak_open_bytes
+                                       << " bytes; " << stats_.nodes_compacted << " nós compactados, "
+                                       << stats_.nodes_spilled << " gravados em disco.";
+    }
+    BB_LOG_INFO("BranchAndBound") << std::fixed << std::setprecision(3) << "Tempo (s): presolve "
+                                   << stats_.presolve_seconds << ", busca " << stats_.search_seconds << " (LP "
+                                   << stats_.lp_seconds << ", preparação " << stats_.setup_seconds << ", propagação "
+                                   << stats_.propagation_seconds << ", lagrangiano " << stats_.lagrangian_seconds << ", cortes " << stats_.cut_seconds
+                                   << ", heurísticas " << stats_.heuristic_seconds << ", ramificação "
+                                   << stats_.branching_seconds << ", filhos " << stats_.child_seconds << ").";
+}
+
+// Busca sequencial guiada pela estratégia de seleção de nós
+void BranchAndBound::searchSequential(
+    GLPProbPtr problem,
+    NodeSelector& selector,
+    Incumbent& incumbent,
+    SearchControl& control,
+    long long& lp_iterations) {
+    BB_LOG_INFO("BranchAndBound") << "Estratégia de seleção de nós: " << selector.name() << ".";
+
+    // Cria o solver inicial: na trilha compartilhada ele pertence à busca, não ao nó raiz
+    auto initial_solver = std::make_unique<GLPKSolver>(std::move(problem));
+    SearchLp lp;
+    if (options_.lp_strategy == LpStrategy::SHARED_TRAIL) {
+        BB_LOG_INFO("BranchAndBound") << "Usando um único problema LP com trilha de limites.";
+        lp.solver = std::move(initial_solver);
+        lp.trail = std::make_unique<BoundTrail>(lp.solver->getProblem());
+    } else if (options_.node_memory_limit > 0 || control.seeded) {
+        // Com orçamento de memória os nós podem ser compactados (sem cópia do problema), e os nós de uma
+        // execução anterior só trazem fixações: eles são resolvidos numa cópia compartilhada com trilha
+        lp.solver = std::make_unique<GLPKSolver>(copyProblem(initial_solver->getProblem()));
+        lp.trail = std::make_unique<BoundTrail>(lp.solver->getProblem());
+    }
+    if (control.seeded) {
+        for (const OpenNode& root : control.roots) {
+            selector.push(seedNode(root, *fixing_arena_));
+        }
+        control.roots.clear();
+    } else {
+        selector.push(Node(std::move(initial_solver), 
+                           {}, // nenhuma variável fixa
+                           std::numeric_limits<double>::infinity(),  
+                           NodeType::ROOT));
+    }
+
+    // Destino dos nós filhos
+    auto process_node = [&selector](Node&& node) {
+        selector.push(std::move(node));
+    };
+
+    while (!selector.empty() && !control.shouldStop()) {
+        // O incumbente pode vir da relaxação inteira ou das heurísticas do nó
+        const double previous_incumbent = incumbent.value();
+        recordOutcome(lp.stats, processNode(selector.pop(), lp, incumbent, process_node));
+        control.nodes.fetch_add(1, std::memory_order_relaxed);
+        if (incumbent.value() > previous_incumbent) {
+            selector.onIncumbentUpdate(incumbent.value());
+        }
+        const long long open_nodes = static_cast<long long>(selector.size());
+        lp.stats.peak_open_nodes = std::max(lp.stats.peak_open_nodes, open_nodes);
+        if (control.progressDue()) {
+            logProgress(control, incumbent, lp.stats.nodes, open_nodes, selector.bestBound());
+        }
+    }
+    control.open_bound = std::max(selector.bestBound(), lp.closed_bound);
+    if (control.limit_reached.load()) {
+        for (Node& node : selector.releaseAll()) {
+            control.frontier.push_back(OpenNode{node.fixings.toVector(), node.bound});
+        }
+    }
+    lp_iterations += lp.lp_iterations;
+    stats_.accumulate(lp.stats);
+}
+
+// Busca paralela com deques por thread e roubo de trabalho
+void BranchAndBound::searchParallel(
+    GLPProbPtr problem,
+    int num_threads,
+    Incumbent& incumbent,
+    SearchControl& control,
+    long long& lp_iterations) {
+    BB_LOG_INFO("BranchAndBound") << "Busca paralela com " << num_threads << " threads.";
+
+    // Cada thread cria, usa e destrói sua própria cópia do problema: o GLPK registra a memória no
+    // ambiente da thread que a alocou, então um glp_prob não deve ser liberado por outra thread.
+    // O original só é lido (glp_copy_prob) enquanto esta thread aguarda.
+    std::vector<long long> iterations(static_cast<size_t>(num_threads), 0);
+    std::vector<SolveStats> thread_stats(static_cast<size_t>(num_threads));
+    std::vector<double> closed_bounds(static_cast<size_t>(num_threads), -std::numeric_limits<double>::infinity());
+
+    WorkStealingQueues<Node> queues(num_threads);
+    if (control.seeded) {
+        // Nós de uma execução anterior distribuídos entre as threads
+        for (size_t k = 0; k < control.roots.size(); ++k) {
+            queues.push(static_cast<int>(k % static_cast<size_t>(num_threads)), seedNode(control.roots[k], *fixing_arena_));
+        }
+        control.roots.clear();
+    } else {
+        queues.push(0, Node(nullptr, {}, std::numeric_limits<double>::infinity(), NodeType::ROOT));
+    }
+
+    // Limite do nó que cada thread está processando: entra no limite global das linhas de progresso
+    std::vector<std::atomic<double>> active_bounds(static_cast<size_t>(num_threads));
+    for (std::atomic<double>& bound : active_bounds) {
+        bound.store(-std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+    }
+    auto open_bound = [&]() {
+        double bound = -std::numeric_limits<double>::infinity();
+        queues.forEach([&bound](const Node& node) { bound = std::max(bound, node.bound); });
+        for (const std::atomic<double>& active : active_bounds) {
+            bound = std::max(bound, active.load(std::memory_order_relaxed));
+        }
+        return bound;
+    };
+
+
+    std::atomic<bool> abort{false};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+
+    auto worker = [&](int id) {
+        SearchLp lp;
+        auto process_node = [&queues, id](Node&& node) {
+            queues.push(id, std::move(node));
+        };
+        try {
+            lp.solver = std::make_unique<GLPKSolver>(copyProblem(problem.get()));
+            lp.trail = std::make_unique<BoundTrail>(lp.solver->getProblem());
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failure_mutex);
+            if (!failure) {
+                failure = std::current_exception();
+            }
+            abort.store(true, std::memory_order_relaxed);
+        }
+        int idle_rounds = 0;
+        while (!abort.load(std::memory_order_relaxed) && !control.shouldStop()) {
+            std::optional<Node> node = queues.pop(id);
+            if (!node) {
+                // Nenhum trabalho visível: termina só quando nenhum nó está aberto nem em processamento
+                if (queues.pending() == 0) {
+                    break;
+                }
+                if (++idle_rounds < 64) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+                continue;
+            }
+            idle_rounds = 0;
+            try {
+                active_bounds[id].store(node->bound, std::memory_order_relaxed);
+                recordOutcome(lp.stats, processNode(std::move(*node), lp, incumbent, process_node));
+                active_bounds[id].store(-std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+                control.nodes.fetch_add(1, std::memory_order_relaxed);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failure_mutex);
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+                abort.store(true, std::memory_order_relaxed);
+            }
+            queues.taskDone();
+            lp.stats.peak_open_nodes = std::max(lp.stats.peak_open_nodes, queues.pending());
+            if (control.progressDue()) {
+                logProgress(control, incumbent, control.nodes.load(std::memory_order_relaxed),
+                            queues.pending(), open_bound());
+            }
+        }
+        iterations[id] = lp.lp_iterations;
+        thread_stats[id] = lp.stats;
+        closed_bounds[id] = lp.closed_bound;
+
+        // Cada thread possui seu próprio ambiente do GLPK, liberado depois do seu problema
+        lp.trail.reset();
+        lp.solver.reset();
+        glp_free_env();
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<size_t>(num_threads));
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back(worker, t);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (long long count : iterations) {
+        lp_iterations += count;
+    }
+    for (const SolveStats& stats : thread_stats) {
+        stats_.accumulate(stats);
+    }
+    control.open_bound = open_bound();
+    if (control.limit_reached.load()) {
+        queues.forEach([&control](const Node& node) {
+            control.frontier.push_back(OpenNode{node.fixings.toVector(), node.bound});
+        });
+    }
+    for (double bound : closed_bounds) {
+        control.open_bound = std::max(control.open_bound, bound);
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+// Resolve o problema usando uma estratégia de seleção fornecida pelo chamador
 SolveStatus BranchAndBound::solve(
     GLPProbPtr original_problem, 
     std::vector<int>& solution, 
     double& objective_value, 
-    bool use_depth_first) {
+    std::unique_ptr<NodeSelector> selector) {
+    return solveFrom(std::move(original_problem), solution, objective_value, std::move(selector), WarmStart{});
+}
+
+// Resolve o problema a partir de uma execução anterior
+SolveStatus BranchAndBound::solve(
+    GLPProbPtr original_problem,
+    std::vector<int>& solution,
+    double& objective_value,
+    const WarmStart& start) {
+    return solveFrom(std::move(original_problem), solution, objective_value,
+                     makeNodeSelector(options_.node_selection, options_.max_plunge_depth), start);
+}
+
+// Aplica a alteração e resolve a partir da última execução
+SolveStatus BranchAndBound::resolve(
+    GLPProbPtr problem,
+    const ModelDelta& delta,
+    std::vector<int>& solution,
+    double& objective_value) {
+    if (!problem) {
+        BB_LOG_ERROR("BranchAndBound") << "Problema GLPK nulo fornecido para resolução.";
+        return SolveStatus::ERROR;
+    }
+    const bool restricts_only = delta.apply(problem.get());
+    WarmStart start = last_run_;
+    if (!restricts_only && start.frontier_complete) {
+        // Objetivo ou coeficientes alterados: limites e podas da árvore anterior não valem mais
+        BB_LOG_INFO("BranchAndBound") << "A alteração não apenas restringe o modelo; a árvore anterior é descartada.";
+        start.open_nodes.clear();
+        start.frontier_complete = false;
+    }
+    return solve(std::move(problem), solution, objective_value, start);
+}
+
+// Leva a solução e a fronteira da execução anterior ao espaço reduzido
+bool BranchAndBound::solveWithoutLp(Incumbent& incumbent, SearchControl& control, bool& completed) {
+    KnapsackForm form;
+    const bool knapsack = KnapsackForm::extract(*model_, form);
+    const bool combinatorial = knapsack && form.capacities.size() == 1;
+    const bool dynamic = knapsack && form.fitsDynamicProgramming(DynamicProgrammingKnapsack::MAX_STATES,
+                                                                 DynamicProgrammingKnapsack::MAX_CELLS);
+    SolverEngine engine = options_.engine;
+    if (engine == SolverEngine::AUTO) {
+        engine = combinatorial ? SolverEngine::COMBINATORIAL
+               : dynamic ? SolverEngine::DYNAMIC_PROGRAMMING
+               : SolverEngine::LP_BRANCH_AND_BOUND;
+    } else if ((engine == SolverEngine::COMBINATORIAL && !combinatorial) ||
+               (engine == SolverEngine::DYNAMIC_PROGRAMMING && !dynamic)) {
+        BB_LOG_WARNING("BranchAndBound") << "O algoritmo " << engineName(engine)
+                                         << " não se aplica ao problema; usando o branch and bound com LP.";
+        engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    }
+    stats_.engine = engine;
+    BB_LOG_INFO("BranchAndBound") << "Algoritmo: " << engineName(engine) << ".";
+    if (engine == SolverEngine::LP_BRANCH_AND_BOUND) {
+        return false;
+    }
+
+    EngineControl engine_control;
+    engine_control.should_stop = [&control]() { return control.shouldStop(); };
+    engine_control.cutoff = [this](double primal) { return pruneCutoff(primal); };
+    engine_control.count_nodes = [&control](long long count) {
+        control.nodes.fetch_add(count, std::memory_order_relaxed);
+    };
+    if (engine == SolverEngine::COMBINATORIAL) {
+        CombinatorialKnapsack solver(*model_, form);
+        completed = solver.solve(incumbent, engine_control);
+        control.open_bound = completed ? solver.closedBound() : solver.rootBound();
+    } else {
+        DynamicProgrammingKnapsack solver(*model_, form);
+        completed = solver.solve(incumbent, engine_control);
+        if (!completed) {
+            // Sem árvore, o único limite disponível é o lucro de todos os itens positivos
+            double bound = model_->objectiveConstant();
+            for (const double profit : form.profits) {
+                bound += std::max(0.0, profit);
+            }
+            control.open_bound = bound;
+        }
+    }
+    return true;
+}
+
+void BranchAndBound::seedWarmStart(const WarmStart& start, const Postsolve* postsolve,
+                                   Incumbent& incumbent, SearchControl& control) const {
+    const int original_cols = postsolve ? postsolve->originalCols() : model_->numCols();
+
+    // Coluna reduzida de cada coluna original (-1: fixada pelo presolve) e valor das fixadas
+    std::vector<int> reduced_index(static_cast<size_t>(original_cols));
+    std::vector<int> fixed_value;
+    if (postsolve) {
+        std::fill(reduced_index.begin(), reduced_index.end(), -1);
+        for (int k = 0; k < postsolve->reducedCols(); ++k) {
+            reduced_index[postsolve->originalIndex(k)] = k;
+        }
+        fixed_value = postsolve->restore(std::vector<int>(static_cast<size_t>(postsolve->reducedCols()), 0));
+    } else {
+        std::iota(reduced_index.begin(), reduced_index.end(), 0);
+    }
+
+    bool prior_feasible = true;
+    if (!start.solution.empty()) {
+        if (static_cast<int>(start.solution.size()) != original_cols) {
+            throw std::invalid_argument("WarmStart: a solução anterior tem " + std::to_string(start.solution.size()) +
+                                        " variáveis; o problema tem " + std::to_string(original_cols) + ".");
+        }
+        // Colunas fixadas pelo presolve ficam com o valor dele: se a solução reduzida é viável, a
+        // reconstruída também é, e com o mesmo objetivo (o reduzido guarda as fixações na constante)
+        std::vector<int> reduced(static_cast<size_t>(model_->numCols()));
+        for (int j = 0; j < original_cols; ++j) {
+            if (reduced_index[j] >= 0) {
+                reduced[reduced_index[j]] = start.solution[j];
+            }
+        }
+        prior_feasible = isSolutionFeasible(reduced);
+        if (prior_feasible) {
+            incumbent.tryUpdate(model_->objectiveValue(reduced), reduced);
+            BB_LOG_INFO("BranchAndBound") << "Solução anterior continua viável: incumbente inicial com valor "
+                                           << control.objective_sign * incumbent.value() << ".";
+        } else {
+            BB_LOG_INFO("BranchAndBound") << "Solução anterior inviável no modelo alterado.";
+        }
+    }
+
+    if (!start.frontier_complete) {
+        return;
+    }
+    if (!prior_feasible) {
+        // As podas da árvore anterior comparavam os nós com uma solução que deixou de existir
+        BB_LOG_WARNING("BranchAndBound") << "Nós abertos da execução anterior ignorados: a busca recomeça da raiz.";
+        return;
+    }
+    control.seeded = true;
+    control.roots.reserve(start.open_nodes.size());
+    for (const OpenNode& open_node : start.open_nodes) {
+        OpenNode seed{{}, control.objective_sign * open_node.bound};
+        bool excluded = false;
+        for (const auto& [col, value] : open_node.fixings) {
+            if (col < 0 || col >= original_cols || (value != 0 && value != 1)) {
+                throw std::invalid_argument("WarmStart: fixação inválida x" + std::to_string(col + 1) + " = " +
+                                            std::to_string(value) + ".");
+            }
+            if (reduced_index[col] >= 0) {
+                seed.fixings.emplace_back(reduced_index[col], value);
+            } else if (fixed_value[col] != value) {
+                // O presolve só fixa colunas quando existe ótimo com o valor dele; as soluções do nó com o
+                // valor oposto têm equivalentes tão boas em outro nó aberto ou em uma região já podada
+                excluded = true;
+                break;
+            }
+        }
+        if (!excluded) {
+            control.roots.push_back(std::move(seed));
+        }
+    }
+    BB_LOG_INFO("BranchAndBound") << "Retomando a busca a partir de " << control.roots.size()
+                                   << " nós abertos da execução anterior.";
+}
+
+// Resolve o problema usando o algoritmo Branch and Bound
+SolveStatus BranchAndBound::solveFrom(
+    GLPProbPtr original_problem,
+    std::vector<int>& solution,
+    double& objective_value,
+    std::unique_ptr<NodeSelector> selector,
+    const WarmStart& start) {
+    last_run_ = WarmStart{};
     if (!original_problem) {
-        std::cerr << "[BranchAndBound][ERRO] Problema GLPK nulo fornecido para resolução." << std::endl;
+        BB_LOG_ERROR("BranchAndBound") << "Problema GLPK nulo fornecido para resolução.";
+        return SolveStatus::ERROR;
+    }
+    if (!selector) {
+        BB_LOG_ERROR("BranchAndBound") << "Estratégia de seleção de nós nula.";
         return SolveStatus::ERROR;
     }
 
-    std::cout << "[BranchAndBound][INFO] Iniciando o algoritmo Branch and Bound." << std::endl;
+    BB_LOG_INFO("BranchAndBound") << "Iniciando o algoritmo Branch and Bound.";
+    stats_ = SolveStats{};
+    const PhaseTimer timer(stats_.seconds);
     best_objective_ = -std::numeric_limits<double>::infinity();
     best_solution_.clear();
 
-    // Estruturas para BFS (fila) e DFS (pilha)
-    std::queue<Node> node_queue;
-    std::stack<Node> node_stack;
-
-    // Cria o solver inicial
-    auto initial_solver = std::make_unique<GLPKSolver>(std::move(original_problem));
-    Node root_node(std::move(initial_solver), 
-                 {}, // nenhuma variável fixa
-                 std::numeric_limits<double>::infinity(),  
-                 NodeType::ROOT);
-
-    // Adiciona o nó raiz à fila ou pilha
-    if (use_depth_first) {
-        std::cout << "[BranchAndBound][INFO] Usando busca em profundidade." << std::endl;
-        node_stack.push(std::move(root_node));
-    } else {
-        std::cout << "[BranchAndBound][INFO] Usando busca em largura." << std::endl;
-        node_queue.push(std::move(root_node));
+    // A busca sempre maximiza: minimização é resolvida com o objetivo negado e o sinal volta no fim
+    const double objective_sign = glp_get_obj_dir(original_problem.get()) == GLP_MIN ? -1.0 : 1.0;
+    if (objective_sign < 0.0) {
+        for (int j = 0; j <= glp_get_num_cols(original_problem.get()); ++j) {
+            glp_set_obj_coef(original_problem.get(), j, -glp_get_obj_coef(original_problem.get(), j));
+        }
+        glp_set_obj_dir(original_problem.get(), GLP_MAX);
     }
 
-    // Função que será usada para processar nós filhos
-    auto process_node = [&](Node&& node) {
-        if (use_depth_first) {
-            node_stack.push(std::move(node));
-        } else {
-            node_queue.push(std::move(node));
+    // Presolve: a busca ocorre no problema reduzido e o incumbente volta ao espaço original no fim
+    std::unique_ptr<ProblemModel> original_model;
+    Postsolve postsolve;
+    if (options_.presolve) {
+        Presolver presolver;
+        GLPProbPtr reduced;
+        {
+            const PhaseTimer presolve_timer(stats_.presolve_seconds);
+            reduced = presolver.run(original_problem.get(), postsolve);
         }
-    };
+        if (!reduced) {
+            BB_LOG_ERROR("BranchAndBound") << "Nenhuma solução viável encontrada.";
+            return SolveStatus::ERROR;
+        }
+        original_model = std::make_unique<ProblemModel>(ProblemModel::fromGlpk(original_problem.get()));
+        original_problem = std::move(reduced);
+        if (postsolve.reducedCols() == 0) {
+            // Todas as variáveis foram fixadas: não há árvore a explorar
+            best_solution_ = postsolve.restore({});
+            if (!original_model->isFeasible(best_solution_)) {
+                BB_LOG_ERROR("BranchAndBound") << "A solução reconstruída pelo postsolve viola o problema original.";
+                return SolveStatus::ERROR;
+            }
+            best_objective_ = objective_sign * original_model->objectiveValue(best_solution_);
+            BB_LOG_INFO("BranchAndBound") << "Melhor solução encontrada com valor objetivo "
+                                           << best_objective_ << ".";
+            stats_.best_bound = best_objective_;
+            stats_.gap = 0.0;
+            last_run_.solution = best_solution_;
+            last_run_.frontier_complete = true;
+            if (options_.on_incumbent) {
+                options_.on_incumbent(IncumbentUpdate{best_objective_, best_solution_, 0.0, 0});
+            }
+            solution = best_solution_;
+            objective_value = best_objective_;
+            return SolveStatus::OK;
+        }
+    }
+
+    // Guarda os coeficientes do objetivo para as estimativas dos filhos
+    const int total_cols = glp_get_num_cols(original_problem.get());
+    objective_coefs_.assign(total_cols, 0.0);
+    for (int j = 1; j <= total_cols; ++j) {
+        objective_coefs_[j - 1] = glp_get_obj_coef(original_problem.get(), j);
+    }
+
+    // Modelo em memória para a propagação das fixações e as heurísticas
+    model_ = std::make_unique<ProblemModel>(ProblemModel::fromGlpk(original_problem.get()));
+    propagator_ = std::make_unique<Propagator>(*model_);
+    heuristics_ = std::make_unique<PrimalHeuristics>(*model_, options_.heuristics);
+    symmetry_.reset();
+    if (options_.symmetry) {
+        ColumnSymmetry symmetry = ColumnSymmetry::detect(*model_);
+        if (!symmetry.empty()) {
+            BB_LOG_INFO("BranchAndBound") << "Simetria: " << symmetry.classes().size()
+                                           << " classes de colunas idênticas (" << symmetry.symmetricColumns()
+                                           << " colunas).";
+            symmetry_ = std::make_unique<ColumnSymmetry>(std::move(symmetry));
+        }
+    }
+    cut_separator_.reset();
+    cut_pool_.reset();
+    conflict_analyzer_.reset();
+    conflict_pool_.reset();
+    if (options_.conflicts.pool_size > 0) {
+        conflict_analyzer_ = std::make_unique<ConflictAnalyzer>(*model_);
+        conflict_pool_ = std::make_unique<ConflictPool>(model_->numCols(), options_.conflicts);
+    }
+    if (options_.cuts.root_rounds > 0 || options_.cuts.tree_frequency > 0) {
+        cut_separator_ = std::make_unique<CutSeparator>(*model_, options_.cuts);
+        cut_pool_ = std::make_unique<CutPool>();
+    }
 
-    while (!(use_depth_first ? node_stack.empty() : node_queue.empty())) {
-        std::cout << "[BranchAndBound][INFO] Processando o próximo nó." << std::endl;
-        Node current_node = use_depth_first ? 
-            std::move(node_stack.top()) : 
-            std::move(node_queue.front());
-    
-        if (use_depth_first) {
-            node_stack.pop();
+    lagrangian_.reset();
+    if (options_.lagrangian.enabled) {
+        const PhaseTimer lagrangian_timer(stats_.lagrangian_seconds);
+        lagrangian_ = LagrangianBound::create(*model_, options_.lagrangian);
+        if (lagrangian_) {
+            BB_LOG_INFO("BranchAndBound") << "Relaxação lagrangiana: linha " << lagrangian_->keptRow()
+                                           << " mantida, limite na raiz " << objective_sign * lagrangian_->rootBound()
+                                           << ".";
         } else {
-            node_queue.pop();
+            BB_LOG_WARNING("BranchAndBound") << "Relaxação lagrangiana ignorada: o problema não é uma mochila "
+                                             << "(ou é grande demais para os pesos densos).";
         }
+    }
 
-        // Adiciona restrições de variáveis fixas
-        addFixedConstraints(current_node.solver->getProblem(), current_node.fixed_vars);
+    // Nenhum nó da execução anterior sobrevive a ela: a arena pode ser substituída
+    fixing_arena_ = std::make_unique<FixingArena>();
 
-        // Resolve a relaxação linear
-        std::cout << "[BranchAndBound][INFO] Resolvendo a relaxação linear." << std::endl;
-        const int num_cols = glp_get_num_cols(current_node.solver->getProblem());
-        std::vector<double> relaxed_solution(num_cols);
-        double current_objective;
-        
-        // Resolve o problema
-        SolveStatus solve_status = current_node.solver->solve(relaxed_solution, current_objective);
-
-        // Verifica se o nó é viável e se o limite é promissor
-        if (solve_status != SolveStatus::OK || current_objective <= best_objective_) {
-            std::cout << "[BranchAndBound][DEBUG] Nó podado devido a limite não promissor." << std::endl;
-            continue; // Poda o nó
-        }
-
-        // Verifica se a solução é inteira
-        int fractional_var;
-        SolveStatus integer_status = solutionIsInteger(relaxed_solution, fractional_var);
-
-        if (integer_status == SolveStatus::OK) {
-            std::cout << "[BranchAndBound][INFO] Solução inteira encontrada com valor objetivo " 
-                      << current_objective << "." << std::endl;
-            std::vector<int> candidate_solution(relaxed_solution.size());
-            std::transform(
-                relaxed_solution.begin(), relaxed_solution.end(),
-                candidate_solution.begin(),
-                [](double val) { return static_cast<int>(std::round(val)); }
-            ); // Apenas arredondando a solução de double para int
-            
-            if (isSolutionFeasible(current_node.solver->getProblem(), candidate_solution)) {
-                if (current_objective > best_objective_) {
-                    std::cout << "[BranchAndBound][INFO] Atualizando a melhor solução encontrada." << std::endl;
-                    best_objective_ = current_objective;
-                    best_solution_ = candidate_solution;
-                }
+    // As bases recicladas servem a todas as execuções (a tabela de relaxações guarda bases do pool)
+    if (!basis_pool_) {
+        basis_pool_ = std::make_unique<BasisPool>();
+    }
+
+    // A tabela de relaxações continua da execução anterior, se o modelo permitir
+    if (options_.lp_cache_bytes == 0) {
+        lp_cache_.reset();
+    } else {
+        if (!lp_cache_ || lp_cache_->memoryLimit() != options_.lp_cache_bytes) {
+            lp_cache_ = std::make_unique<LpCache>(options_.lp_cache_bytes);
+        }
+        std::vector<int> original_columns(static_cast<size_t>(model_->numCols()));
+        for (int k = 0; k < model_->numCols(); ++k) {
+            original_columns[k] = original_model ? postsolve.originalIndex(k) : k;
+        }
+        lp_cache_->prepare(*model_, original_columns);
+    }
+
+    // Pseudo-custos e regra de ramificação valem para esta execução
+    pseudo_costs_ = std::make_unique<PseudoCosts>(total_cols);
+    branching_rule_ = makeBranchingRule(options_.branching, *pseudo_costs_,
+                                        options_.reliability_threshold,
+                                        options_.strong_branching_candidates,
+                                        options_.strong_branching_iterations);
+    BB_LOG_INFO("BranchAndBound") << "Regra de ramificação: " << branching_rule_->name() << ".";
+
+    int num_threads = options_.num_threads;
+    if (num_threads <= 0) {
+        num_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // Orçamento de memória para os nós abertos (apenas na busca sequencial)
+    MemoryBoundedSelector* bounded_selector = nullptr;
+    if (options_.node_memory_limit > 0 && num_threads == 1) {
+        const std::size_t problem_bytes = MemoryBoundedSelector::estimateProblemBytes(
+            glp_get_num_rows(original_problem.get()), total_cols, glp_get_num_nz(original_problem.get()));
+        auto bounded = std::make_unique<MemoryBoundedSelector>(std::move(selector), options_.node_memory_limit,
+                                                               problem_bytes, options_.spill_directory);
+        bounded_selector = bounded.get();
+        selector = std::move(bounded);
+        BB_LOG_INFO("BranchAndBound") << "Orçamento de memória dos nós abertos: " << options_.node_memory_limit
+                                       << " bytes (cópia do problema ~" << problem_bytes << " bytes).";
+    }
+
+    SearchControl control;
+    control.start = std::chrono::steady_clock::now();
+    control.objective_sign = objective_sign;
+    control.progress_interval = options_.progress_interval;
+    control.next_progress.store((control.start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(std::max(0.0, options_.progress_interval)))).time_since_epoch().count());
+    control.node_limit = options_.node_limit;
+    if (options_.time_limit > 0.0) {
+        control.has_deadline = true;
+        control.deadline = timer.start() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(options_.time_limit));
+    }
+
+    // Notificação das melhoras no espaço original: sinal do objetivo e postsolve aplicados aqui
+    Incumbent incumbent;
+    if (options_.on_incumbent) {
+        incumbent.setListener([&](double value, const std::vector<int>& reduced_solution) {
+            const std::vector<int> original = original_model ? postsolve.restore(reduced_solution) : reduced_solution;
+            const double seconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - control.start).count();
+            options_.on_incumbent(IncumbentUpdate{objective_sign * value, original, seconds,
+                                                  control.nodes.load(std::memory_order_relaxed)});
+        });
+    }
+    if (!start.solution.empty() || start.frontier_complete) {
+        seedWarmStart(start, original_model ? &postsolve : nullptr, incumbent, control);
+    }
+    long long lp_iterations = 0;
+    bool engine_completed = true;
+    {
+        const PhaseTimer search_timer(stats_.search_seconds);
+        if (!control.seeded && solveWithoutLp(incumbent, control, engine_completed)) {
+            stats_.nodes = control.nodes.load();
+        } else if (num_threads > 1) {
+            searchParallel(std::move(original_problem), num_threads, incumbent, control, lp_iterations);
+        } else {
+            searchSequential(std::move(original_problem), *selector, incumbent, control, lp_iterations);
+        }
+    }
+    stats_.lp_iterations = lp_iterations;
+    if (bounded_selector) {
+        stats_.nodes_compacted = bounded_selector->compactedNodes();
+        stats_.nodes_spilled = bounded_selector->spilledNodes();
+        stats_.peak_open_bytes = static_cast<long long>(bounded_selector->peakBytes());
+    }
+    const bool limit_reached = control.limit_reached.load();
+
+    // Fronteira para uma resolução seguinte, no espaço original (os algoritmos sem LP não deixam nós)
+    last_run_.frontier_complete = engine_completed;
+    last_run_.open_nodes.reserve(control.frontier.size());
+    for (OpenNode& open_node : control.frontier) {
+        if (original_model) {
+            for (auto& fixing : open_node.fixings) {
+                fixing.first = postsolve.originalIndex(fixing.first);
             }
-            continue;
-        } else if (integer_status == SolveStatus::FRACTIONAL) {
-            std::cout << "[BranchAndBound][INFO] Solução fracionária encontrada. Criando nós filhos." << std::endl;
-            createChildNodes(std::move(current_node), fractional_var, process_node);
         }
+        open_node.bound *= objective_sign;
+        last_run_.open_nodes.push_back(std::move(open_node));
+    }
+
+    // Melhor limite: o maior entre os nós que ficaram abertos (só com limite atingido), os fechados
+    // apenas pela tolerância de gap e o incumbente
+    const double internal_bound = std::max(control.open_bound, incumbent.value());
+    stats_.best_bound = objective_sign * internal_bound;
+    stats_.gap = relativeGap(incumbent.value(), internal_bound);
+    logStats();
+    if (limit_reached) {
+        BB_LOG_WARNING("BranchAndBound") << "Limite de tempo ou de nós atingido após " << stats_.nodes
+                                         << " nós; a árvore não foi esgotada (gap " << stats_.gap << ").";
+    }
+
+    heuristics_->logStats();
+    if (cut_pool_) {
+        BB_LOG_INFO("BranchAndBound") << "Cortes no pool: " << cut_pool_->size() << ".";
     }
 
-    if (best_solution_.empty()) {
-        std::cerr << "[BranchAndBound][ERRO] Nenhuma solução viável encontrada." << std::endl;
+    if (!incumbent.hasSolution()) {
+        if (limit_reached) {
+            return SolveStatus::LIMIT_REACHED;
+        }
+        BB_LOG_ERROR("BranchAndBound") << "Nenhuma solução viável encontrada.";
         return SolveStatus::ERROR;
     }
 
-    std::cout << "[BranchAndBound][INFO] Melhor solução encontrada com valor objetivo " 
-              << best_objective_ << "." << std::endl;
+    best_objective_ = objective_sign * incumbent.value();
+    best_solution_ = incumbent.solution();
+    if (original_model) {
+        best_solution_ = postsolve.restore(best_solution_);
+        if (!original_model->isFeasible(best_solution_)) {
+            BB_LOG_ERROR("BranchAndBound") << "A solução reconstruída pelo postsolve viola o problema original.";
+            return SolveStatus::ERROR;
+        }
+        best_objective_ = objective_sign * original_model->objectiveValue(best_solution_);
+    }
+    last_run_.solution = best_solution_;
+    BB_LOG_INFO("BranchAndBound") << "Melhor solução encontrada com valor objetivo " 
+                                   << best_objective_ << ".";
     solution = best_solution_;
     objective_value = best_objective_;
-    return SolveStatus::OK;
-}
\ No newline at end of file
+    return limit_reached ? SolveStatus::FEASIBLE : SolveStatus::OK;
+}
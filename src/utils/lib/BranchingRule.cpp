@@ -0,0 +1,199 @@
+#include "BranchingRule.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include "Logger.h"
+
+namespace {
+    constexpr double INTEGER_TOLERANCE = 1e-6;
+    constexpr double MIN_SCORE_FACTOR = 1e-6;
+
+    // Degradação atribuída a um lado inviável no strong branching
+    constexpr double INFEASIBLE_DEGRADATION = 1e12;
+
+    bool isFractional(double value) {
+        const double frac = value - std::floor(value);
+        return frac > INTEGER_TOLERANCE && frac < 1.0 - INTEGER_TOLERANCE;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Pseudo-custos
+// ---------------------------------------------------------------------------
+PseudoCosts::PseudoCosts(int num_vars)
+    : total_sum_{0.0, 0.0},
+      total_count_{0, 0} {
+    for (int side = 0; side < 2; ++side) {
+        sum_[side].assign(static_cast<size_t>(num_vars), 0.0);
+        count_[side].assign(static_cast<size_t>(num_vars), 0);
+    }
+}
+
+void PseudoCosts::update(int var, int value, double distance, double degradation) {
+    if (distance <= INTEGER_TOLERANCE) {
+        return;
+    }
+    const int side = value == 0 ? 0 : 1;
+    const double unit = std::max(0.0, degradation) / distance;
+    std::lock_guard<std::mutex> lock(mutex_);
+    sum_[side][var] += unit;
+    ++count_[side][var];
+    total_sum_[side] += unit;
+    ++total_count_[side];
+}
+
+double PseudoCosts::unitCost(int var, int value) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return unitCostLocked(var, value);
+}
+
+double PseudoCosts::unitCostLocked(int var, int value) const {
+    const int side = value == 0 ? 0 : 1;
+    if (count_[side][var] > 0) {
+        return sum_[side][var] / count_[side][var];
+    }
+    if (total_count_[side] > 0) {
+        return total_sum_[side] / total_count_[side];
+    }
+    return 1.0;
+}
+
+int PseudoCosts::observations(int var, int value) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return count_[value == 0 ? 0 : 1][var];
+}
+
+int PseudoCosts::reliability(int var) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::min(count_[0][var], count_[1][var]);
+}
+
+double PseudoCosts::score(int var, double fractional_value) const {
+    const double frac = fractional_value - std::floor(fractional_value);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const double down = unitCostLocked(var, 0) * frac;
+    const double up = unitCostLocked(var, 1) * (1.0 - frac);
+    return std::max(down, MIN_SCORE_FACTOR) * std::max(up, MIN_SCORE_FACTOR);
+}
+
+// ---------------------------------------------------------------------------
+// Mais fracionária
+// ---------------------------------------------------------------------------
+int MostFractionalRule::select(const BranchingContext& context) const {
+    int fractional_var = -1;
+    double min_dist = 0.5;
+    for (size_t i = 0; i < context.solution.size(); ++i) {
+        const double value = context.solution[i];
+        const double dist = std::abs(value - 0.5);
+        if (dist < min_dist && isFractional(value)) {
+            min_dist = dist;
+            fractional_var = static_cast<int>(i);
+        }
+    }
+    return fractional_var;
+}
+
+// ---------------------------------------------------------------------------
+// Pseudo-custos
+// ---------------------------------------------------------------------------
+PseudoCostRule::PseudoCostRule(const PseudoCosts& pseudo_costs)
+    : pseudo_costs_(pseudo_costs) {}
+
+int PseudoCostRule::select(const BranchingContext& context) const {
+    int best_var = -1;
+    double best_score = -1.0;
+    for (size_t i = 0; i < context.solution.size(); ++i) {
+        if (!isFractional(context.solution[i])) {
+            continue;
+        }
+        const double score = pseudo_costs_.score(static_cast<int>(i), context.solution[i]);
+        if (score > best_score) {
+            best_score = score;
+            best_var = static_cast<int>(i);
+        }
+    }
+    return best_var;
+}
+
+// ---------------------------------------------------------------------------
+// Confiabilidade
+// ---------------------------------------------------------------------------
+ReliabilityRule::ReliabilityRule(
+    PseudoCosts& pseudo_costs,
+    int reliability_threshold,
+    int max_candidates,
+    int iteration_limit)
+    : pseudo_costs_(pseudo_costs),
+      reliability_threshold_(reliability_threshold),
+      max_candidates_(max_candidates),
+      iteration_limit_(iteration_limit) {}
+
+int ReliabilityRule::select(const BranchingContext& context) const {
+    // Candidatas ordenadas pela pontuação dos pseudo-custos
+    std::vector<std::pair<double, int>> candidates;
+    for (size_t i = 0; i < context.solution.size(); ++i) {
+        if (isFractional(context.solution[i])) {
+            const int var = static_cast<int>(i);
+            candidates.emplace_back(pseudo_costs_.score(var, context.solution[i]), var);
+        }
+    }
+    if (candidates.empty()) {
+        return -1;
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    int best_var = candidates.front().second;
+    double best_score = -1.0;
+    int strong_branchings = 0;
+    for (const auto& [pc_score, var] : candidates) {
+        double score = pc_score;
+        if (pseudo_costs_.reliability(var) < reliability_threshold_ && strong_branchings < max_candidates_) {
+            // Pseudo-custo ainda não confiável: mede as duas direções com poucas iterações do dual simplex
+            ++strong_branchings;
+            const double value = context.solution[var];
+            const double frac = value - std::floor(value);
+            double degradation[2];
+            for (int side = 0; side < 2; ++side) {
+                double child_objective = 0.0;
+                const SolveStatus status = context.solver.probeFixing(var, side, iteration_limit_, child_objective);
+                context.lp_iterations += context.solver.lastIterationCount();
+                if (status == SolveStatus::OK) {
+                    degradation[side] = std::max(0.0, context.objective - child_objective);
+                    pseudo_costs_.update(var, side, side == 0 ? frac : 1.0 - frac, degradation[side]);
+                } else if (status == SolveStatus::INFEASIBLE) {
+                    degradation[side] = INFEASIBLE_DEGRADATION;
+                } else {
+                    degradation[side] = (side == 0 ? frac : 1.0 - frac) * pseudo_costs_.unitCost(var, side);
+                }
+            }
+            score = std::max(degradation[0], MIN_SCORE_FACTOR) * std::max(degradation[1], MIN_SCORE_FACTOR);
+            BB_LOG_TRACE("BranchingRule") << "Strong branching x" << var + 1 << ": degradações "
+                                          << degradation[0] << " / " << degradation[1] << ".";
+        }
+        if (score > best_score) {
+            best_score = score;
+            best_var = var;
+        }
+    }
+    return best_var;
+}
+
+std::unique_ptr<BranchingRule> makeBranchingRule(
+    BranchingStrategy strategy,
+    PseudoCosts& pseudo_costs,
+    int reliability_threshold,
+    int max_candidates,
+    int iteration_limit) {
+    switch (strategy) {
+        case BranchingStrategy::MOST_FRACTIONAL:
+            return std::make_unique<MostFractionalRule>();
+        case BranchingStrategy::PSEUDO_COST:
+            return std::make_unique<PseudoCostRule>(pseudo_costs);
+        case BranchingStrategy::RELIABILITY:
+            return std::make_unique<ReliabilityRule>(pseudo_costs, reliability_threshold,
+                                                     max_candidates, iteration_limit);
+    }
+    throw std::invalid_argument("Regra de ramificação desconhecida");
+}
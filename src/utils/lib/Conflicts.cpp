@@ -0,0 +1,236 @@
+#include "Conflicts.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace {
+    constexpr double FEASIBILITY_TOLERANCE = 1e-6;
+    constexpr std::int8_t FREE = -1;
+}
+
+ConflictAnalyzer::ConflictAnalyzer(const ProblemModel& model)
+    : model_(model) {}
+
+bool ConflictAnalyzer::explainRow(int row, const std::vector<std::pair<int, int>>& fixed_vars,
+                                  Conflict& conflict) const {
+    std::vector<std::int8_t> value(static_cast<size_t>(model_.numCols()), FREE);
+    for (const auto& [var, fixed_value] : fixed_vars) {
+        value[var] = static_cast<std::int8_t>(fixed_value);
+    }
+
+    // Atividades mínima e máxima sem fixações e quanto cada fixação da linha as desloca
+    double min_activity = 0.0;
+    double max_activity = 0.0;
+    std::vector<std::pair<double, int>> raises; // Aumento da atividade mínima, elemento da linha
+    std::vector<std::pair<double, int>> drops;  // Redução da atividade máxima, elemento da linha
+    for (int k = model_.rowStart(row); k < model_.rowEnd(row); ++k) {
+        const double a = model_.rowValue(k);
+        min_activity += std::min(0.0, a);
+        max_activity += std::max(0.0, a);
+        const std::int8_t v = value[model_.rowCol(k)];
+        if (v == FREE) {
+            continue;
+        }
+        if ((a > 0.0) == (v == 1)) {
+            raises.emplace_back(std::abs(a), k);
+        } else {
+            drops.emplace_back(std::abs(a), k);
+        }
+    }
+
+    const bool upper_side = model_.rowUpper(row) < std::numeric_limits<double>::infinity();
+    auto greedy = [&](std::vector<std::pair<double, int>>& deltas, auto violated) {
+        std::sort(deltas.begin(), deltas.end(), std::greater<>());
+        double shift = 0.0;
+        conflict.fixings.clear();
+        for (const auto& [delta, k] : deltas) {
+            shift += delta;
+            const int var = model_.rowCol(k);
+            conflict.fixings.emplace_back(var, value[var]);
+            if (violated(shift)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    conflict.bound = -std::numeric_limits<double>::infinity();
+    if (upper_side && greedy(raises, [&](double shift) {
+            return min_activity + shift > model_.rowUpper(row) + FEASIBILITY_TOLERANCE;
+        })) {
+        return true;
+    }
+    return greedy(drops, [&](double shift) {
+        return max_activity - shift < model_.rowLower(row) - FEASIBILITY_TOLERANCE;
+    });
+}
+
+Conflict ConflictAnalyzer::explainBound(
+    const std::vector<std::pair<int, int>>& fixed_vars,
+    const std::vector<double>& reduced_costs,
+    double lp_objective,
+    double cutoff) {
+    // Ganho de liberar cada fixação, em ordem crescente
+    std::vector<std::pair<double, std::pair<int, int>>> gains;
+    gains.reserve(fixed_vars.size());
+    for (const auto& fixing : fixed_vars) {
+        const double d = reduced_costs[fixing.first];
+        gains.emplace_back(fixing.second == 0 ? std::max(0.0, d) : std::max(0.0, -d), fixing);
+    }
+    std::sort(gains.begin(), gains.end());
+
+    Conflict conflict;
+    conflict.bound = lp_objective;
+    size_t k = 0;
+    while (k < gains.size() && conflict.bound + gains[k].first <= cutoff) {
+        conflict.bound += gains[k].first;
+        ++k;
+    }
+    for (; k < gains.size(); ++k) {
+        conflict.fixings.push_back(gains[k].second);
+    }
+    return conflict;
+}
+
+ConflictPool::ConflictPool(int num_cols, const ConflictParams& params)
+    : num_cols_(num_cols), params_(params), occurrences_(2 * static_cast<size_t>(std::max(0, num_cols))) {}
+
+bool ConflictPool::add(Conflict conflict) {
+    if (params_.pool_size <= 0 || static_cast<int>(conflict.fixings.size()) > params_.max_size) {
+        return false;
+    }
+    std::sort(conflict.fixings.begin(), conflict.fixings.end());
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    int id;
+    if (entries_.size() < static_cast<size_t>(params_.pool_size)) {
+        id = static_cast<int>(entries_.size());
+        entries_.push_back(std::move(conflict));
+    } else {
+        id = static_cast<int>(next_);
+        unindex(id);
+        entries_[next_] = std::move(conflict);
+        next_ = (next_ + 1) % entries_.size();
+    }
+    index(id);
+    return true;
+}
+
+void ConflictPool::index(int id) {
+    const std::vector<std::pair<int, int>>& fixings = entries_[id].fixings;
+    if (fixings.size() <= 1) {
+        short_.push_back(id);
+        return;
+    }
+    for (const auto& [var, value] : fixings) {
+        occurrences_[2 * static_cast<size_t>(var) + value].push_back(id);
+    }
+}
+
+void ConflictPool::unindex(int id) {
+    const auto erase = [id](std::vector<int>& ids) {
+        const auto it = std::find(ids.begin(), ids.end(), id);
+        *it = ids.back();
+        ids.pop_back();
+    };
+    const std::vector<std::pair<int, int>>& fixings = entries_[id].fixings;
+    if (fixings.size() <= 1) {
+        erase(short_);
+        return;
+    }
+    for (const auto& [var, value] : fixings) {
+        erase(occurrences_[2 * static_cast<size_t>(var) + value]);
+    }
+}
+
+ConflictCheck ConflictPool::check(std::vector<std::pair<int, int>>& fixed_vars, double cutoff) const {
+    ConflictWorkspace workspace;
+    return check(fixed_vars, cutoff, workspace);
+}
+
+ConflictCheck ConflictPool::check(std::vector<std::pair<int, int>>& fixed_vars, double cutoff,
+                                  ConflictWorkspace& workspace) const {
+    ConflictCheck result;
+    std::vector<std::int8_t>& value = workspace.value;
+    std::vector<int>& matched = workspace.matched;
+    std::vector<int>& touched = workspace.touched;
+    if (value.size() != static_cast<size_t>(num_cols_)) {
+        value.assign(static_cast<size_t>(num_cols_), FREE);
+    }
+    if (matched.size() < static_cast<size_t>(std::max(0, params_.pool_size))) {
+        matched.resize(static_cast<size_t>(params_.pool_size), 0);
+    }
+    touched.clear();
+    for (const auto& [var, fixed_value] : fixed_vars) {
+        value[var] = static_cast<std::int8_t>(fixed_value);
+    }
+
+    // Poda o nó ou fixa a única variável livre do nogood, se todas as outras fixações estão no nó
+    const auto examine = [&](const Conflict& conflict) {
+        if (conflict.bound > cutoff) {
+            return;
+        }
+        int missing_var = -1;
+        int missing_value = 0;
+        int missing = 0;
+        for (const auto& [var, fixed_value] : conflict.fixings) {
+            if (value[var] == FREE) {
+                missing_var = var;
+                missing_value = fixed_value;
+                if (++missing > 1) {
+                    return;
+                }
+            } else if (value[var] != fixed_value) {
+                return; // Alguma fixação do nogood tem o valor oposto no nó
+            }
+        }
+        if (missing == 0) {
+            result.pruned = true;
+            result.bound = conflict.bound;
+            return;
+        }
+        result.bound = std::max(result.bound, conflict.bound);
+        value[missing_var] = static_cast<std::int8_t>(1 - missing_value);
+        fixed_vars.emplace_back(missing_var, 1 - missing_value);
+        ++result.implied;
+    };
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const int id : short_) {
+        examine(entries_[id]);
+        if (result.pruned) {
+            break;
+        }
+    }
+    // As fixações implicadas entram no fim de fixed_vars e também são percorridas
+    for (std::size_t k = 0; k < fixed_vars.size() && !result.pruned; ++k) {
+        const auto [var, fixed_value] = fixed_vars[k];
+        for (const int id : occurrences_[2 * static_cast<size_t>(var) + fixed_value]) {
+            if (matched[id]++ == 0) {
+                touched.push_back(id);
+            }
+            const Conflict& conflict = entries_[id];
+            if (matched[id] + 1 >= static_cast<int>(conflict.fixings.size())) {
+                examine(conflict);
+                if (result.pruned) {
+                    break;
+                }
+            }
+        }
+    }
+    lock.unlock();
+
+    // O workspace volta a ter todas as colunas livres e nenhum nogood marcado
+    for (const auto& fixing : fixed_vars) {
+        value[fixing.first] = FREE;
+    }
+    for (const int id : touched) {
+        matched[id] = 0;
+    }
+    return result;
+}
+
+std::size_t ConflictPool::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return entries_.size();
+}
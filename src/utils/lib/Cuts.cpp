@@ -0,0 +1,422 @@
+#include "Cuts.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <string>
+#include "SimdKernels.h"
+
+namespace {
+    constexpr double FEASIBILITY_TOLERANCE = 1e-6;
+    constexpr double INTEGER_TOLERANCE = 1e-6;
+
+    // A matriz de conflitos usa n^2 bits; acima deste número de variáveis os cliques são desativados
+    constexpr int MAX_CONFLICT_VARS = 4096;
+
+    // Sementes avaliadas por rodada na separação de cliques
+    constexpr int MAX_CLIQUE_SEEDS = 100;
+
+    // Prefixo do nome das linhas de corte no GLPK
+    constexpr const char* CUT_ROW_PREFIX = "bbcut";
+
+    bool isFractional(double value) {
+        return value > INTEGER_TOLERANCE && value < 1.0 - INTEGER_TOLERANCE;
+    }
+
+    // Ordena os termos pelo índice da variável, para comparar e identificar duplicatas
+    void normalize(Cut& cut) {
+        std::vector<std::pair<int, double>> terms(cut.vars.size());
+        for (size_t k = 0; k < cut.vars.size(); ++k) {
+            terms[k] = {cut.vars[k], cut.coefs[k]};
+        }
+        std::sort(terms.begin(), terms.end());
+        for (size_t k = 0; k < terms.size(); ++k) {
+            cut.vars[k] = terms[k].first;
+            cut.coefs[k] = terms[k].second;
+        }
+    }
+
+    // FNV-1a sobre os índices e os coeficientes arredondados
+    std::uint64_t hashCut(const Cut& cut) {
+        std::uint64_t hash = 1469598103934665603ULL;
+        auto mix = [&hash](std::uint64_t value) {
+            hash ^= value;
+            hash *= 1099511628211ULL;
+        };
+        for (size_t k = 0; k < cut.vars.size(); ++k) {
+            mix(static_cast<std::uint64_t>(cut.vars[k]));
+            mix(static_cast<std::uint64_t>(std::llround(cut.coefs[k] * 1e6)));
+        }
+        mix(static_cast<std::uint64_t>(std::llround(cut.rhs * 1e6)));
+        return hash;
+    }
+
+    bool sameCut(const Cut& a, const Cut& b) {
+        if (a.vars != b.vars || std::abs(a.rhs - b.rhs) > 1e-9) {
+            return false;
+        }
+        for (size_t k = 0; k < a.coefs.size(); ++k) {
+            if (std::abs(a.coefs[k] - b.coefs[k]) > 1e-9) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Corte
+// ---------------------------------------------------------------------------
+double Cut::violation(const std::vector<double>& solution) const {
+    const double lhs = simd::sparseDot(coefs.data(), vars.data(), static_cast<int>(vars.size()), solution.data());
+    return lhs - rhs;
+}
+
+double Cut::efficacy(const std::vector<double>& solution) const {
+    const double norm = simd::dot(coefs.data(), coefs.data(), static_cast<int>(coefs.size()));
+    return norm > 0.0 ? violation(solution) / std::sqrt(norm) : 0.0;
+}
+
+// ---------------------------------------------------------------------------
+// Separação
+// ---------------------------------------------------------------------------
+CutSeparator::CutSeparator(const ProblemModel& model, const CutParams& params)
+    : model_(model),
+      params_(params),
+      conflict_dim_(0) {
+    // Linhas mochila: todos os coeficientes positivos e limite superior finito
+    for (int i = 0; i < model.numRows(); ++i) {
+        const double upper = model.rowUpper(i);
+        if (!std::isfinite(upper) || upper < 0.0 || model.rowEnd(i) - model.rowStart(i) < 2) {
+            continue;
+        }
+        bool knapsack = true;
+        for (int k = model.rowStart(i); k < model.rowEnd(i) && knapsack; ++k) {
+            knapsack = model.rowValue(k) > 0.0;
+        }
+        if (knapsack) {
+            knapsack_rows_.push_back(i);
+        }
+    }
+
+    // Grafo de conflitos: x_i + x_j <= 1 sempre que a_i + a_j > b em alguma linha mochila
+    const int n = model.numCols();
+    if (!params_.clique_cuts || n > MAX_CONFLICT_VARS || knapsack_rows_.empty()) {
+        return;
+    }
+    const int words = (n + 63) / 64;
+    conflicts_.assign(static_cast<size_t>(n) * words, 0);
+    bool any_conflict = false;
+    std::vector<std::pair<double, int>> items;
+    for (int row : knapsack_rows_) {
+        items.clear();
+        for (int k = model.rowStart(row); k < model.rowEnd(row); ++k) {
+            items.emplace_back(model.rowValue(k), model.rowCol(k));
+        }
+        std::sort(items.begin(), items.end(), std::greater<>());
+        const double upper = model.rowUpper(row);
+        for (size_t p = 0; p < items.size(); ++p) {
+            // Itens em ordem decrescente: os conflitos de p formam um prefixo da lista
+            for (size_t q = 0; q < items.size() && items[p].first + items[q].first > upper + FEASIBILITY_TOLERANCE; ++q) {
+                if (p == q) {
+                    continue;
+                }
+                const int i = items[p].second;
+                const int j = items[q].second;
+                conflicts_[static_cast<size_t>(i) * words + j / 64] |= std::uint64_t{1} << (j % 64);
+                any_conflict = true;
+            }
+        }
+    }
+    if (any_conflict) {
+        conflict_dim_ = n;
+    } else {
+        conflicts_.clear();
+    }
+}
+
+bool CutSeparator::conflict(int i, int j) const {
+    if (conflict_dim_ == 0) {
+        return false;
+    }
+    const int words = (conflict_dim_ + 63) / 64;
+    return (conflicts_[static_cast<size_t>(i) * words + j / 64] >> (j % 64)) & 1;
+}
+
+std::vector<Cut> CutSeparator::separate(const std::vector<double>& solution) const {
+    std::vector<Cut> cuts;
+    if (params_.cover_cuts) {
+        for (int row : knapsack_rows_) {
+            Cut cut;
+            if (separateCover(row, solution, cut)) {
+                cuts.push_back(std::move(cut));
+            }
+        }
+    }
+    if (params_.clique_cuts && conflict_dim_ > 0) {
+        separateCliques(solution, cuts);
+    }
+
+    std::vector<double> efficacy(cuts.size());
+    std::vector<size_t> order(cuts.size());
+    for (size_t c = 0; c < cuts.size(); ++c) {
+        efficacy[c] = cuts[c].efficacy(solution);
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return efficacy[a] > efficacy[b]; });
+    std::vector<Cut> selected;
+    for (size_t c : order) {
+        if (static_cast<int>(selected.size()) >= params_.max_cuts_per_round) {
+            break;
+        }
+        selected.push_back(std::move(cuts[c]));
+    }
+    return selected;
+}
+
+bool CutSeparator::separateCover(int row, const std::vector<double>& solution, Cut& cut) const {
+    const double capacity = model_.rowUpper(row);
+    struct Item {
+        int var;
+        double weight;
+        double value;
+    };
+    std::vector<Item> items;
+    for (int k = model_.rowStart(row); k < model_.rowEnd(row); ++k) {
+        const int var = model_.rowCol(k);
+        items.push_back({var, model_.rowValue(k), solution[var]});
+    }
+
+    // Cobertura gulosa: minimiza sum(1 - x_j) dando preferência às variáveis de maior peso
+    std::vector<size_t> order;
+    for (size_t k = 0; k < items.size(); ++k) {
+        if (items[k].weight <= capacity + FEASIBILITY_TOLERANCE) {
+            order.push_back(k);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return (1.0 - items[a].value) / items[a].weight < (1.0 - items[b].value) / items[b].weight;
+    });
+    std::vector<size_t> cover;
+    double weight = 0.0;
+    for (size_t k : order) {
+        cover.push_back(k);
+        weight += items[k].weight;
+        if (weight > capacity + FEASIBILITY_TOLERANCE) {
+            break;
+        }
+    }
+    if (weight <= capacity + FEASIBILITY_TOLERANCE) {
+        return false;
+    }
+
+    // Torna a cobertura minimal retirando primeiro as variáveis de menor valor na relaxação
+    std::sort(cover.begin(), cover.end(), [&](size_t a, size_t b) {
+        if (items[a].value != items[b].value) {
+            return items[a].value < items[b].value;
+        }
+        return items[a].weight > items[b].weight;
+    });
+    std::vector<size_t> minimal;
+    for (size_t k : cover) {
+        if (weight - items[k].weight > capacity + FEASIBILITY_TOLERANCE) {
+            weight -= items[k].weight;
+        } else {
+            minimal.push_back(k);
+        }
+    }
+    if (minimal.size() < 2) {
+        return false;
+    }
+
+    // Lifting sequencial exato: min_weight[p] é o menor peso com sum(alpha) = p entre as variáveis já
+    // incluídas; o coeficiente de x_j é r - max{p : min_weight[p] <= b - a_j}.
+    const int r = static_cast<int>(minimal.size()) - 1;
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    std::vector<double> min_weight(static_cast<size_t>(r) + 1, INF);
+    min_weight[0] = 0.0;
+    auto include = [&](double item_weight, int alpha) {
+        for (int p = r; p >= alpha; --p) {
+            if (min_weight[p - alpha] + item_weight < min_weight[p]) {
+                min_weight[p] = min_weight[p - alpha] + item_weight;
+            }
+        }
+    };
+
+    std::vector<char> in_cover(items.size(), 0);
+    cut = Cut{CutType::COVER, {}, {}, static_cast<double>(r)};
+    for (size_t k : minimal) {
+        in_cover[k] = 1;
+        include(items[k].weight, 1);
+        cut.vars.push_back(items[k].var);
+        cut.coefs.push_back(1.0);
+    }
+
+    // Ordem de lifting: primeiro as variáveis positivas na relaxação, que afetam a violação
+    std::vector<size_t> lifting;
+    for (size_t k = 0; k < items.size(); ++k) {
+        if (!in_cover[k]) {
+            lifting.push_back(k);
+        }
+    }
+    std::sort(lifting.begin(), lifting.end(), [&](size_t a, size_t b) {
+        if (items[a].value != items[b].value) {
+            return items[a].value > items[b].value;
+        }
+        return items[a].weight > items[b].weight;
+    });
+    for (size_t k : lifting) {
+        const double residual = capacity - items[k].weight;
+        int alpha = r;
+        if (residual >= -FEASIBILITY_TOLERANCE) {
+            int best = 0;
+            for (int p = r; p >= 0; --p) {
+                if (min_weight[p] <= residual + FEASIBILITY_TOLERANCE) {
+                    best = p;
+                    break;
+                }
+            }
+            alpha = r - best;
+        }
+        if (alpha > 0) {
+            include(items[k].weight, alpha);
+            cut.vars.push_back(items[k].var);
+            cut.coefs.push_back(static_cast<double>(alpha));
+        }
+    }
+    return cut.violation(solution) > params_.min_violation;
+}
+
+void CutSeparator::separateCliques(const std::vector<double>& solution, std::vector<Cut>& cuts) const {
+    const int n = conflict_dim_;
+    const int words = (n + 63) / 64;
+    std::vector<int> positive;
+    std::vector<int> zero;
+    for (int j = 0; j < n; ++j) {
+        (solution[j] > INTEGER_TOLERANCE ? positive : zero).push_back(j);
+    }
+    std::stable_sort(positive.begin(), positive.end(),
+                     [&](int a, int b) { return solution[a] > solution[b]; });
+
+    std::set<std::vector<int>> seen;
+    std::vector<std::uint64_t> common(static_cast<size_t>(words));
+    int seeds = 0;
+    for (int seed : positive) {
+        if (!isFractional(solution[seed])) {
+            continue;
+        }
+        if (++seeds > MAX_CLIQUE_SEEDS) {
+            break;
+        }
+        // Clique guloso: cada nova variável deve conflitar com todas as já escolhidas
+        std::vector<int> clique{seed};
+        double sum = solution[seed];
+        std::copy_n(conflicts_.begin() + static_cast<std::ptrdiff_t>(seed) * words, words, common.begin());
+        auto extend = [&](const std::vector<int>& candidates) {
+            for (int v : candidates) {
+                if (v == seed || !((common[v / 64] >> (v % 64)) & 1)) {
+                    continue;
+                }
+                clique.push_back(v);
+                sum += solution[v];
+                const std::uint64_t* row = conflicts_.data() + static_cast<size_t>(v) * words;
+                for (int w = 0; w < words; ++w) {
+                    common[w] &= row[w];
+                }
+            }
+        };
+        extend(positive);
+        if (clique.size() < 2 || sum <= 1.0 + params_.min_violation) {
+            continue;
+        }
+        // Fortalece o corte com as variáveis nulas compatíveis com o clique
+        extend(zero);
+
+        std::sort(clique.begin(), clique.end());
+        if (!seen.insert(clique).second) {
+            continue;
+        }
+        Cut cut{CutType::CLIQUE, clique, std::vector<double>(clique.size(), 1.0), 1.0};
+        cuts.push_back(std::move(cut));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Pool
+// ---------------------------------------------------------------------------
+std::pair<int, bool> CutPool::add(Cut cut) {
+    normalize(cut);
+    const std::uint64_t hash = hashCut(cut);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto range = index_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (sameCut(entries_[it->second].cut, cut)) {
+            return {it->second, false};
+        }
+    }
+    const int id = static_cast<int>(entries_.size());
+    entries_.push_back({std::move(cut), 0});
+    index_.emplace(hash, id);
+    return {id, true};
+}
+
+std::size_t CutPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+Cut CutPool::get(int id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.at(static_cast<size_t>(id)).cut;
+}
+
+std::vector<int> CutPool::violated(
+    const std::vector<double>& solution,
+    double min_violation,
+    const std::vector<char>& skip) const {
+    std::vector<int> ids;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t id = 0; id < entries_.size(); ++id) {
+        if (id < skip.size() && skip[id]) {
+            continue;
+        }
+        if (entries_[id].cut.violation(solution) > min_violation) {
+            ids.push_back(static_cast<int>(id));
+        }
+    }
+    return ids;
+}
+
+int CutPool::age(int id, bool active) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_.at(static_cast<size_t>(id));
+    entry.age = active ? 0 : entry.age + 1;
+    return entry.age;
+}
+
+void CutPool::addToProblem(glp_prob* lp, int id, const Cut& cut) {
+    const int row = glp_add_rows(lp, 1);
+    const std::string name = CUT_ROW_PREFIX + std::to_string(id);
+    glp_set_row_name(lp, row, name.c_str());
+
+    // Vetores base 1, como o GLPK espera
+    std::vector<int> indices(cut.vars.size() + 1);
+    std::vector<double> values(cut.vars.size() + 1);
+    for (size_t k = 0; k < cut.vars.size(); ++k) {
+        indices[k + 1] = cut.vars[k] + 1;
+        values[k + 1] = cut.coefs[k];
+    }
+    glp_set_mat_row(lp, row, static_cast<int>(cut.vars.size()), indices.data(), values.data());
+    glp_set_row_bnds(lp, row, GLP_UP, 0.0, cut.rhs);
+}
+
+int CutPool::idOfRow(glp_prob* lp, int row) {
+    const char* name = glp_get_row_name(lp, row);
+    const size_t prefix_length = std::strlen(CUT_ROW_PREFIX);
+    if (!name || std::strncmp(name, CUT_ROW_PREFIX, prefix_length) != 0) {
+        return -1;
+    }
+    return std::atoi(name + prefix_length);
+}
@@ -0,0 +1,129 @@
+#include "FixingArena.h"
+#include <stdexcept>
+
+FixingChain::FixingChain(const FixingChain& other) noexcept
+    : tail_(other.tail_), arena_(other.arena_) {
+    if (tail_) {
+        tail_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+FixingChain::FixingChain(FixingChain&& other) noexcept
+    : tail_(other.tail_), arena_(other.arena_) {
+    other.tail_ = nullptr;
+    other.arena_ = nullptr;
+}
+
+FixingChain& FixingChain::operator=(const FixingChain& other) noexcept {
+    if (this != &other) {
+        FixingChain copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+FixingChain& FixingChain::operator=(FixingChain&& other) noexcept {
+    if (this != &other) {
+        if (tail_) {
+            arena_->release(tail_);
+        }
+        tail_ = other.tail_;
+        arena_ = other.arena_;
+        other.tail_ = nullptr;
+        other.arena_ = nullptr;
+    }
+    return *this;
+}
+
+FixingChain::~FixingChain() {
+    if (tail_) {
+        arena_->release(tail_);
+    }
+}
+
+void FixingChain::materialize(std::vector<std::pair<int, int>>& out) const {
+    out.resize(size());
+    std::size_t k = out.size();
+    for (const FixingLink* link = tail_; link; link = link->parent) {
+        out[--k] = {link->var, link->value};
+    }
+}
+
+std::vector<std::pair<int, int>> FixingChain::toVector() const {
+    std::vector<std::pair<int, int>> fixings;
+    materialize(fixings);
+    return fixings;
+}
+
+FixingChain FixingArena::extend(const FixingChain& base, int var, int value) {
+    if (base.arena_ && base.arena_ != this) {
+        throw std::invalid_argument("FixingArena: a cadeia base pertence a outra arena.");
+    }
+    FixingLink* link;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_) {
+            // Novo bloco encadeado na lista livre
+            blocks_.push_back(std::make_unique<FixingLink[]>(BLOCK_LINKS));
+            FixingLink* block = blocks_.back().get();
+            for (std::size_t k = 0; k + 1 < BLOCK_LINKS; ++k) {
+                block[k].parent = &block[k + 1];
+            }
+            block[BLOCK_LINKS - 1].parent = nullptr;
+            free_ = block;
+        }
+        link = free_;
+        free_ = link->parent;
+        ++live_;
+    }
+    link->parent = base.tail_;
+    link->var = var;
+    link->value = value;
+    link->length = static_cast<std::uint32_t>(base.size() + 1);
+    link->refs.store(1, std::memory_order_relaxed);
+    if (base.tail_) {
+        base.tail_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return FixingChain(link, this);
+}
+
+FixingChain FixingArena::make(const std::vector<std::pair<int, int>>& fixings) {
+    FixingChain chain;
+    for (const auto& [var, value] : fixings) {
+        chain = extend(chain, var, value);
+    }
+    return chain;
+}
+
+void FixingArena::release(FixingLink* link) noexcept {
+    // Os elos sem referências formam uma lista local, emendada na lista livre com uma única trava
+    FixingLink* head = nullptr;
+    FixingLink* last = nullptr;
+    std::size_t count = 0;
+    while (link && link->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        FixingLink* parent = link->parent;
+        link->parent = head;
+        head = link;
+        if (!last) {
+            last = link;
+        }
+        ++count;
+        link = parent;
+    }
+    if (head) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        last->parent = free_;
+        free_ = head;
+        live_ -= count;
+    }
+}
+
+std::size_t FixingArena::liveLinks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return live_;
+}
+
+std::size_t FixingArena::capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return blocks_.size() * BLOCK_LINKS;
+}
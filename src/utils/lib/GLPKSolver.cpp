@@ -1,7 +1,7 @@
 #include "GLPKSolver.h"
 #include <stdexcept>
 #include <string>
-#include <iostream> // Para logs
+#include "Logger.h"
 
 
 /// @brief Functor que será utilizado para deletar o problema GLPK.
@@ -9,7 +9,7 @@
 /// seja deletado corretamente quando o ponteiro único for destruído.
 void GLPKProbDeleter::operator()(glp_prob* ptr) const noexcept {
     if (ptr) {
-        std::cout << "[DEBUG] Deletando o problema GLPK." << std::endl;
+        BB_LOG_TRACE("GLPKSolver") << "Deletando o problema GLPK.";
         glp_delete_prob(ptr);
     }
 }
@@ -20,10 +20,10 @@ void GLPKProbDeleter::operator()(glp_prob* ptr) const noexcept {
 GLPKSolver::GLPKSolver(GLPProbPtr problem) 
     : problem_(std::move(problem)) { // Carrega o problema GLPK antes de qualquer outra operação
     if (!problem_) {
-        std::cerr << "[ERROR] Falha ao carregar a instância do problema GLPK: ponteiro nulo fornecido." << std::endl;
+        BB_LOG_ERROR("GLPKSolver") << "Falha ao carregar a instância do problema GLPK: ponteiro nulo fornecido.";
         throw std::runtime_error("Failed to load GLPK problem instance: null pointer provided");
     }
-    std::cout << "[INFO] Instância do problema GLPK carregada com sucesso." << std::endl;
+    BB_LOG_TRACE("GLPKSolver") << "Instância do problema GLPK carregada com sucesso.";
 }
 
 /// @brief Resolve o problema GLPK.
@@ -33,61 +33,182 @@ GLPKSolver::GLPKSolver(GLPProbPtr problem)
     /// @return O status da solução: OK, INFEASIBLE, UNBOUNDED, ERROR, FRACTIONAL
 SolveStatus GLPKSolver::solve(std::vector<double>& solution, double& objective_value) {
     if (!problem_) {
-        std::cerr << "[ERROR] A instância do problema GLPK é nula." << std::endl;
+        BB_LOG_ERROR("GLPKSolver") << "A instância do problema GLPK é nula.";
         throw std::runtime_error("GLPK problem instance is null");
     }
 
     // Verificando se o vetor de solução tem tamanho adequado
     const int num_cols = glp_get_num_cols(problem_.get());
-    std::cout << "[INFO] Número de colunas no problema: " << num_cols << std::endl;
+    BB_LOG_TRACE("GLPKSolver") << "Número de colunas no problema: " << num_cols;
     if (solution.size() < static_cast<size_t>(num_cols)) {
-        std::cout << "[DEBUG] Redimensionando o vetor de solução para " << num_cols << " elementos." << std::endl;
+        BB_LOG_TRACE("GLPKSolver") << "Redimensionando o vetor de solução para " << num_cols << " elementos.";
         solution.resize(num_cols);
     }
 
+    // A saída de terminal do GLPK passa pelo logger (nível DEBUG) em vez de ir direto para o stdout
+    Logger::captureGlpkOutput();
+
+    // Configura o simplex a partir dos parâmetros do solver
+    glp_smcp parm;
+    glp_init_smcp(&parm);
+    parm.meth = params_.method;
+    parm.presolve = params_.presolve ? GLP_ON : GLP_OFF;
+    parm.it_lim = params_.iteration_limit;
+    parm.tm_lim = params_.time_limit_ms;
+    parm.msg_lev = params_.message_level;
+
     // Resolver o problema
-    std::cout << "[INFO] Iniciando a resolução do problema com glp_simplex." << std::endl;
-    int ret = glp_simplex(problem_.get(), nullptr);
+    BB_LOG_TRACE("GLPKSolver") << "Iniciando a resolução do problema com glp_simplex.";
+    const int iterations_before = glp_get_it_cnt(problem_.get());
+    int ret = glp_simplex(problem_.get(), &parm);
+    if (ret == GLP_EBADB || ret == GLP_ESING || ret == GLP_ECOND) {
+        // Base restaurada inválida ou mal condicionada: recomeça de uma base avançada
+        BB_LOG_WARNING("GLPKSolver") << "Base inicial inválida (código " << ret << "), reconstruindo a base.";
+        glp_adv_basis(problem_.get(), 0);
+        ret = glp_simplex(problem_.get(), &parm);
+    }
+    last_iterations_ = glp_get_it_cnt(problem_.get()) - iterations_before;
+    if (ret == GLP_EITLIM || ret == GLP_ETMLIM) {
+        // Limite de SimplexParams: não é falha, mas a relaxação não tem limite válido
+        BB_LOG_DEBUG("GLPKSolver") << "Simplex interrompido pelo limite de "
+                                   << (ret == GLP_EITLIM ? "iterações" : "tempo") << ".";
+        return SolveStatus::LP_LIMIT;
+    }
     if (ret != 0) {
-        std::cerr << "[ERROR] Falha ao resolver o problema com glp_simplex. Código de retorno: " << ret << std::endl;
+        BB_LOG_ERROR("GLPKSolver") << "Falha ao resolver o problema com glp_simplex. Código de retorno: " << ret;
         return SolveStatus::ERROR;
     }
 
     // Verificar status da solução
     const int status = glp_get_status(problem_.get());
-    std::cout << "[INFO] Status da solução obtido: " << status << std::endl;
+    BB_LOG_TRACE("GLPKSolver") << "Status da solução obtido: " << status;
     switch (status) {
         case GLP_OPT:
-            std::cout << "[INFO] Solução ótima encontrada." << std::endl;
+            BB_LOG_TRACE("GLPKSolver") << "Solução ótima encontrada.";
             break;
         case GLP_INFEAS:
-            std::cerr << "[WARNING] O problema é inviável." << std::endl;
+            BB_LOG_DEBUG("GLPKSolver") << "O problema é inviável.";
             return SolveStatus::INFEASIBLE;
         case GLP_NOFEAS:
-            std::cerr << "[WARNING] Nenhuma solução viável encontrada." << std::endl;
+            BB_LOG_DEBUG("GLPKSolver") << "Nenhuma solução viável encontrada.";
             return SolveStatus::INFEASIBLE;
         case GLP_UNBND:
-            std::cerr << "[WARNING] O problema é ilimitado." << std::endl;
+            BB_LOG_DEBUG("GLPKSolver") << "O problema é ilimitado.";
             return SolveStatus::UNBOUNDED;
         default:
-            std::cerr << "[ERROR] Status desconhecido da solução: " << status << std::endl;
+            BB_LOG_ERROR("GLPKSolver") << "Status desconhecido da solução: " << status;
             return SolveStatus::ERROR;
     }
 
     // Obter a solução
     try {
-        std::cout << "[INFO] Extraindo a solução primária e o valor objetivo." << std::endl;
+        BB_LOG_TRACE("GLPKSolver") << "Extraindo a solução primária e o valor objetivo.";
         for (int i = 1; i <= num_cols; ++i) {
             solution[i - 1] = glp_get_col_prim(problem_.get(), i);
-            std::cout << "[DEBUG] Variável x" << i << " = " << solution[i - 1] << std::endl;
+            BB_LOG_TRACE("GLPKSolver") << "Variável x" << i << " = " << solution[i - 1];
         }
         objective_value = glp_get_obj_val(problem_.get());
-        std::cout << "[INFO] Valor objetivo: " << objective_value << std::endl;
+        BB_LOG_TRACE("GLPKSolver") << "Valor objetivo: " << objective_value;
     } catch (...) {
-        std::cerr << "[ERROR] Erro ao extrair a solução ou o valor objetivo." << std::endl;
+        BB_LOG_ERROR("GLPKSolver") << "Erro ao extrair a solução ou o valor objetivo.";
         return SolveStatus::ERROR;
     }
     
-    std::cout << "[INFO] Resolução concluída com sucesso." << std::endl;
+    BB_LOG_TRACE("GLPKSolver") << "Resolução concluída com sucesso.";
     return SolveStatus::OK;
-}
\ No newline at end of file
+}
+
+/// @brief Lê os custos reduzidos das colunas da última solução.
+void GLPKSolver::getReducedCosts(std::vector<double>& reduced_costs) const {
+    glp_prob* lp = problem_.get();
+    const int num_cols = glp_get_num_cols(lp);
+    reduced_costs.resize(static_cast<size_t>(num_cols));
+    for (int j = 1; j <= num_cols; ++j) {
+        reduced_costs[j - 1] = glp_get_col_dual(lp, j);
+    }
+}
+
+/// @brief Salva a base corrente (status de todas as linhas e colunas).
+LpBasis GLPKSolver::saveBasis() const {
+    LpBasis basis;
+    saveBasis(basis);
+    return basis;
+}
+
+/// @brief Salva a base corrente em basis, reaproveitando a capacidade dos seus vetores.
+void GLPKSolver::saveBasis(LpBasis& basis) const {
+    glp_prob* lp = problem_.get();
+    const int num_rows = glp_get_num_rows(lp);
+    const int num_cols = glp_get_num_cols(lp);
+    basis.row_stat.assign(num_rows + 1, 0);
+    basis.col_stat.assign(num_cols + 1, 0);
+    for (int i = 1; i <= num_rows; ++i) {
+        basis.row_stat[i] = glp_get_row_stat(lp, i);
+    }
+    for (int j = 1; j <= num_cols; ++j) {
+        basis.col_stat[j] = glp_get_col_stat(lp, j);
+    }
+}
+
+/// @brief Restaura uma base salva anteriormente.
+bool GLPKSolver::restoreBasis(const LpBasis& basis) {
+    glp_prob* lp = problem_.get();
+    const int num_rows = glp_get_num_rows(lp);
+    const int num_cols = glp_get_num_cols(lp);
+    if (basis.row_stat.size() != static_cast<size_t>(num_rows + 1) ||
+        basis.col_stat.size() != static_cast<size_t>(num_cols + 1)) {
+        return false;
+    }
+    // O GLPK ajusta sozinho status não básicos incompatíveis com o tipo da variável (ex.: NL em coluna fixa)
+    for (int i = 1; i <= num_rows; ++i) {
+        glp_set_row_stat(lp, i, basis.row_stat[i]);
+    }
+    for (int j = 1; j <= num_cols; ++j) {
+        glp_set_col_stat(lp, j, basis.col_stat[j]);
+    }
+    return true;
+}
+
+/// @brief Avalia tentativamente a fixação de uma variável (strong branching).
+SolveStatus GLPKSolver::probeFixing(int var, double value, int iteration_limit, double& objective) {
+    glp_prob* lp = problem_.get();
+    const int col = var + 1;
+    const int old_type = glp_get_col_type(lp, col);
+    const double old_lb = glp_get_col_lb(lp, col);
+    const double old_ub = glp_get_col_ub(lp, col);
+    const LpBasis basis = saveBasis();
+
+    Logger::captureGlpkOutput();
+    glp_smcp parm;
+    glp_init_smcp(&parm);
+    parm.meth = GLP_DUAL;
+    parm.presolve = GLP_OFF;
+    parm.it_lim = iteration_limit;
+    parm.tm_lim = params_.time_limit_ms;
+    parm.msg_lev = params_.message_level;
+
+    glp_set_col_bnds(lp, col, GLP_FX, value, value);
+    const int iterations_before = glp_get_it_cnt(lp);
+    const int ret = glp_simplex(lp, &parm);
+    last_iterations_ = glp_get_it_cnt(lp) - iterations_before;
+
+    SolveStatus status = SolveStatus::ERROR;
+    if (ret == 0 || ret == GLP_EITLIM || ret == GLP_ETMLIM) {
+        const int lp_status = glp_get_status(lp);
+        if (lp_status == GLP_NOFEAS) {
+            status = SolveStatus::INFEASIBLE;
+        } else if (lp_status == GLP_UNBND) {
+            status = SolveStatus::UNBOUNDED;
+        } else {
+            objective = glp_get_obj_val(lp);
+            status = SolveStatus::OK;
+        }
+    }
+
+    // Desfaz a fixação e volta à base do nó
+    glp_set_col_bnds(lp, col, old_type, old_lb, old_ub);
+    restoreBasis(basis);
+    BB_LOG_TRACE("GLPKSolver") << "Probe x" << col << " = " << value << ": status "
+                               << static_cast<int>(status) << ", " << last_iterations_ << " iterações.";
+    return status;
+}
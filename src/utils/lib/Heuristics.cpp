@@ -0,0 +1,475 @@
+#include "Heuristics.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include "Logger.h"
+
+namespace {
+    constexpr double FEASIBILITY_TOLERANCE = 1e-6;
+    constexpr double INTEGER_TOLERANCE = 1e-6;
+
+    // Colunas visitadas por chamada da busca local, e colunas livres candidatas a entrar em cada 2-swap
+    constexpr long long LOCAL_SEARCH_WORK_LIMIT = 4000000;
+    constexpr int LOCAL_SEARCH_SWAP_CANDIDATES = 64;
+
+    bool isFractional(double value) {
+        return value > INTEGER_TOLERANCE && value < 1.0 - INTEGER_TOLERANCE;
+    }
+
+    // Solução inicial com as fixações do nó; free marca as variáveis que a heurística pode alterar
+    void applyFixings(
+        const std::vector<std::pair<int, int>>& fixed_vars,
+        std::vector<int>& solution,
+        std::vector<char>& free) {
+        for (const auto& [var, value] : fixed_vars) {
+            solution[var] = value;
+            free[var] = 0;
+        }
+    }
+
+    // Mede o tempo de uma chamada e o acumula nas estatísticas
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(HeuristicStats& stats)
+            : stats_(stats),
+              start_(std::chrono::steady_clock::now()) {}
+
+        ~ScopedTimer() {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            stats_.time_us += std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        }
+
+    private:
+        HeuristicStats& stats_;
+        std::chrono::steady_clock::time_point start_;
+    };
+}
+
+// ---------------------------------------------------------------------------
+// Interface
+// ---------------------------------------------------------------------------
+PrimalHeuristic::PrimalHeuristic(const ProblemModel& model, int frequency)
+    : model_(model),
+      frequency_(frequency) {}
+
+bool PrimalHeuristic::shouldRun(int depth) const noexcept {
+    if (frequency_ < 0) {
+        return false;
+    }
+    if (frequency_ == 0) {
+        return depth == 0;
+    }
+    return depth % frequency_ == 0;
+}
+
+// ---------------------------------------------------------------------------
+// Gulosa
+// ---------------------------------------------------------------------------
+GreedyHeuristic::GreedyHeuristic(const ProblemModel& model, int frequency)
+    : PrimalHeuristic(model, frequency) {
+    // Peso normalizado: fração da capacidade de cada linha <= consumida pela variável
+    std::vector<double> ratio(static_cast<size_t>(model.numCols()));
+    for (int j = 0; j < model.numCols(); ++j) {
+        double weight = 0.0;
+        for (int k = model.colStart(j); k < model.colEnd(j); ++k) {
+            const double upper = model.rowUpper(model.colRow(k));
+            if (model.colValue(k) > 0.0 && std::isfinite(upper) && upper > 0.0) {
+                weight += model.colValue(k) / upper;
+            }
+        }
+        ratio[j] = model.objective(j) / std::max(weight, FEASIBILITY_TOLERANCE);
+    }
+    order_.resize(static_cast<size_t>(model.numCols()));
+    for (int j = 0; j < model.numCols(); ++j) {
+        order_[j] = j;
+    }
+    std::stable_sort(order_.begin(), order_.end(), [&](int a, int b) { return ratio[a] > ratio[b]; });
+}
+
+bool GreedyHeuristic::run(
+    const HeuristicContext& context,
+    std::vector<int>& solution,
+    long long& /*lp_iterations*/) const {
+    solution.assign(static_cast<size_t>(model_.numCols()), 0);
+    std::vector<char> free(solution.size(), 1);
+    applyFixings(context.fixed_vars, solution, free);
+
+    RowActivity activity(model_, solution, FEASIBILITY_TOLERANCE);
+    for (int j : order_) {
+        if (free[j] && model_.objective(j) > 0.0 && activity.canAdd(j)) {
+            activity.add(j);
+            solution[j] = 1;
+        }
+    }
+    return activity.feasible();
+}
+
+// ---------------------------------------------------------------------------
+// Arredondamento com reparo
+// ---------------------------------------------------------------------------
+RoundingHeuristic::RoundingHeuristic(const ProblemModel& model, int frequency)
+    : PrimalHeuristic(model, frequency) {}
+
+bool RoundingHeuristic::run(
+    const HeuristicContext& context,
+    std::vector<int>& solution,
+    long long& /*lp_iterations*/) const {
+    const int num_cols = model_.numCols();
+    solution.assign(static_cast<size_t>(num_cols), 0);
+    std::vector<char> free(solution.size(), 1);
+    for (int j = 0; j < num_cols; ++j) {
+        solution[j] = context.relaxation[j] >= 0.5 ? 1 : 0;
+    }
+    applyFixings(context.fixed_vars, solution, free);
+
+    // Reparo: retira das linhas violadas a variável livre de menor valor na relaxação
+    RowActivity activity(model_, solution, FEASIBILITY_TOLERANCE);
+    for (int row = 0; row < model_.numRows(); ++row) {
+        while (activity.rowViolated(row)) {
+            const bool over = activity[row] > model_.rowUpper(row);
+            int victim = -1;
+            for (int k = model_.rowStart(row); k < model_.rowEnd(row); ++k) {
+                const int var = model_.rowCol(k);
+                const double a = model_.rowValue(k);
+                // Acima do limite superior remove termos positivos; abaixo do inferior, negativos
+                if (!free[var] || solution[var] == 0 || (over ? a <= 0.0 : a >= 0.0)) {
+                    continue;
+                }
+                if (victim < 0 || context.relaxation[var] < context.relaxation[victim]) {
+                    victim = var;
+                }
+            }
+            if (victim < 0) {
+                return false;
+            }
+            activity.remove(victim);
+            solution[victim] = 0;
+            free[victim] = 0; // Não volta no preenchimento
+        }
+    }
+
+    // Preenchimento: inclui as variáveis que ainda cabem, das mais altas na relaxação para as mais baixas
+    std::vector<int> candidates;
+    for (int j = 0; j < num_cols; ++j) {
+        if (free[j] && solution[j] == 0 && model_.objective(j) > 0.0) {
+            candidates.push_back(j);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+        if (context.relaxation[a] != context.relaxation[b]) {
+            return context.relaxation[a] > context.relaxation[b];
+        }
+        return model_.objective(a) > model_.objective(b);
+    });
+    for (int j : candidates) {
+        if (activity.canAdd(j)) {
+            activity.add(j);
+            solution[j] = 1;
+        }
+    }
+    return activity.feasible();
+}
+
+// ---------------------------------------------------------------------------
+// Mergulho
+// ---------------------------------------------------------------------------
+DivingHeuristic::DivingHeuristic(const ProblemModel& model, int frequency, DivingRule rule, int max_depth)
+    : PrimalHeuristic(model, frequency),
+      rule_(rule),
+      max_depth_(max_depth),
+      up_locks_(static_cast<size_t>(model.numCols()), 0),
+      down_locks_(static_cast<size_t>(model.numCols()), 0) {
+    for (int j = 0; j < model.numCols(); ++j) {
+        for (int k = model.colStart(j); k < model.colEnd(j); ++k) {
+            const int row = model.colRow(k);
+            const bool has_upper = std::isfinite(model.rowUpper(row));
+            const bool has_lower = std::isfinite(model.rowLower(row));
+            if (model.colValue(k) > 0.0) {
+                up_locks_[j] += has_upper;
+                down_locks_[j] += has_lower;
+            } else {
+                up_locks_[j] += has_lower;
+                down_locks_[j] += has_upper;
+            }
+        }
+    }
+}
+
+const char* DivingHeuristic::name() const {
+    return rule_ == DivingRule::FRACTIONAL ? "fractional-diving" : "coefficient-diving";
+}
+
+int DivingHeuristic::selectVariable(
+    const std::vector<double>& relaxation,
+    const std::vector<char>& fixed,
+    int& value) const {
+    int best_var = -1;
+    int best_locks = std::numeric_limits<int>::max();
+    double best_distance = std::numeric_limits<double>::infinity();
+    for (size_t j = 0; j < relaxation.size(); ++j) {
+        if (fixed[j] || !isFractional(relaxation[j])) {
+            continue;
+        }
+        const double frac = relaxation[j];
+        int direction;
+        int locks = 0;
+        if (rule_ == DivingRule::FRACTIONAL) {
+            direction = frac < 0.5 ? 0 : 1;
+        } else {
+            // Arredonda para o lado com menos travas; empate vai para o inteiro mais próximo
+            const int up = up_locks_[j];
+            const int down = down_locks_[j];
+            direction = up < down ? 1 : (down < up ? 0 : (frac < 0.5 ? 0 : 1));
+            locks = direction == 1 ? up : down;
+        }
+        const double distance = direction == 1 ? 1.0 - frac : frac;
+        if (locks < best_locks || (locks == best_locks && distance < best_distance)) {
+            best_locks = locks;
+            best_distance = distance;
+            best_var = static_cast<int>(j);
+            value = direction;
+        }
+    }
+    return best_var;
+}
+
+bool DivingHeuristic::run(
+    const HeuristicContext& context,
+    std::vector<int>& solution,
+    long long& lp_iterations) const {
+    if (!context.solver) {
+        return false;
+    }
+    GLPKSolver& solver = *context.solver;
+    glp_prob* lp = solver.getProblem();
+    const int num_cols = glp_get_num_cols(lp);
+
+    // Colunas já fixadas no LP do nó (fixações do nó, aplicadas por trilha ou cópia)
+    std::vector<char> fixed(static_cast<size_t>(num_cols), 0);
+    for (int j = 1; j <= num_cols; ++j) {
+        fixed[j - 1] = glp_get_col_type(lp, j) == GLP_FX;
+    }
+
+    struct SavedBounds {
+        int col;
+        int type;
+        double lb;
+        double ub;
+    };
+    std::vector<SavedBounds> saved;
+    const LpBasis basis = solver.saveBasis();
+
+    std::vector<double> relaxation = context.relaxation;
+    double objective = context.lp_objective;
+    bool found = false;
+    for (int step = 0; ; ++step) {
+        int value = 0;
+        const int var = selectVariable(relaxation, fixed, value);
+        if (var < 0) {
+            solution.resize(relaxation.size());
+            std::transform(relaxation.begin(), relaxation.end(), solution.begin(),
+                           [](double x) { return static_cast<int>(std::round(x)); });
+            found = true;
+            break;
+        }
+        if (step >= max_depth_) {
+            break;
+        }
+        const int col = var + 1;
+        saved.push_back({col, glp_get_col_type(lp, col), glp_get_col_lb(lp, col), glp_get_col_ub(lp, col)});
+        fixed[var] = 1;
+
+        // Tenta o valor escolhido; se o LP ficar inviável ou dominado, tenta o oposto uma vez
+        bool promising = false;
+        for (int attempt = 0; attempt < 2 && !promising; ++attempt, value = 1 - value) {
+            glp_set_col_bnds(lp, col, GLP_FX, value, value);
+            const SolveStatus status = solver.solve(relaxation, objective);
+            lp_iterations += solver.lastIterationCount();
+            promising = status == SolveStatus::OK && objective > context.incumbent;
+        }
+        if (!promising) {
+            break;
+        }
+    }
+
+    // Desfaz as fixações do mergulho e volta à base do nó
+    for (auto it = saved.rbegin(); it != saved.rend(); ++it) {
+        glp_set_col_bnds(lp, it->col, it->type, it->lb, it->ub);
+    }
+    solver.restoreBasis(basis);
+    BB_LOG_TRACE("Heuristics") << name() << ": " << saved.size() << " fixações, "
+                               << (found ? "solução inteira" : "sem solução") << ".";
+    return found;
+}
+
+// ---------------------------------------------------------------------------
+// Busca local
+// ---------------------------------------------------------------------------
+LocalSearch::LocalSearch(const ProblemModel& model)
+    : model_(model),
+      by_profit_(static_cast<size_t>(model.numCols())) {
+    std::iota(by_profit_.begin(), by_profit_.end(), 0);
+    std::stable_sort(by_profit_.begin(), by_profit_.end(),
+                     [&](int a, int b) { return model_.objective(a) > model_.objective(b); });
+}
+
+bool LocalSearch::improve(std::vector<int>& solution) const {
+    const int num_cols = model_.numCols();
+    RowActivity activity(model_, solution, FEASIBILITY_TOLERANCE);
+    if (!activity.feasible()) {
+        return false;
+    }
+    long long budget = LOCAL_SEARCH_WORK_LIMIT;
+
+    // 1-opt: inclui, em ordem de lucro, as variáveis que ainda cabem (uma que não coube não volta a
+    // caber, pois as atividades só aumentam)
+    const auto fill = [&]() {
+        bool added = false;
+        for (const int j : by_profit_) {
+            if (model_.objective(j) <= 0.0 || --budget < 0) {
+                break;
+            }
+            if (solution[j] == 0 && activity.canAdd(j)) {
+                activity.add(j);
+                solution[j] = 1;
+                added = true;
+            }
+        }
+        return added;
+    };
+
+    bool improved = fill();
+    std::vector<int> candidates;
+    candidates.reserve(LOCAL_SEARCH_SWAP_CANDIDATES);
+    while (budget > 0) {
+        // 2-swap: primeira troca que aumenta o objetivo, com entrada entre as colunas livres mais lucrativas
+        candidates.clear();
+        for (const int j : by_profit_) {
+            if (static_cast<int>(candidates.size()) == LOCAL_SEARCH_SWAP_CANDIDATES || --budget < 0) {
+                break;
+            }
+            if (solution[j] == 0) {
+                candidates.push_back(j);
+            }
+        }
+        bool moved = false;
+        for (int out = 0; out < num_cols && !moved && budget > 0; ++out) {
+            --budget;
+            if (solution[out] == 0 || !activity.canRemove(out)) {
+                continue;
+            }
+            activity.remove(out);
+            for (const int in : candidates) {
+                if (model_.objective(in) <= model_.objective(out) + FEASIBILITY_TOLERANCE) {
+                    break;
+                }
+                --budget;
+                if (activity.canAdd(in)) {
+                    activity.add(in);
+                    solution[out] = 0;
+                    solution[in] = 1;
+                    moved = true;
+                    break;
+                }
+            }
+            if (!moved) {
+                activity.add(out);
+            }
+        }
+        if (!moved) {
+            break;
+        }
+        improved = true;
+        fill();
+    }
+    return improved;
+}
+
+// ---------------------------------------------------------------------------
+// Conjunto de heurísticas
+// ---------------------------------------------------------------------------
+PrimalHeuristics::PrimalHeuristics(const ProblemModel& model, const HeuristicParams& params)
+    : model_(model),
+      use_local_search_(params.local_search),
+      local_search_(model) {
+    heuristics_.push_back(std::make_unique<GreedyHeuristic>(model, params.greedy_frequency));
+    heuristics_.push_back(std::make_unique<RoundingHeuristic>(model, params.rounding_frequency));
+    heuristics_.push_back(std::make_unique<DivingHeuristic>(model, params.fractional_diving_frequency,
+                                                            DivingRule::FRACTIONAL, params.diving_max_depth));
+    heuristics_.push_back(std::make_unique<DivingHeuristic>(model, params.coefficient_diving_frequency,
+                                                            DivingRule::COEFFICIENT, params.diving_max_depth));
+}
+
+bool PrimalHeuristics::runAtNode(const HeuristicContext& context, Incumbent& incumbent, long long& lp_iterations) {
+    bool improved = false;
+    std::vector<int> solution;
+    for (const auto& heuristic : heuristics_) {
+        if (!heuristic->shouldRun(context.depth)) {
+            continue;
+        }
+        HeuristicStats& stats = heuristic->stats();
+        ++stats.calls;
+        long long iterations = 0;
+        bool found;
+        {
+            ScopedTimer timer(stats);
+            found = heuristic->run(context, solution, iterations);
+        }
+        stats.lp_iterations += iterations;
+        lp_iterations += iterations;
+        if (found && submit(solution, incumbent, &stats)) {
+            BB_LOG_DEBUG("Heuristics") << "Heurística " << heuristic->name()
+                                       << " encontrou incumbente com valor " << incumbent.value() << ".";
+            improved = true;
+        }
+    }
+    return improved;
+}
+
+bool PrimalHeuristics::submit(std::vector<int> solution, Incumbent& incumbent, HeuristicStats* source) {
+    if (!model_.isFeasible(solution, FEASIBILITY_TOLERANCE)) {
+        return false;
+    }
+    const bool improved = incumbent.tryUpdate(model_.objectiveValue(solution), solution);
+    if (improved && source) {
+        ++source->successes;
+    }
+    if (improved) {
+        polish(std::move(solution), incumbent);
+    }
+    return improved;
+}
+
+bool PrimalHeuristics::polish(std::vector<int> solution, Incumbent& incumbent) {
+    if (!use_local_search_) {
+        return false;
+    }
+    HeuristicStats& stats = local_search_.stats();
+    ++stats.calls;
+    ScopedTimer timer(stats);
+    if (local_search_.improve(solution) && model_.isFeasible(solution, FEASIBILITY_TOLERANCE) &&
+        incumbent.tryUpdate(model_.objectiveValue(solution), solution)) {
+        ++stats.successes;
+        BB_LOG_DEBUG("Heuristics") << "Busca local melhorou o incumbente para " << incumbent.value() << ".";
+        return true;
+    }
+    return false;
+}
+
+void PrimalHeuristics::logStats() const {
+    auto log = [](const char* name, const HeuristicStats& stats) {
+        if (stats.calls == 0) {
+            return;
+        }
+        BB_LOG_INFO("Heuristics") << "Heurística " << name << ": " << stats.calls << " chamadas, "
+                                  << stats.successes << " sucessos, " << stats.lp_iterations
+                                  << " iterações do simplex, " << stats.time_us / 1000.0 << " ms.";
+    };
+    for (const auto& heuristic : heuristics_) {
+        log(heuristic->name(), heuristic->stats());
+    }
+    log("local-search", local_search_.stats());
+}
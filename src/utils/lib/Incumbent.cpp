@@ -0,0 +1,43 @@
+#include "Incumbent.h"
+#include <limits>
+
+Incumbent::Incumbent()
+    : objective_(-std::numeric_limits<double>::infinity()) {}
+
+bool Incumbent::tryUpdate(double objective, const std::vector<int>& solution) {
+    // Teste rápido sem trava: a maioria das candidatas não melhora o incumbente
+    if (objective <= value()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (objective <= objective_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    solution_ = solution;
+    objective_.store(objective, std::memory_order_release);
+    if (listener_) {
+        listener_(objective, solution_);
+    }
+    return true;
+}
+
+bool Incumbent::hasSolution() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !solution_.empty();
+}
+
+std::vector<int> Incumbent::solution() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return solution_;
+}
+
+void Incumbent::setListener(Listener listener) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    listener_ = std::move(listener);
+}
+
+void Incumbent::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    solution_.clear();
+    objective_.store(-std::numeric_limits<double>::infinity(), std::memory_order_release);
+}
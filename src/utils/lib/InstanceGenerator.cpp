@@ -0,0 +1,122 @@
+#include "InstanceGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    // Inteiro em [lower, upper] independente da implementação da biblioteca padrão
+    long long draw(std::mt19937_64& rng, long long lower, long long upper) {
+        const std::uint64_t range = static_cast<std::uint64_t>(upper - lower) + 1;
+        return lower + static_cast<long long>(rng() % range);
+    }
+}
+
+KnapsackInstance InstanceGenerator::multiKnapsack(const KnapsackParams& params) {
+    if (params.num_items <= 0 || params.num_constraints <= 0) {
+        throw std::invalid_argument("A instância precisa de ao menos um item e uma restrição.");
+    }
+    if (!(params.tightness > 0.0 && params.tightness < 1.0)) {
+        throw std::invalid_argument("A folga das restrições deve estar em (0, 1).");
+    }
+    if (params.max_weight < 1) {
+        throw std::invalid_argument("O peso máximo deve ser positivo.");
+    }
+
+    const int n = params.num_items;
+    const int m = params.num_constraints;
+    const long long R = params.max_weight;
+    std::mt19937_64 rng(params.seed);
+
+    KnapsackInstance instance;
+    instance.num_items = n;
+    instance.num_constraints = m;
+    instance.weights.resize(static_cast<size_t>(m) * n);
+    instance.capacities.resize(m);
+    instance.profits.resize(n);
+
+    for (int i = 0; i < m; ++i) {
+        double row_sum = 0.0;
+        for (int j = 0; j < n; ++j) {
+            const double weight = static_cast<double>(draw(rng, 1, R));
+            instance.weights[static_cast<size_t>(i) * n + j] = weight;
+            row_sum += weight;
+        }
+        // Capacidade inteira, sempre suficiente para o item mais pesado da linha
+        const double heaviest = *std::max_element(instance.weights.begin() + static_cast<size_t>(i) * n,
+                                                  instance.weights.begin() + static_cast<size_t>(i + 1) * n);
+        instance.capacities[i] = std::max(heaviest, std::floor(params.tightness * row_sum));
+    }
+
+    for (int j = 0; j < n; ++j) {
+        double mean_weight = 0.0;
+        for (int i = 0; i < m; ++i) {
+            mean_weight += instance.weights[static_cast<size_t>(i) * n + j];
+        }
+        mean_weight = std::round(mean_weight / m);
+
+        double profit = 0.0;
+        switch (params.correlation) {
+            case KnapsackCorrelation::UNCORRELATED:
+                profit = static_cast<double>(draw(rng, 1, R));
+                break;
+            case KnapsackCorrelation::WEAKLY:
+                profit = mean_weight + static_cast<double>(draw(rng, -R / 10, R / 10));
+                break;
+            case KnapsackCorrelation::STRONGLY:
+                profit = mean_weight + static_cast<double>(R / 10);
+                break;
+        }
+        instance.profits[j] = std::max(1.0, profit);
+    }
+    return instance;
+}
+
+const char* InstanceGenerator::correlationName(KnapsackCorrelation correlation) {
+    switch (correlation) {
+        case KnapsackCorrelation::UNCORRELATED: return "uncorrelated";
+        case KnapsackCorrelation::WEAKLY: return "weakly";
+        case KnapsackCorrelation::STRONGLY: return "strongly";
+    }
+    return "unknown";
+}
+
+glp_prob* KnapsackInstance::toGlpk() const {
+    glp_prob* lp = glp_create_prob();
+    glp_set_obj_dir(lp, GLP_MAX);
+    glp_add_rows(lp, num_constraints);
+    glp_add_cols(lp, num_items);
+    for (int j = 0; j < num_items; ++j) {
+        glp_set_col_bnds(lp, j + 1, GLP_DB, 0.0, 1.0);
+        glp_set_obj_coef(lp, j + 1, profits[j]);
+    }
+
+    // Matriz densa: índices do GLPK começam em 1 (a posição 0 é ignorada)
+    std::vector<int> columns(num_items + 1);
+    std::vector<double> values(num_items + 1);
+    for (int i = 0; i < num_constraints; ++i) {
+        glp_set_row_bnds(lp, i + 1, GLP_UP, 0.0, capacities[i]);
+        for (int j = 0; j < num_items; ++j) {
+            columns[j + 1] = j + 1;
+            values[j + 1] = weights[static_cast<size_t>(i) * num_items + j];
+        }
+        glp_set_mat_row(lp, i + 1, num_items, columns.data(), values.data());
+    }
+    return lp;
+}
+
+void KnapsackInstance::writeDenseText(std::ostream& out) const {
+    // Todos os coeficientes gerados são inteiros: escritos sem notação científica
+    auto integer = [](double value) { return static_cast<long long>(value); };
+    out << num_items << ' ' << num_constraints << '\n';
+    for (int j = 0; j < num_items; ++j) {
+        out << (j > 0 ? " " : "") << integer(profits[j]);
+    }
+    out << '\n';
+    for (int i = 0; i < num_constraints; ++i) {
+        for (int j = 0; j < num_items; ++j) {
+            out << integer(weights[static_cast<size_t>(i) * num_items + j]) << ' ';
+        }
+        out << integer(capacities[i]) << '\n';
+    }
+}
@@ -0,0 +1,306 @@
+#include "KnapsackEngines.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+namespace {
+    constexpr double INTEGRALITY_TOLERANCE = 1e-9;
+    constexpr double CAPACITY_TOLERANCE = 1e-9;
+    constexpr long long CHECK_INTERVAL = 1024; // Nós entre consultas a should_stop
+
+    bool isIntegral(double value) {
+        return std::abs(value - std::round(value)) <= INTEGRALITY_TOLERANCE;
+    }
+}
+
+const char* engineName(SolverEngine engine) {
+    switch (engine) {
+        case SolverEngine::AUTO: return "automático";
+        case SolverEngine::LP_BRANCH_AND_BOUND: return "branch and bound com LP";
+        case SolverEngine::COMBINATORIAL: return "branch and bound combinatório (limite de Dantzig)";
+        case SolverEngine::DYNAMIC_PROGRAMMING: return "programação dinâmica";
+    }
+    return "desconhecido";
+}
+
+bool KnapsackForm::extract(const ProblemModel& model, KnapsackForm& form) {
+    form = KnapsackForm{};
+
+    // Primeira passada, sem alocar: a forma se aplica?
+    std::size_t num_rows = 0;
+    bool integral_weights = true;
+    for (int row = 0; row < model.numRows(); ++row) {
+        const double upper = model.rowUpper(row);
+        const double lower = model.rowLower(row);
+        if (!std::isfinite(upper) && !std::isfinite(lower)) {
+            continue; // Linha livre: não restringe
+        }
+        // Com pesos não negativos, x = 0 precisa satisfazer a linha
+        if (!std::isfinite(upper) || upper < 0.0 || lower > 0.0) {
+            return false;
+        }
+        for (int k = model.rowStart(row); k < model.rowEnd(row); ++k) {
+            if (model.rowValue(k) < 0.0) {
+                return false;
+            }
+            integral_weights = integral_weights && isIntegral(model.rowValue(k));
+        }
+        ++num_rows;
+    }
+
+    form.num_items = model.numCols();
+    form.profits = model.objective();
+    form.integral_weights = integral_weights;
+    form.rows.reserve(num_rows);
+    form.capacities.reserve(num_rows);
+    for (int row = 0; row < model.numRows(); ++row) {
+        if (std::isfinite(model.rowUpper(row))) {
+            form.rows.push_back(row);
+            form.capacities.push_back(model.rowUpper(row));
+        }
+    }
+    if (num_rows * static_cast<std::size_t>(form.num_items) <= ProblemModel::DENSE_MAX_ENTRIES) {
+        form.weights.assign(num_rows, std::vector<double>(static_cast<size_t>(form.num_items), 0.0));
+        for (std::size_t r = 0; r < num_rows; ++r) {
+            for (int k = model.rowStart(form.rows[r]); k < model.rowEnd(form.rows[r]); ++k) {
+                form.weights[r][model.rowCol(k)] = model.rowValue(k);
+            }
+        }
+    }
+    return true;
+}
+
+bool KnapsackForm::fitsDynamicProgramming(std::size_t max_states, std::size_t max_cells) const {
+    if (!hasDenseWeights() || !integral_weights) {
+        return false;
+    }
+    std::size_t states = 1;
+    for (std::size_t row = 0; row < capacities.size(); ++row) {
+        if (!isIntegral(capacities[row])) {
+            return false;
+        }
+        const double digits = std::floor(capacities[row] + INTEGRALITY_TOLERANCE) + 1.0;
+        if (digits > static_cast<double>(max_states / states)) {
+            return false;
+        }
+        states *= static_cast<std::size_t>(digits);
+    }
+    return static_cast<std::size_t>(std::max(num_items, 1)) <= max_cells / states;
+}
+
+CombinatorialKnapsack::CombinatorialKnapsack(const ProblemModel& model, const KnapsackForm& form)
+    : model_(model), capacity_(form.capacities.at(0)) {
+    // Pesos da única restrição, lidos da linha esparsa do modelo
+    std::vector<double> weights(static_cast<size_t>(form.num_items), 0.0);
+    for (int k = model.rowStart(form.rows.at(0)); k < model.rowEnd(form.rows.at(0)); ++k) {
+        weights[model.rowCol(k)] = model.rowValue(k);
+    }
+    base_solution_.assign(static_cast<size_t>(form.num_items), 0);
+    std::vector<int> items;
+    for (int col = 0; col < form.num_items; ++col) {
+        if (form.profits[col] <= 0.0 || weights[col] > capacity_ + CAPACITY_TOLERANCE) {
+            continue; // Fica em 0: não melhora o objetivo ou não cabe
+        }
+        if (weights[col] == 0.0) {
+            base_solution_[col] = 1; // Lucro sem custo
+        } else {
+            items.push_back(col);
+        }
+    }
+    // Ordem decrescente de lucro/peso (produto cruzado, sem divisões)
+    std::stable_sort(items.begin(), items.end(), [&](int a, int b) {
+        return form.profits[a] * weights[b] > form.profits[b] * weights[a];
+    });
+
+    order_ = items;
+    profit_.resize(items.size());
+    weight_.resize(items.size());
+    profit_prefix_.assign(items.size() + 1, 0.0);
+    weight_prefix_.assign(items.size() + 1, 0.0);
+    integral_profits_ = true;
+    for (std::size_t k = 0; k < items.size(); ++k) {
+        profit_[k] = form.profits[items[k]];
+        weight_[k] = weights[items[k]];
+        profit_prefix_[k + 1] = profit_prefix_[k] + profit_[k];
+        weight_prefix_[k + 1] = weight_prefix_[k] + weight_[k];
+        integral_profits_ = integral_profits_ && isIntegral(profit_[k]);
+    }
+    base_value_ = model_.objectiveValue(base_solution_);
+    root_bound_ = base_value_ + dantzigBound(0, capacity_);
+}
+
+double CombinatorialKnapsack::dantzigBound(int first, double capacity) const {
+    // Último prefixo [first, last) que cabe inteiro na capacidade
+    const double limit = weight_prefix_[first] + capacity + CAPACITY_TOLERANCE;
+    const auto end = std::upper_bound(weight_prefix_.begin() + first, weight_prefix_.end(), limit);
+    const int last = std::max(first, static_cast<int>(end - weight_prefix_.begin()) - 1);
+    double bound = profit_prefix_[last] - profit_prefix_[first];
+    if (last < static_cast<int>(profit_.size())) {
+        const double left = capacity - (weight_prefix_[last] - weight_prefix_[first]);
+        bound += std::max(0.0, left) * profit_[last] / weight_[last];
+    }
+    return integral_profits_ ? std::floor(bound + INTEGRALITY_TOLERANCE) : bound;
+}
+
+bool CombinatorialKnapsack::solve(Incumbent& incumbent, const EngineControl& control) {
+    const int count = static_cast<int>(order_.size());
+    std::vector<int> taken; // Itens em 1 no caminho atual, em ordem crescente
+    taken.reserve(order_.size());
+    std::vector<int> solution;
+    int item = 0;              // Itens [0, item) já decididos
+    double capacity = capacity_;
+    double value = 0.0;        // Lucro dos itens em taken
+    long long nodes = 0;
+    bool finished = true;
+
+    while (true) {
+        ++nodes;
+        if (nodes % CHECK_INTERVAL == 0) {
+            control.count_nodes(CHECK_INTERVAL);
+            if (control.should_stop()) {
+                finished = false;
+                break;
+            }
+        }
+
+        bool backtrack;
+        const double bound = base_value_ + value + dantzigBound(item, capacity);
+        const double primal = incumbent.value();
+        if (bound <= control.cutoff(primal)) {
+            if (bound > primal) {
+                closed_bound_ = std::max(closed_bound_, bound);
+            }
+            backtrack = true;
+        } else if (item == count) {
+            // Folha: o que coube, em ordem, com o resto em 0
+            solution = base_solution_;
+            for (const int k : taken) {
+                solution[order_[k]] = 1;
+            }
+            if (model_.isFeasible(solution)) {
+                incumbent.tryUpdate(model_.objectiveValue(solution), solution);
+            }
+            backtrack = true;
+        } else {
+            // Primeiro o ramo x = 1; item que não cabe só tem o ramo x = 0
+            if (weight_[item] <= capacity + CAPACITY_TOLERANCE) {
+                taken.push_back(item);
+                capacity -= weight_[item];
+                value += profit_[item];
+            }
+            ++item;
+            backtrack = false;
+        }
+
+        if (backtrack) {
+            // Volta ao último item em 1 e segue pelo seu ramo x = 0
+            if (taken.empty()) {
+                break;
+            }
+            const int last = taken.back();
+            taken.pop_back();
+            capacity += weight_[last];
+            value -= profit_[last];
+            item = last + 1;
+        }
+    }
+    control.count_nodes(nodes % CHECK_INTERVAL);
+    return finished;
+}
+
+DynamicProgrammingKnapsack::DynamicProgrammingKnapsack(const ProblemModel& model, const KnapsackForm& form)
+    : model_(model), form_(form) {}
+
+bool DynamicProgrammingKnapsack::solve(Incumbent& incumbent, const EngineControl& control) {
+    const std::size_t rows = form_.capacities.size();
+
+    // Estado u = soma de u_r * stride[r], 0 <= u_r <= capacidade da linha r
+    std::vector<long long> capacity(rows);
+    std::vector<std::size_t> stride(rows);
+    std::size_t states = 1;
+    for (std::size_t r = 0; r < rows; ++r) {
+        capacity[r] = static_cast<long long>(std::floor(form_.capacities[r] + INTEGRALITY_TOLERANCE));
+        stride[r] = states;
+        states *= static_cast<std::size_t>(capacity[r] + 1);
+    }
+
+    std::vector<int> solution(static_cast<size_t>(form_.num_items), 0);
+    std::vector<int> items;
+    std::vector<std::vector<long long>> item_weights;
+    for (int col = 0; col < form_.num_items; ++col) {
+        if (form_.profits[col] <= 0.0) {
+            continue;
+        }
+        std::vector<long long> weight(rows);
+        bool fits = true;
+        bool weightless = true;
+        for (std::size_t r = 0; r < rows; ++r) {
+            weight[r] = std::llround(form_.weights[r][col]);
+            fits = fits && weight[r] <= capacity[r];
+            weightless = weightless && weight[r] == 0;
+        }
+        if (!fits) {
+            continue;
+        }
+        if (weightless) {
+            solution[col] = 1;
+        } else {
+            items.push_back(col);
+            item_weights.push_back(std::move(weight));
+        }
+    }
+
+    std::vector<double> value(states, 0.0);
+    std::vector<std::uint64_t> taken((items.size() * states + 63) / 64, 0);
+    std::vector<long long> digit(rows);
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        if (control.should_stop()) {
+            return false;
+        }
+        const std::vector<long long>& weight = item_weights[i];
+        const double profit = form_.profits[items[i]];
+        std::size_t offset = 0;
+        for (std::size_t r = 0; r < rows; ++r) {
+            offset += static_cast<std::size_t>(weight[r]) * stride[r];
+        }
+        // Estados em ordem decrescente (contador em base mista), para cada item entrar no máximo uma vez
+        std::copy(capacity.begin(), capacity.end(), digit.begin());
+        for (std::size_t u = states; u-- > 0;) {
+            bool fits = true;
+            for (std::size_t r = 0; r < rows && fits; ++r) {
+                fits = digit[r] >= weight[r];
+            }
+            if (fits && value[u - offset] + profit > value[u]) {
+                value[u] = value[u - offset] + profit;
+                const std::size_t bit = i * states + u;
+                taken[bit / 64] |= std::uint64_t{1} << (bit % 64);
+            }
+            for (std::size_t r = 0; r < rows; ++r) {
+                if (digit[r] > 0) {
+                    --digit[r];
+                    break;
+                }
+                digit[r] = capacity[r];
+            }
+        }
+        control.count_nodes(1);
+    }
+
+    // Reconstrução a partir da capacidade cheia
+    std::size_t u = states - 1;
+    for (std::size_t i = items.size(); i-- > 0;) {
+        const std::size_t bit = i * states + u;
+        if (taken[bit / 64] >> (bit % 64) & 1) {
+            solution[items[i]] = 1;
+            for (std::size_t r = 0; r < rows; ++r) {
+                u -= static_cast<std::size_t>(item_weights[i][r]) * stride[r];
+            }
+        }
+    }
+    if (model_.isFeasible(solution)) {
+        incumbent.tryUpdate(model_.objectiveValue(solution), solution);
+    }
+    return true;
+}
@@ -0,0 +1,239 @@
+#include "Lagrangian.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr double CAPACITY_TOLERANCE = 1e-9;
+    constexpr double INTEGRALITY_TOLERANCE = 1e-9;
+    constexpr int STALL_ITERATIONS = 10; // Iterações sem melhora antes de reduzir o passo pela metade
+}
+
+std::unique_ptr<LagrangianBound> LagrangianBound::create(const ProblemModel& model, const LagrangianParams& params) {
+    KnapsackForm form;
+    if (!KnapsackForm::extract(model, form) || form.capacities.empty() || !form.hasDenseWeights()) {
+        return nullptr;
+    }
+    return std::unique_ptr<LagrangianBound>(new LagrangianBound(model, std::move(form), params));
+}
+
+LagrangianBound::LagrangianBound(const ProblemModel& model, KnapsackForm form, const LagrangianParams& params)
+    : model_(model), form_(std::move(form)), params_(params) {
+    const int rows = static_cast<int>(form_.capacities.size());
+    const int cols = form_.num_items;
+
+    // Linha mantida: a de menor capacidade em relação à soma dos pesos
+    double tightest = std::numeric_limits<double>::infinity();
+    for (int row = 0; row < rows; ++row) {
+        double total = 0.0;
+        for (const double weight : form_.weights[row]) {
+            total += weight;
+        }
+        if (total > 0.0 && form_.capacities[row] / total < tightest) {
+            tightest = form_.capacities[row] / total;
+            kept_row_ = row;
+        }
+    }
+    const std::vector<double>& kept = form_.weights[kept_row_];
+    integral_objective_ = true;
+    for (int col = 0; col < cols; ++col) {
+        if (kept[col] == 0.0) {
+            weightless_.push_back(col);
+        }
+        integral_objective_ = integral_objective_ &&
+            std::abs(form_.profits[col] - std::round(form_.profits[col])) <= INTEGRALITY_TOLERANCE;
+    }
+
+    // Alvo do passo na raiz: solução gulosa viável (itens por lucro / consumo relativo das capacidades)
+    std::vector<int> items;
+    std::vector<double> density(static_cast<size_t>(cols), 0.0);
+    for (int col = 0; col < cols; ++col) {
+        if (form_.profits[col] <= 0.0) {
+            continue;
+        }
+        double load = 0.0;
+        for (int row = 0; row < rows; ++row) {
+            load += form_.weights[row][col] / std::max(form_.capacities[row], CAPACITY_TOLERANCE);
+        }
+        density[col] = load > 0.0 ? form_.profits[col] / load : std::numeric_limits<double>::infinity();
+        items.push_back(col);
+    }
+    std::stable_sort(items.begin(), items.end(), [&](int a, int b) { return density[a] > density[b]; });
+    std::vector<double> slack = form_.capacities;
+    double target = model_.objectiveConstant();
+    for (const int col : items) {
+        bool fits = true;
+        for (int row = 0; row < rows && fits; ++row) {
+            fits = form_.weights[row][col] <= slack[row] + CAPACITY_TOLERANCE;
+        }
+        if (fits) {
+            for (int row = 0; row < rows; ++row) {
+                slack[row] -= form_.weights[row][col];
+            }
+            target += form_.profits[col];
+        }
+    }
+
+    LagrangianWorkspace workspace;
+    prepare(workspace);
+    multipliers_.assign(static_cast<size_t>(rows), 0.0);
+    root_bound_ = roundBound(optimize({}, target, std::max(1, params_.root_iterations), multipliers_, workspace));
+    root_base_ = price(multipliers_, root_reduced_, root_order_);
+}
+
+void LagrangianBound::prepare(LagrangianWorkspace& workspace) const {
+    if (workspace.state.size() != static_cast<size_t>(form_.num_items)) {
+        workspace.state.assign(static_cast<size_t>(form_.num_items), -1);
+    }
+}
+
+double LagrangianBound::price(const std::vector<double>& multipliers, std::vector<double>& reduced,
+                              std::vector<int>& order) const {
+    const int rows = static_cast<int>(form_.capacities.size());
+    double base = model_.objectiveConstant();
+    reduced = form_.profits;
+    for (int row = 0; row < rows; ++row) {
+        if (row == kept_row_ || multipliers[row] == 0.0) {
+            continue;
+        }
+        base += multipliers[row] * form_.capacities[row];
+        const std::vector<double>& weights = form_.weights[row];
+        for (int col = 0; col < form_.num_items; ++col) {
+            reduced[col] -= multipliers[row] * weights[col];
+        }
+    }
+    // Só itens de lucro reduzido positivo entram na relaxação; ordem decrescente de lucro reduzido / peso
+    const std::vector<double>& kept = form_.weights[kept_row_];
+    order.clear();
+    for (int col = 0; col < form_.num_items; ++col) {
+        if (kept[col] > 0.0 && reduced[col] > 0.0) {
+            order.push_back(col);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return reduced[a] * kept[b] > reduced[b] * kept[a];
+    });
+    return base;
+}
+
+double LagrangianBound::greedy(double base, const std::vector<double>& reduced, const std::vector<int>& order,
+                               const std::vector<std::pair<int, int>>& fixings,
+                               const std::vector<signed char>& state, std::vector<double>* used) const {
+    const std::vector<double>& kept = form_.weights[kept_row_];
+    const auto consume = [&](int col, double amount) {
+        if (used) {
+            for (std::size_t row = 0; row < used->size(); ++row) {
+                (*used)[row] += amount * form_.weights[row][col];
+            }
+        }
+    };
+    double value = base;
+    double capacity = form_.capacities[kept_row_];
+    for (const auto& [var, fixed] : fixings) {
+        if (fixed == 1) {
+            value += reduced[var];
+            capacity -= kept[var];
+            consume(var, 1.0);
+        }
+    }
+    if (capacity < -CAPACITY_TOLERANCE) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    for (const int col : weightless_) {
+        if (state[col] < 0 && reduced[col] > 0.0) {
+            value += reduced[col];
+            consume(col, 1.0);
+        }
+    }
+    for (const int col : order) {
+        if (state[col] >= 0) {
+            continue;
+        }
+        if (kept[col] <= capacity + CAPACITY_TOLERANCE) {
+            value += reduced[col];
+            capacity -= kept[col];
+            consume(col, 1.0);
+        } else {
+            // Fração do primeiro item que não cabe
+            const double fraction = std::max(0.0, capacity) / kept[col];
+            value += fraction * reduced[col];
+            consume(col, fraction);
+            break;
+        }
+    }
+    return value;
+}
+
+double LagrangianBound::optimize(const std::vector<std::pair<int, int>>& fixings, double target, int iterations,
+                                 std::vector<double>& multipliers, LagrangianWorkspace& workspace) const {
+    const int rows = static_cast<int>(form_.capacities.size());
+    double best = std::numeric_limits<double>::infinity();
+    workspace.best_multipliers = multipliers;
+    double step = 2.0;
+    int stall = 0;
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+        const double base = price(multipliers, workspace.reduced, workspace.order);
+        workspace.used.assign(static_cast<size_t>(rows), 0.0);
+        const double value = greedy(base, workspace.reduced, workspace.order, fixings, workspace.state, &workspace.used);
+        if (value == -std::numeric_limits<double>::infinity()) {
+            return value; // A linha mantida já é violada pelas fixações, para quaisquer multiplicadores
+        }
+        if (value < best) {
+            best = value;
+            workspace.best_multipliers = multipliers;
+            stall = 0;
+        } else if (++stall >= STALL_ITERATIONS) {
+            step /= 2.0;
+            stall = 0;
+        }
+        if (roundBound(best) <= target || iteration + 1 == iterations) {
+            break;
+        }
+
+        // Subgradiente c - W x nas linhas relaxadas, projetado em u >= 0
+        double norm = 0.0;
+        for (int row = 0; row < rows; ++row) {
+            double& gradient = workspace.used[row];
+            gradient = row == kept_row_ ? 0.0 : form_.capacities[row] - gradient;
+            if (multipliers[row] == 0.0 && gradient > 0.0) {
+                gradient = 0.0;
+            }
+            norm += gradient * gradient;
+        }
+        if (norm <= 1e-12) {
+            break; // Solução da relaxação satisfaz as linhas relaxadas com folga complementar
+        }
+        const double length = step * (value - target) / norm;
+        for (int row = 0; row < rows; ++row) {
+            multipliers[row] = std::max(0.0, multipliers[row] - length * workspace.used[row]);
+        }
+    }
+    multipliers = workspace.best_multipliers;
+    return best;
+}
+
+double LagrangianBound::bound(const std::vector<std::pair<int, int>>& fixings, double cutoff,
+                              LagrangianWorkspace& workspace) const {
+    prepare(workspace);
+    for (const auto& [var, value] : fixings) {
+        workspace.state[var] = static_cast<signed char>(value);
+    }
+    double result = roundBound(greedy(root_base_, root_reduced_, root_order_, fixings, workspace.state, nullptr));
+    if (result > cutoff && std::isfinite(cutoff) && params_.node_iterations > 0) {
+        workspace.multipliers = multipliers_;
+        result = std::min(result, roundBound(optimize(fixings, cutoff, params_.node_iterations,
+                                                      workspace.multipliers, workspace)));
+    }
+    for (const auto& fixing : fixings) {
+        workspace.state[fixing.first] = -1;
+    }
+    return result;
+}
+
+double LagrangianBound::roundBound(double bound) const {
+    if (!integral_objective_ || !std::isfinite(bound)) {
+        return bound;
+    }
+    const double constant = model_.objectiveConstant();
+    return std::floor(bound - constant + INTEGRALITY_TOLERANCE) + constant;
+}
@@ -0,0 +1,111 @@
+#include "Logger.h"
+#include <glpk.h>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+    constexpr std::size_t DEFAULT_BUFFER_CAPACITY = 64 * 1024;
+
+    const char* levelName(LogLevel level) {
+        switch (level) {
+            case LogLevel::TRACE: return "TRACE";
+            case LogLevel::DEBUG: return "DEBUG";
+            case LogLevel::INFO: return "INFO";
+            case LogLevel::WARNING: return "AVISO";
+            case LogLevel::ERROR: return "ERRO";
+            case LogLevel::OFF: break;
+        }
+        return "";
+    }
+
+    // Recebe os fragmentos de texto do GLPK e repassa ao logger linha a linha.
+    // Retornar 1 impede que o GLPK escreva no terminal.
+    int glpkTermHook(void* /*info*/, const char* text) {
+        thread_local std::string pending;
+        Logger& logger = Logger::instance();
+        if (!logger.enabled(LogLevel::DEBUG)) {
+            pending.clear();
+            return 1;
+        }
+        pending += text;
+        std::string::size_type newline;
+        while ((newline = pending.find('\n')) != std::string::npos) {
+            logger.write(LogLevel::DEBUG, "GLPK", pending.substr(0, newline));
+            pending.erase(0, newline + 1);
+        }
+        return 1;
+    }
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger()
+    : level_(static_cast<int>(LogLevel::INFO)),
+      sink_(&std::clog),
+      capacity_(DEFAULT_BUFFER_CAPACITY) {
+    buffer_.reserve(capacity_);
+}
+
+Logger::~Logger() {
+    flush();
+}
+
+void Logger::setSink(std::ostream& sink) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sink_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    sink_->flush();
+    buffer_.clear();
+    sink_ = &sink;
+}
+
+void Logger::setBufferCapacity(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = bytes;
+}
+
+void Logger::write(LogLevel level, const char* tag, const std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_ += '[';
+    buffer_ += tag;
+    buffer_ += "][";
+    buffer_ += levelName(level);
+    buffer_ += "] ";
+    buffer_ += message;
+    buffer_ += '\n';
+    // Avisos e erros não podem ficar presos no buffer se o processo cair logo em seguida
+    if (buffer_.size() >= capacity_ || level >= LogLevel::WARNING) {
+        sink_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        sink_->flush();
+        buffer_.clear();
+    }
+}
+
+void Logger::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!buffer_.empty()) {
+        sink_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+    sink_->flush();
+}
+
+void Logger::captureGlpkOutput() {
+    thread_local bool installed = false;
+    if (!installed) {
+        glp_term_hook(glpkTermHook, nullptr);
+        installed = true;
+    }
+}
+
+LogLevel Logger::parseLevel(const std::string& name) {
+    if (name == "trace") return LogLevel::TRACE;
+    if (name == "debug") return LogLevel::DEBUG;
+    if (name == "info") return LogLevel::INFO;
+    if (name == "warning") return LogLevel::WARNING;
+    if (name == "error") return LogLevel::ERROR;
+    if (name == "off") return LogLevel::OFF;
+    throw std::invalid_argument("Nível de log desconhecido: " + name);
+}
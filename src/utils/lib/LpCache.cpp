@@ -0,0 +1,150 @@
+#include "LpCache.h"
+#include <cstring>
+
+namespace {
+    // Mistura de 64 bits do splitmix64: valores de Zobrist derivados do índice, sem tabela
+    std::uint64_t mix(std::uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    std::uint64_t combine(std::uint64_t seed, std::uint64_t value) {
+        return mix(seed ^ value);
+    }
+
+    std::uint64_t bits(double value) {
+        std::uint64_t result;
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+
+    constexpr std::uint64_t CHECK_SEED = 0x5851f42d4c957f2dULL;
+}
+
+LpCache::LpCache(std::size_t memory_limit)
+    : memory_limit_(memory_limit) {
+    // Potência de dois de posições dentro de um oitavo do orçamento
+    std::size_t count = 64;
+    while (count * 2 * sizeof(Slot) <= memory_limit / 8) {
+        count *= 2;
+    }
+    slots_.resize(count);
+}
+
+LpCacheKey LpCache::keyOf(const std::vector<std::pair<int, int>>& fixings) {
+    // A chave do conjunto vazio (raiz) não pode ser zero, que marca posição vazia
+    LpCacheKey key{mix(0), mix(CHECK_SEED)};
+    for (const auto& [var, value] : fixings) {
+        const std::uint64_t index = 2 * static_cast<std::uint64_t>(var) + static_cast<std::uint64_t>(value != 0);
+        key.hash ^= mix(index);
+        key.check ^= mix(index ^ CHECK_SEED);
+    }
+    if (key.hash == 0) {
+        key.hash = 1;
+    }
+    return key;
+}
+
+void LpCache::prepare(const ProblemModel& model, const std::vector<int>& original_columns) {
+    std::uint64_t structure = combine(static_cast<std::uint64_t>(model.numRows()),
+                                      static_cast<std::uint64_t>(model.numCols()));
+    for (const int col : original_columns) {
+        structure = combine(structure, static_cast<std::uint64_t>(col));
+    }
+    for (int row = 0; row < model.numRows(); ++row) {
+        structure = combine(structure, static_cast<std::uint64_t>(model.rowEnd(row) - model.rowStart(row)));
+        for (int k = model.rowStart(row); k < model.rowEnd(row); ++k) {
+            structure = combine(structure, static_cast<std::uint64_t>(model.rowCol(k)));
+            structure = combine(structure, bits(model.rowValue(k)));
+        }
+    }
+
+    if (structure != structure_) {
+        clear();
+        structure_ = structure;
+    } else {
+        // Mesmo objetivo e limites iguais ou mais apertados: a região de cada conjunto de fixações só
+        // encolheu, e os limites guardados continuam valendo
+        bool restricted = model.objective() == objective_ && model.objectiveConstant() == objective_constant_;
+        for (int row = 0; restricted && row < model.numRows(); ++row) {
+            restricted = model.rowLower(row) >= row_lower_[row] && model.rowUpper(row) <= row_upper_[row];
+        }
+        if (!restricted) {
+            ++epoch_;
+        }
+    }
+    row_lower_.assign(model.rowLowerData(), model.rowLowerData() + model.numRows());
+    row_upper_.assign(model.rowUpperData(), model.rowUpperData() + model.numRows());
+    objective_ = model.objective();
+    objective_constant_ = model.objectiveConstant();
+}
+
+bool LpCache::lookup(const LpCacheKey& key, CachedLp& result) const {
+    const std::size_t index = key.hash & (slots_.size() - 1);
+    std::lock_guard<std::mutex> lock(stripes_[index % STRIPES]);
+    const Slot& slot = slots_[index];
+    if (slot.hash != key.hash || slot.check != key.check) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    result.bound = slot.bound;
+    result.bound_valid = slot.epoch == epoch_;
+    result.basis = slot.basis;
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void LpCache::store(const LpCacheKey& key, double bound, std::shared_ptr<const LpBasis> basis) {
+    const std::size_t budget = memory_limit_ > slots_.size() * sizeof(Slot) ? memory_limit_ - slots_.size() * sizeof(Slot) : 0;
+    const std::size_t index = key.hash & (slots_.size() - 1);
+    std::lock_guard<std::mutex> lock(stripes_[index % STRIPES]);
+    Slot& slot = slots_[index];
+    if (slot.hash == 0) {
+        used_slots_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (slot.basis) {
+        basis_bytes_.fetch_sub(basisBytes(*slot.basis), std::memory_order_relaxed);
+    }
+    if (basis && basis_bytes_.load(std::memory_order_relaxed) + basisBytes(*basis) > budget) {
+        basis.reset();
+    }
+    if (basis) {
+        basis_bytes_.fetch_add(basisBytes(*basis), std::memory_order_relaxed);
+    }
+    slot.hash = key.hash;
+    slot.check = key.check;
+    slot.bound = bound;
+    slot.epoch = epoch_;
+    slot.basis = std::move(basis);
+}
+
+std::size_t LpCache::size() const {
+    return used_slots_.load(std::memory_order_relaxed);
+}
+
+std::size_t LpCache::memoryBytes() const {
+    return slots_.size() * sizeof(Slot) + basis_bytes_.load(std::memory_order_relaxed);
+}
+
+long long LpCache::hits() const {
+    return hits_.load(std::memory_order_relaxed);
+}
+
+long long LpCache::misses() const {
+    return misses_.load(std::memory_order_relaxed);
+}
+
+std::size_t LpCache::basisBytes(const LpBasis& basis) {
+    return sizeof(LpBasis) + (basis.row_stat.capacity() + basis.col_stat.capacity()) * sizeof(int);
+}
+
+void LpCache::clear() {
+    for (Slot& slot : slots_) {
+        slot = Slot{};
+    }
+    used_slots_.store(0, std::memory_order_relaxed);
+    basis_bytes_.store(0, std::memory_order_relaxed);
+    ++epoch_;
+}
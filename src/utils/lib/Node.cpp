@@ -0,0 +1,48 @@
+#include "Node.h"
+
+// Construtor principal
+Node::Node(
+    std::unique_ptr<GLPKSolver> solver,
+    FixingChain fixed,
+    double b,
+    NodeType t
+) : solver(std::move(solver)),
+    fixings(std::move(fixed)),
+    warm_basis(),
+    bound(b),
+    estimate(b),
+    depth(0),
+    type(t),
+    branch_var(-1),
+    branch_value(0),
+    branch_distance(0.0) {}
+
+// Construtor de movimento
+Node::Node(Node&& other) noexcept
+    : solver(std::move(other.solver)),
+      fixings(std::move(other.fixings)),
+      warm_basis(std::move(other.warm_basis)),
+      bound(other.bound),
+      estimate(other.estimate),
+      depth(other.depth),
+      type(other.type),
+      branch_var(other.branch_var),
+      branch_value(other.branch_value),
+      branch_distance(other.branch_distance) {}
+
+// Operador de atribuição por movimento
+Node& Node::operator=(Node&& other) noexcept {
+    if (this != &other) {
+        solver = std::move(other.solver);
+        fixings = std::move(other.fixings);
+        warm_basis = std::move(other.warm_basis);
+        bound = other.bound;
+        estimate = other.estimate;
+        depth = other.depth;
+        type = other.type;
+        branch_var = other.branch_var;
+        branch_value = other.branch_value;
+        branch_distance = other.branch_distance;
+    }
+    return *this;
+}
@@ -0,0 +1,367 @@
+#include "NodeSelector.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "Logger.h"
+
+namespace {
+    // Comparadores de heap: std::push_heap mantém o "maior" elemento no topo.
+    bool boundLess(const Node& a, const Node& b) {
+        if (a.bound != b.bound) {
+            return a.bound < b.bound;
+        }
+        return a.depth < b.depth;
+    }
+
+    bool estimateLess(const Node& a, const Node& b) {
+        if (a.estimate != b.estimate) {
+            return a.estimate < b.estimate;
+        }
+        return a.bound < b.bound;
+    }
+
+    template <typename Container>
+    double maxBound(const Container& nodes) {
+        double bound = -std::numeric_limits<double>::infinity();
+        for (const Node& node : nodes) {
+            bound = std::max(bound, node.bound);
+        }
+        return bound;
+    }
+
+    template <typename Compare>
+    void heapPush(std::vector<Node>& heap, Node&& node, Compare cmp) {
+        heap.push_back(std::move(node));
+        std::push_heap(heap.begin(), heap.end(), cmp);
+    }
+
+    template <typename Compare>
+    Node heapPop(std::vector<Node>& heap, Compare cmp) {
+        std::pop_heap(heap.begin(), heap.end(), cmp);
+        Node node = std::move(heap.back());
+        heap.pop_back();
+        return node;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Busca em profundidade
+// ---------------------------------------------------------------------------
+void DepthFirstSelector::push(Node&& node) {
+    stack_.push_back(std::move(node));
+}
+
+Node DepthFirstSelector::pop() {
+    Node node = std::move(stack_.back());
+    stack_.pop_back();
+    return node;
+}
+
+double DepthFirstSelector::bestBound() const {
+    return maxBound(stack_);
+}
+
+std::vector<Node> DepthFirstSelector::releaseAll() {
+    return std::exchange(stack_, {});
+}
+
+// ---------------------------------------------------------------------------
+// Busca em largura
+// ---------------------------------------------------------------------------
+void BreadthFirstSelector::push(Node&& node) {
+    queue_.push_back(std::move(node));
+}
+
+Node BreadthFirstSelector::pop() {
+    Node node = std::move(queue_.front());
+    queue_.pop_front();
+    return node;
+}
+
+double BreadthFirstSelector::bestBound() const {
+    return maxBound(queue_);
+}
+
+std::vector<Node> BreadthFirstSelector::releaseAll() {
+    std::vector<Node> nodes(std::make_move_iterator(queue_.begin()), std::make_move_iterator(queue_.end()));
+    queue_.clear();
+    return nodes;
+}
+
+// ---------------------------------------------------------------------------
+// Best-bound
+// ---------------------------------------------------------------------------
+void BestBoundSelector::push(Node&& node) {
+    heapPush(heap_, std::move(node), boundLess);
+}
+
+Node BestBoundSelector::pop() {
+    return heapPop(heap_, boundLess);
+}
+
+double BestBoundSelector::bestBound() const {
+    return heap_.empty() ? -std::numeric_limits<double>::infinity() : heap_.front().bound;
+}
+
+std::vector<Node> BestBoundSelector::releaseAll() {
+    return std::exchange(heap_, {});
+}
+
+// ---------------------------------------------------------------------------
+// Best-estimate
+// ---------------------------------------------------------------------------
+void BestEstimateSelector::push(Node&& node) {
+    heapPush(heap_, std::move(node), estimateLess);
+}
+
+Node BestEstimateSelector::pop() {
+    return heapPop(heap_, estimateLess);
+}
+
+double BestEstimateSelector::bestBound() const {
+    return maxBound(heap_);
+}
+
+std::vector<Node> BestEstimateSelector::releaseAll() {
+    return std::exchange(heap_, {});
+}
+
+// ---------------------------------------------------------------------------
+// Híbrida
+// ---------------------------------------------------------------------------
+HybridSelector::HybridSelector(int max_plunge_depth)
+    : max_plunge_depth_(max_plunge_depth),
+      plunge_count_(0),
+      has_incumbent_(false) {}
+
+void HybridSelector::push(Node&& node) {
+    plunge_.push_back(std::move(node));
+}
+
+Node HybridSelector::pop() {
+    // Sem incumbente: busca em profundidade pura
+    if (!has_incumbent_ && !plunge_.empty()) {
+        Node node = std::move(plunge_.back());
+        plunge_.pop_back();
+        return node;
+    }
+
+    // Continua o mergulho corrente enquanto não atingir o limite
+    if (!plunge_.empty() && plunge_count_ < max_plunge_depth_) {
+        ++plunge_count_;
+        Node node = std::move(plunge_.back());
+        plunge_.pop_back();
+        return node;
+    }
+
+    // Encerra o mergulho e recomeça a partir do melhor limite
+    flushPlunge();
+    plunge_count_ = 0;
+    return heapPop(heap_, boundLess);
+}
+
+double HybridSelector::bestBound() const {
+    const double heap_bound = heap_.empty() ? -std::numeric_limits<double>::infinity() : heap_.front().bound;
+    return std::max(maxBound(plunge_), heap_bound);
+}
+
+std::vector<Node> HybridSelector::releaseAll() {
+    flushPlunge();
+    plunge_count_ = 0;
+    return std::exchange(heap_, {});
+}
+
+void HybridSelector::onIncumbentUpdate(double /*objective*/) {
+    if (!has_incumbent_) {
+        has_incumbent_ = true;
+        flushPlunge();
+        plunge_count_ = 0;
+    }
+}
+
+void HybridSelector::flushPlunge() {
+    for (Node& node : plunge_) {
+        heapPush(heap_, std::move(node), boundLess);
+    }
+    plunge_.clear();
+}
+
+MemoryBoundedSelector::MemoryBoundedSelector(std::unique_ptr<NodeSelector> inner, std::size_t budget_bytes,
+                                             std::size_t problem_bytes, std::string spill_directory)
+    : inner_(std::move(inner)),
+      budget_(budget_bytes),
+      problem_bytes_(problem_bytes),
+      spill_file_(std::move(spill_directory)) {
+    if (!inner_) {
+        throw std::invalid_argument("Estratégia de seleção de nós nula");
+    }
+    if (budget_ == 0) {
+        throw std::invalid_argument("O orçamento de memória dos nós deve ser positivo");
+    }
+}
+
+void MemoryBoundedSelector::push(Node&& node) {
+    const double usage = static_cast<double>(bytes_);
+    if (usage >= COMPACT_FRACTION * budget_) {
+        compact(node);
+    }
+    bytes_ += nodeBytes(node);
+    peak_bytes_ = std::max(peak_bytes_, bytes_);
+    if (!plunging_ && static_cast<double>(bytes_) >= PLUNGE_FRACTION * budget_) {
+        BB_LOG_DEBUG("NodeSelector") << "Memória dos nós em " << bytes_ << " de " << budget_
+                                     << " bytes: mergulhando em profundidade.";
+        plunging_ = true;
+    }
+    if (plunging_) {
+        plunge_.push_back(std::move(node));
+    } else {
+        inner_->push(std::move(node));
+    }
+    if (bytes_ > budget_) {
+        spill();
+    }
+}
+
+Node MemoryBoundedSelector::pop() {
+    if (plunge_.empty() && inner_->empty()) {
+        reload();
+    }
+    Node node = [this] {
+        if (plunge_.empty()) {
+            return inner_->pop();
+        }
+        Node top = std::move(plunge_.back());
+        plunge_.pop_back();
+        return top;
+    }();
+    bytes_ -= nodeBytes(node);
+    if (plunging_ && static_cast<double>(bytes_) < COMPACT_FRACTION * budget_) {
+        endPlunge();
+    }
+    return node;
+}
+
+bool MemoryBoundedSelector::empty() const {
+    return plunge_.empty() && inner_->empty() && spill_file_.empty();
+}
+
+std::size_t MemoryBoundedSelector::size() const {
+    return plunge_.size() + inner_->size() + spill_file_.size();
+}
+
+double MemoryBoundedSelector::bestBound() const {
+    return std::max({maxBound(plunge_), inner_->bestBound(), spill_file_.bestBound()});
+}
+
+std::vector<Node> MemoryBoundedSelector::releaseAll() {
+    std::vector<Node> nodes = inner_->releaseAll();
+    std::move(plunge_.begin(), plunge_.end(), std::back_inserter(nodes));
+    plunge_.clear();
+    while (!spill_file_.empty()) {
+        nodes.push_back(spill_file_.readBest());
+    }
+    plunging_ = false;
+    bytes_ = 0;
+    return nodes;
+}
+
+void MemoryBoundedSelector::onIncumbentUpdate(double objective) {
+    // Descartar aqui, e não na leitura, mantém empty() e size() exatos
+    spill_file_.discardDominated(objective);
+    inner_->onIncumbentUpdate(objective);
+}
+
+std::size_t MemoryBoundedSelector::nodeBytes(const Node& node) const {
+    // Só o último elo das fixações é do nó: os anteriores são compartilhados com os ancestrais
+    std::size_t bytes = sizeof(Node) + (node.fixings.empty() ? 0 : sizeof(FixingLink));
+    if (node.solver) {
+        bytes += problem_bytes_;
+    }
+    if (node.warm_basis) {
+        bytes += (node.warm_basis->row_stat.size() + node.warm_basis->col_stat.size()) * sizeof(int) / 2;
+    }
+    return bytes;
+}
+
+std::size_t MemoryBoundedSelector::estimateProblemBytes(int rows, int cols, int nonzeros) {
+    // O GLPK guarda cada elemento da matriz em listas duplamente ligadas por linha e por coluna
+    // (~56 bytes) e cada linha ou coluna com nome, limites, coeficiente e estado (~160 bytes)
+    return 56 * static_cast<std::size_t>(std::max(nonzeros, 0)) +
+           160 * static_cast<std::size_t>(std::max(rows, 0) + std::max(cols, 0)) + 1024;
+}
+
+void MemoryBoundedSelector::compact(Node& node) {
+    if (!node.solver && !node.warm_basis) {
+        return;
+    }
+    node.solver.reset();
+    node.warm_basis.reset();
+    ++compacted_;
+}
+
+void MemoryBoundedSelector::spill() {
+    // Compacta todos os nós em memória e grava os de menor limite; o mergulho corrente fica em memória
+    const auto compactCounted = [this](Node& node) {
+        const std::size_t before = nodeBytes(node);
+        compact(node);
+        bytes_ -= before - nodeBytes(node);
+    };
+    std::for_each(plunge_.begin(), plunge_.end(), compactCounted);
+    std::vector<Node> nodes = inner_->releaseAll();
+    std::for_each(nodes.begin(), nodes.end(), compactCounted);
+    std::sort(nodes.begin(), nodes.end(), boundLess);
+
+    std::size_t first_kept = 0;
+    const long long written_before = spilled_;
+    while (first_kept < nodes.size() && static_cast<double>(bytes_) > COMPACT_FRACTION * budget_) {
+        const Node& node = nodes[first_kept++];
+        spill_file_.write(node);
+        bytes_ -= nodeBytes(node);
+        ++spilled_;
+    }
+    // Do pior para o melhor: numa pilha o melhor limite fica no topo
+    for (std::size_t k = first_kept; k < nodes.size(); ++k) {
+        inner_->push(std::move(nodes[k]));
+    }
+    BB_LOG_DEBUG("NodeSelector") << "Transbordo: " << spilled_ - written_before
+                                 << " nós gravados em disco (" << spill_file_.size() << " no arquivo, "
+                                 << size() - spill_file_.size() << " em memória, " << bytes_ << " bytes).";
+}
+
+void MemoryBoundedSelector::reload() {
+    // Lê pelo menos um nó; chamado apenas com a memória vazia e o arquivo não vazio
+    do {
+        Node node = spill_file_.readBest();
+        bytes_ += nodeBytes(node);
+        inner_->push(std::move(node));
+    } while (!spill_file_.empty() && static_cast<double>(bytes_) < RELOAD_FRACTION * budget_);
+    peak_bytes_ = std::max(peak_bytes_, bytes_);
+    BB_LOG_DEBUG("NodeSelector") << "Recarregados " << inner_->size() << " nós do disco ("
+                                 << spill_file_.size() << " restantes).";
+}
+
+void MemoryBoundedSelector::endPlunge() {
+    for (Node& node : plunge_) {
+        inner_->push(std::move(node));
+    }
+    plunge_.clear();
+    plunging_ = false;
+}
+
+std::unique_ptr<NodeSelector> makeNodeSelector(NodeSelection selection, int max_plunge_depth) {
+    switch (selection) {
+        case NodeSelection::DEPTH_FIRST:
+            return std::make_unique<DepthFirstSelector>();
+        case NodeSelection::BREADTH_FIRST:
+            return std::make_unique<BreadthFirstSelector>();
+        case NodeSelection::BEST_BOUND:
+            return std::make_unique<BestBoundSelector>();
+        case NodeSelection::BEST_ESTIMATE:
+            return std::make_unique<BestEstimateSelector>();
+        case NodeSelection::HYBRID:
+            return std::make_unique<HybridSelector>(max_plunge_depth);
+    }
+    throw std::invalid_argument("Estratégia de seleção de nós desconhecida");
+}
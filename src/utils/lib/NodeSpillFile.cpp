@@ -0,0 +1,147 @@
+#include "NodeSpillFile.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+    // Cabeçalho fixo de cada registro, seguido de num_fixed pares (variável, valor) em int32
+    struct RecordHeader {
+        double bound;
+        double estimate;
+        double branch_distance;
+        std::int32_t depth;
+        std::int32_t type;
+        std::int32_t branch_var;
+        std::int32_t branch_value;
+        std::uint32_t num_fixed;
+        std::uint32_t reserved;
+    };
+
+}
+
+bool NodeSpillFile::BoundLess::operator()(const Entry& a, const Entry& b) const {
+    return a.bound < b.bound;
+}
+
+NodeSpillFile::NodeSpillFile(std::string directory)
+    : directory_(std::move(directory)) {}
+
+NodeSpillFile::~NodeSpillFile() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void NodeSpillFile::open() {
+    const std::filesystem::path directory =
+        directory_.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(directory_);
+    std::string path = (directory / "bb_spill_XXXXXX").string();
+    fd_ = ::mkstemp(path.data());
+    if (fd_ < 0) {
+        throw std::runtime_error("Falha ao criar o arquivo de transbordo de nós em " + directory.string() + ": " +
+                                 std::strerror(errno));
+    }
+    // Sem nome no diretório: o espaço é liberado ao fechar, inclusive se o processo terminar de forma anormal
+    ::unlink(path.c_str());
+}
+
+void NodeSpillFile::write(const Node& node) {
+    if (fd_ < 0) {
+        open();
+    }
+    RecordHeader header{};
+    header.bound = node.bound;
+    header.estimate = node.estimate;
+    header.branch_distance = node.branch_distance;
+    header.depth = node.depth;
+    header.type = static_cast<std::int32_t>(node.type);
+    header.branch_var = node.branch_var;
+    header.branch_value = node.branch_value;
+    node.fixings.materialize(fixings_);
+    if (node.fixings.arena()) {
+        arena_ = node.fixings.arena();
+    }
+    header.num_fixed = static_cast<std::uint32_t>(fixings_.size());
+
+    const std::size_t size = sizeof(header) + fixings_.size() * 2 * sizeof(std::int32_t);
+    buffer_.resize(size);
+    std::memcpy(buffer_.data(), &header, sizeof(header));
+    char* cursor = buffer_.data() + sizeof(header);
+    for (const auto& [var, value] : fixings_) {
+        const std::int32_t pair[2] = {var, value};
+        std::memcpy(cursor, pair, sizeof(pair));
+        cursor += sizeof(pair);
+    }
+
+    if (::pwrite(fd_, buffer_.data(), size, static_cast<off_t>(end_)) != static_cast<ssize_t>(size)) {
+        throw std::runtime_error(std::string("Falha ao gravar o arquivo de transbordo de nós: ") + std::strerror(errno));
+    }
+    index_.push_back(Entry{node.bound, end_, static_cast<std::uint32_t>(size)});
+    std::push_heap(index_.begin(), index_.end(), BoundLess{});
+    end_ += size;
+}
+
+Node NodeSpillFile::readBest() {
+    std::pop_heap(index_.begin(), index_.end(), BoundLess{});
+    const Entry entry = index_.back();
+    index_.pop_back();
+
+    buffer_.resize(entry.size);
+    if (::pread(fd_, buffer_.data(), entry.size, static_cast<off_t>(entry.offset)) != static_cast<ssize_t>(entry.size)) {
+        throw std::runtime_error(std::string("Falha ao ler o arquivo de transbordo de nós: ") + std::strerror(errno));
+    }
+    RecordHeader header;
+    std::memcpy(&header, buffer_.data(), sizeof(header));
+    fixings_.resize(header.num_fixed);
+    const char* cursor = buffer_.data() + sizeof(header);
+    for (auto& [var, value] : fixings_) {
+        std::int32_t pair[2];
+        std::memcpy(pair, cursor, sizeof(pair));
+        cursor += sizeof(pair);
+        var = pair[0];
+        value = pair[1];
+    }
+
+    Node node(nullptr, fixings_.empty() ? FixingChain() : arena_->make(fixings_), header.bound,
+              static_cast<NodeType>(header.type));
+    node.estimate = header.estimate;
+    node.depth = header.depth;
+    node.branch_var = header.branch_var;
+    node.branch_value = header.branch_value;
+    node.branch_distance = header.branch_distance;
+
+    // Todos os nós lidos: o espaço do arquivo pode ser reaproveitado
+    if (index_.empty()) {
+        end_ = 0;
+        if (::ftruncate(fd_, 0) != 0) {
+            throw std::runtime_error(std::string("Falha ao truncar o arquivo de transbordo de nós: ") +
+                                     std::strerror(errno));
+        }
+    }
+    return node;
+}
+
+std::size_t NodeSpillFile::discardDominated(double cutoff) {
+    const std::size_t before = index_.size();
+    index_.erase(std::remove_if(index_.begin(), index_.end(),
+                                [cutoff](const Entry& entry) { return entry.bound <= cutoff; }),
+                 index_.end());
+    std::make_heap(index_.begin(), index_.end(), BoundLess{});
+    if (index_.empty() && fd_ >= 0 && end_ > 0) {
+        end_ = 0;
+        if (::ftruncate(fd_, 0) != 0) {
+            throw std::runtime_error(std::string("Falha ao truncar o arquivo de transbordo de nós: ") +
+                                     std::strerror(errno));
+        }
+    }
+    return before - index_.size();
+}
+
+double NodeSpillFile::bestBound() const {
+    return index_.empty() ? -std::numeric_limits<double>::infinity() : index_.front().bound;
+}
@@ -0,0 +1,352 @@
+#include "Presolve.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "Logger.h"
+#include "ProblemModel.h"
+
+namespace {
+    constexpr double FEASIBILITY_TOLERANCE = 1e-6;
+    constexpr int MAX_PASSES = 20;
+
+    // Orçamento de operações da comparação de colunas par a par
+    constexpr double DOMINANCE_WORK_LIMIT = 5e7;
+
+    constexpr std::int8_t FREE = -1;
+
+    struct PresolveRow {
+        std::vector<int> cols;
+        std::vector<double> coefs;
+        double lower;
+        double upper;
+        bool alive = true;
+    };
+
+    // Entrada de uma coluna nas linhas vivas (em ordem crescente de linha)
+    struct ColumnEntry {
+        int row;
+        double coef;
+    };
+}
+
+std::vector<int> Postsolve::restore(const std::vector<int>& reduced_solution) const {
+    std::vector<int> solution(fixed_value_.size());
+    for (size_t j = 0; j < fixed_value_.size(); ++j) {
+        solution[j] = fixed_value_[j] < 0 ? 0 : fixed_value_[j];
+    }
+    for (size_t k = 0; k < original_index_.size(); ++k) {
+        solution[original_index_[k]] = reduced_solution[k];
+    }
+    return solution;
+}
+
+GLPProbPtr Presolver::run(glp_prob* problem, Postsolve& postsolve) {
+    stats_ = PresolveStats{};
+    const ProblemModel model = ProblemModel::fromGlpk(problem);
+    const int num_cols = model.numCols();
+    const int num_rows = model.numRows();
+
+    std::vector<PresolveRow> rows(static_cast<size_t>(num_rows));
+    for (int i = 0; i < num_rows; ++i) {
+        for (int k = model.rowStart(i); k < model.rowEnd(i); ++k) {
+            rows[i].cols.push_back(model.rowCol(k));
+            rows[i].coefs.push_back(model.rowValue(k));
+        }
+        rows[i].lower = model.rowLower(i);
+        rows[i].upper = model.rowUpper(i);
+    }
+    std::vector<std::int8_t> value(static_cast<size_t>(num_cols), FREE);
+
+    auto activity = [&](const PresolveRow& row, double& min_activity, double& max_activity) {
+        min_activity = 0.0;
+        max_activity = 0.0;
+        for (size_t k = 0; k < row.cols.size(); ++k) {
+            const double a = row.coefs[k];
+            if (value[row.cols[k]] != FREE) {
+                min_activity += a * value[row.cols[k]];
+                max_activity += a * value[row.cols[k]];
+            } else {
+                min_activity += std::min(0.0, a);
+                max_activity += std::max(0.0, a);
+            }
+        }
+    };
+
+    bool infeasible = false;
+    bool changed = true;
+    auto fix = [&](int col, int fixed_value) {
+        value[col] = static_cast<std::int8_t>(fixed_value);
+        changed = true;
+    };
+
+    while (changed && !infeasible && stats_.passes < MAX_PASSES) {
+        changed = false;
+        ++stats_.passes;
+
+        // Propagação, linhas redundantes e redução de coeficientes
+        for (PresolveRow& row : rows) {
+            if (!row.alive) {
+                continue;
+            }
+            double min_activity;
+            double max_activity;
+            activity(row, min_activity, max_activity);
+            if (min_activity > row.upper + FEASIBILITY_TOLERANCE ||
+                max_activity < row.lower - FEASIBILITY_TOLERANCE) {
+                infeasible = true;
+                break;
+            }
+            for (size_t k = 0; k < row.cols.size(); ++k) {
+                const int col = row.cols[k];
+                if (value[col] != FREE) {
+                    continue;
+                }
+                const double a = std::abs(row.coefs[k]);
+                if (min_activity + a > row.upper + FEASIBILITY_TOLERANCE) {
+                    fix(col, row.coefs[k] > 0.0 ? 0 : 1);
+                } else if (max_activity - a < row.lower - FEASIBILITY_TOLERANCE) {
+                    fix(col, row.coefs[k] > 0.0 ? 1 : 0);
+                } else {
+                    continue;
+                }
+                ++stats_.fixed_cols;
+                activity(row, min_activity, max_activity);
+            }
+
+            if (max_activity <= row.upper + FEASIBILITY_TOLERANCE &&
+                min_activity >= row.lower - FEASIBILITY_TOLERANCE) {
+                // Redundante (inclui as linhas sem variáveis livres, que já foram conferidas acima)
+                row.alive = false;
+                ++stats_.removed_rows;
+                changed = true;
+                continue;
+            }
+
+            // Redução de coeficientes: com x_j = 0 a linha <= fica redundante, então a_j e b caem juntos
+            if (std::isfinite(row.lower)) {
+                continue;
+            }
+            for (size_t k = 0; k < row.cols.size(); ++k) {
+                const double a = row.coefs[k];
+                if (value[row.cols[k]] != FREE || a <= 0.0) {
+                    continue;
+                }
+                const double excess = row.upper - (max_activity - a);
+                if (excess > FEASIBILITY_TOLERANCE) {
+                    row.coefs[k] -= excess;
+                    row.upper -= excess;
+                    max_activity -= excess;
+                    ++stats_.tightened_coefs;
+                    changed = true;
+                }
+            }
+        }
+        if (infeasible) {
+            break;
+        }
+
+        // Travas de cada coluna nas linhas vivas
+        std::vector<std::vector<ColumnEntry>> columns(static_cast<size_t>(num_cols));
+        std::vector<int> up_locks(static_cast<size_t>(num_cols), 0);
+        std::vector<int> down_locks(static_cast<size_t>(num_cols), 0);
+        std::vector<char> only_upper_rows(static_cast<size_t>(num_cols), 1);
+        for (int i = 0; i < num_rows; ++i) {
+            const PresolveRow& row = rows[i];
+            if (!row.alive) {
+                continue;
+            }
+            const bool has_upper = std::isfinite(row.upper);
+            const bool has_lower = std::isfinite(row.lower);
+            for (size_t k = 0; k < row.cols.size(); ++k) {
+                const int col = row.cols[k];
+                const double a = row.coefs[k];
+                if (value[col] != FREE || a == 0.0) {
+                    continue;
+                }
+                columns[col].push_back({i, a});
+                up_locks[col] += a > 0.0 ? has_upper : has_lower;
+                down_locks[col] += a > 0.0 ? has_lower : has_upper;
+                if (has_lower) {
+                    only_upper_rows[col] = 0;
+                }
+            }
+        }
+
+        // Fixação dual: o lado sem travas nunca viola linhas, então basta o sinal do custo
+        for (int j = 0; j < num_cols; ++j) {
+            if (value[j] != FREE) {
+                continue;
+            }
+            const double c = model.objective(j);
+            if (c <= 0.0 && down_locks[j] == 0) {
+                fix(j, 0);
+            } else if (c >= 0.0 && up_locks[j] == 0) {
+                fix(j, 1);
+            } else {
+                continue;
+            }
+            ++stats_.fixed_cols;
+        }
+        if (changed) {
+            continue;
+        }
+
+        // Colunas dominadas: só quando as reduções baratas não encontram mais nada
+        std::vector<int> candidates;
+        double total_entries = 0.0;
+        for (int j = 0; j < num_cols; ++j) {
+            if (value[j] == FREE && only_upper_rows[j]) {
+                candidates.push_back(j);
+                total_entries += static_cast<double>(columns[j].size());
+            }
+        }
+        const double work = static_cast<double>(candidates.size()) * total_entries;
+        if (candidates.size() < 2 || work > DOMINANCE_WORK_LIMIT) {
+            continue;
+        }
+        std::vector<double> min_activity(static_cast<size_t>(num_rows), 0.0);
+        for (int i = 0; i < num_rows; ++i) {
+            if (rows[i].alive) {
+                double max_activity;
+                activity(rows[i], min_activity[i], max_activity);
+            }
+        }
+
+        // j domina k se c_j >= c_k e a_ij <= a_ik em todas as linhas; com conflito entre as duas,
+        // trocar k por j em uma solução com x_k = 1 mantém a viabilidade e não piora o objetivo
+        auto dominates = [&](int j, int k, bool& conflict) {
+            const std::vector<ColumnEntry>& cj = columns[j];
+            const std::vector<ColumnEntry>& ck = columns[k];
+            bool identical = model.objective(j) == model.objective(k);
+            conflict = false;
+            size_t p = 0;
+            size_t q = 0;
+            while (p < cj.size() || q < ck.size()) {
+                const int row_j = p < cj.size() ? cj[p].row : num_rows;
+                const int row_k = q < ck.size() ? ck[q].row : num_rows;
+                const int row = std::min(row_j, row_k);
+                const double aj = row_j == row ? cj[p++].coef : 0.0;
+                const double ak = row_k == row ? ck[q++].coef : 0.0;
+                if (aj > ak) {
+                    return false;
+                }
+                identical = identical && aj == ak;
+                const double rest = min_activity[row] - std::min(0.0, aj) - std::min(0.0, ak);
+                if (aj + ak + rest > rows[row].upper + FEASIBILITY_TOLERANCE) {
+                    conflict = true;
+                }
+            }
+            // Colunas idênticas: apenas a de maior índice é eliminada
+            return !identical || j < k;
+        };
+
+        for (int k : candidates) {
+            for (int j : candidates) {
+                if (j == k || value[j] != FREE || value[k] != FREE ||
+                    model.objective(j) < model.objective(k)) {
+                    continue;
+                }
+                bool conflict;
+                if (dominates(j, k, conflict) && conflict) {
+                    fix(k, 0);
+                    ++stats_.dominated_cols;
+                    for (const ColumnEntry& entry : columns[k]) {
+                        min_activity[entry.row] -= std::min(0.0, entry.coef);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    if (infeasible) {
+        BB_LOG_INFO("Presolve") << "Presolve provou que o problema é inviável.";
+        return nullptr;
+    }
+
+    // Mapeamento das colunas
+    postsolve.original_index_.clear();
+    postsolve.fixed_value_.assign(static_cast<size_t>(num_cols), -1);
+    std::vector<int> reduced_index(static_cast<size_t>(num_cols), -1);
+    double objective_constant = model.objectiveConstant();
+    for (int j = 0; j < num_cols; ++j) {
+        if (value[j] == FREE) {
+            reduced_index[j] = static_cast<int>(postsolve.original_index_.size());
+            postsolve.original_index_.push_back(j);
+        } else {
+            postsolve.fixed_value_[j] = value[j];
+            objective_constant += model.objective(j) * value[j];
+        }
+    }
+
+    // Problema reduzido: colunas livres, linhas vivas com as fixações levadas ao lado direito
+    GLPProbPtr reduced(glp_create_prob());
+    glp_set_obj_dir(reduced.get(), glp_get_obj_dir(problem));
+    glp_set_obj_coef(reduced.get(), 0, objective_constant);
+    const int reduced_cols = postsolve.reducedCols();
+    if (reduced_cols > 0) {
+        glp_add_cols(reduced.get(), reduced_cols);
+    }
+    for (int k = 0; k < reduced_cols; ++k) {
+        const int col = postsolve.original_index_[k] + 1;
+        glp_set_col_bnds(reduced.get(), k + 1, glp_get_col_type(problem, col),
+                         glp_get_col_lb(problem, col), glp_get_col_ub(problem, col));
+        glp_set_obj_coef(reduced.get(), k + 1, model.objective(col - 1));
+        if (const char* name = glp_get_col_name(problem, col)) {
+            glp_set_col_name(reduced.get(), k + 1, name);
+        }
+    }
+
+    std::vector<int> indices;
+    std::vector<double> values;
+    for (PresolveRow& row : rows) {
+        if (!row.alive) {
+            continue;
+        }
+        double fixed_activity = 0.0;
+        indices.assign(1, 0);
+        values.assign(1, 0.0);
+        for (size_t k = 0; k < row.cols.size(); ++k) {
+            const int col = row.cols[k];
+            if (value[col] != FREE) {
+                fixed_activity += row.coefs[k] * value[col];
+            } else if (row.coefs[k] != 0.0) {
+                indices.push_back(reduced_index[col] + 1);
+                values.push_back(row.coefs[k]);
+            }
+        }
+        const double lower = row.lower - fixed_activity;
+        const double upper = row.upper - fixed_activity;
+        if (indices.size() == 1) {
+            // Sem variáveis livres (pode ocorrer ao atingir o limite de passadas)
+            if (fixed_activity > row.upper + FEASIBILITY_TOLERANCE ||
+                fixed_activity < row.lower - FEASIBILITY_TOLERANCE) {
+                BB_LOG_INFO("Presolve") << "Presolve provou que o problema é inviável.";
+                return nullptr;
+            }
+            ++stats_.removed_rows;
+            continue;
+        }
+        int type;
+        if (std::isfinite(lower) && std::isfinite(upper)) {
+            type = lower == upper ? GLP_FX : GLP_DB;
+        } else if (std::isfinite(upper)) {
+            type = GLP_UP;
+        } else {
+            type = GLP_LO;
+        }
+        const int new_row = glp_add_rows(reduced.get(), 1);
+        glp_set_mat_row(reduced.get(), new_row, static_cast<int>(indices.size()) - 1,
+                        indices.data(), values.data());
+        glp_set_row_bnds(reduced.get(), new_row, type,
+                         std::isfinite(lower) ? lower : 0.0, std::isfinite(upper) ? upper : 0.0);
+    }
+
+    BB_LOG_INFO("Presolve") << "Presolve: " << stats_.fixed_cols + stats_.dominated_cols
+                            << " variáveis fixadas (" << stats_.dominated_cols << " por dominância), "
+                            << stats_.removed_rows << " linhas removidas, " << stats_.tightened_coefs
+                            << " coeficientes reduzidos em " << stats_.passes << " passadas; restam "
+                            << reduced_cols << " variáveis e " << glp_get_num_rows(reduced.get())
+                            << " linhas.";
+    return reduced;
+}
@@ -0,0 +1,187 @@
+#include "ProblemModel.h"
+#include <limits>
+#include <stdexcept>
+#include "SimdKernels.h"
+
+namespace {
+    // A cópia densa só é construída com pelo menos metade dos coeficientes não nulos
+    // e até ProblemModel::DENSE_MAX_ENTRIES posições
+    constexpr double DENSE_MIN_DENSITY = 0.5;
+    constexpr int DENSE_ALIGNMENT = 8; // doubles por linha de cache
+}
+
+ProblemModel ProblemModel::fromGlpk(glp_prob* problem) {
+    if (!problem) {
+        throw std::invalid_argument("ProblemModel requer um problema GLPK não nulo");
+    }
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    ProblemModel model;
+    model.num_rows_ = glp_get_num_rows(problem);
+    model.num_cols_ = glp_get_num_cols(problem);
+    model.maximize_ = glp_get_obj_dir(problem) == GLP_MAX;
+
+    model.objective_.resize(model.num_cols_);
+    for (int j = 1; j <= model.num_cols_; ++j) {
+        model.objective_[j - 1] = glp_get_obj_coef(problem, j);
+    }
+    model.objective_constant_ = glp_get_obj_coef(problem, 0);
+
+    // Linhas: um único buffer reaproveitado para todas as chamadas de glp_get_mat_row
+    std::vector<int> indices(model.num_cols_ + 1);
+    std::vector<double> values(model.num_cols_ + 1);
+    std::vector<int> col_count(model.num_cols_, 0);
+    model.row_start_.reserve(model.num_rows_ + 1);
+    model.row_start_.push_back(0);
+    model.row_lower_.resize(model.num_rows_);
+    model.row_upper_.resize(model.num_rows_);
+    for (int i = 1; i <= model.num_rows_; ++i) {
+        const int len = glp_get_mat_row(problem, i, indices.data(), values.data());
+        for (int k = 1; k <= len; ++k) {
+            if (values[k] == 0.0) {
+                continue;
+            }
+            model.row_cols_.push_back(indices[k] - 1);
+            model.row_values_.push_back(values[k]);
+            ++col_count[indices[k] - 1];
+        }
+        model.row_start_.push_back(static_cast<int>(model.row_cols_.size()));
+
+        const int type = glp_get_row_type(problem, i);
+        const bool has_lower = type == GLP_LO || type == GLP_DB || type == GLP_FX;
+        const bool has_upper = type == GLP_UP || type == GLP_DB || type == GLP_FX;
+        model.row_lower_[i - 1] = has_lower ? glp_get_row_lb(problem, i) : -INF;
+        model.row_upper_[i - 1] = has_upper ? glp_get_row_ub(problem, i) : INF;
+    }
+
+    // Colunas: transposição da CSR
+    model.col_start_.assign(model.num_cols_ + 1, 0);
+    for (int j = 0; j < model.num_cols_; ++j) {
+        model.col_start_[j + 1] = model.col_start_[j] + col_count[j];
+    }
+    model.col_rows_.resize(model.row_cols_.size());
+    model.col_values_.resize(model.row_cols_.size());
+    std::vector<int> next(model.col_start_.begin(), model.col_start_.end() - 1);
+    for (int i = 0; i < model.num_rows_; ++i) {
+        for (int k = model.row_start_[i]; k < model.row_start_[i + 1]; ++k) {
+            const int pos = next[model.row_cols_[k]]++;
+            model.col_rows_[pos] = i;
+            model.col_values_[pos] = model.row_values_[k];
+        }
+    }
+
+    // Cópia densa por linhas para os kernels vetoriais
+    const int stride = (model.num_cols_ + DENSE_ALIGNMENT - 1) / DENSE_ALIGNMENT * DENSE_ALIGNMENT;
+    const size_t dense_entries = static_cast<size_t>(model.num_rows_) * stride;
+    const double density = model.num_rows_ > 0 && model.num_cols_ > 0
+        ? static_cast<double>(model.row_cols_.size()) / (static_cast<double>(model.num_rows_) * model.num_cols_)
+        : 0.0;
+    if (density >= DENSE_MIN_DENSITY && dense_entries <= DENSE_MAX_ENTRIES) {
+        model.dense_stride_ = stride;
+        model.dense_.assign(dense_entries, 0.0);
+        for (int i = 0; i < model.num_rows_; ++i) {
+            double* row = model.dense_.data() + static_cast<size_t>(i) * stride;
+            for (int k = model.row_start_[i]; k < model.row_start_[i + 1]; ++k) {
+                row[model.row_cols_[k]] = model.row_values_[k];
+            }
+        }
+    }
+    return model;
+}
+
+double ProblemModel::rowActivity(int row, const int* solution) const noexcept {
+    if (!dense_.empty()) {
+        return simd::dot(denseRow(row), solution, num_cols_);
+    }
+    const int start = row_start_[row];
+    return simd::sparseDot(row_values_.data() + start, row_cols_.data() + start,
+                           row_start_[row + 1] - start, solution);
+}
+
+double ProblemModel::rowActivity(int row, const double* solution) const noexcept {
+    if (!dense_.empty()) {
+        return simd::dot(denseRow(row), solution, num_cols_);
+    }
+    const int start = row_start_[row];
+    return simd::sparseDot(row_values_.data() + start, row_cols_.data() + start,
+                           row_start_[row + 1] - start, solution);
+}
+
+double ProblemModel::objectiveValue(const std::vector<int>& solution) const {
+    double value = objective_constant_;
+    for (int j = 0; j < num_cols_; ++j) {
+        if (solution[j] != 0) {
+            value += objective_[j] * solution[j];
+        }
+    }
+    return value;
+}
+
+bool ProblemModel::isFeasible(const std::vector<int>& solution, double tolerance) const {
+    if (static_cast<int>(solution.size()) != num_cols_) {
+        return false;
+    }
+    for (int i = 0; i < num_rows_; ++i) {
+        const double activity = rowActivity(i, solution.data());
+        if (activity > row_upper_[i] + tolerance || activity < row_lower_[i] - tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+RowActivity::RowActivity(const ProblemModel& model, const std::vector<int>& solution, double tolerance)
+    : model_(model),
+      tolerance_(tolerance),
+      activity_(static_cast<size_t>(model.numRows()), 0.0) {
+    assign(solution);
+}
+
+void RowActivity::assign(const std::vector<int>& solution) {
+    for (int i = 0; i < model_.numRows(); ++i) {
+        activity_[i] = model_.rowActivity(i, solution.data());
+    }
+}
+
+void RowActivity::add(int col) noexcept {
+    for (int k = model_.colStart(col); k < model_.colEnd(col); ++k) {
+        activity_[model_.colRow(k)] += model_.colValue(k);
+    }
+}
+
+void RowActivity::remove(int col) noexcept {
+    for (int k = model_.colStart(col); k < model_.colEnd(col); ++k) {
+        activity_[model_.colRow(k)] -= model_.colValue(k);
+    }
+}
+
+bool RowActivity::canAdd(int col) const noexcept {
+    for (int k = model_.colStart(col); k < model_.colEnd(col); ++k) {
+        const int row = model_.colRow(k);
+        const double a = model_.colValue(k);
+        const double updated = activity_[row] + a;
+        if ((a > 0.0 && updated > model_.rowUpper(row) + tolerance_) ||
+            (a < 0.0 && updated < model_.rowLower(row) - tolerance_)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RowActivity::canRemove(int col) const noexcept {
+    for (int k = model_.colStart(col); k < model_.colEnd(col); ++k) {
+        const int row = model_.colRow(k);
+        const double a = model_.colValue(k);
+        const double updated = activity_[row] - a;
+        if ((a < 0.0 && updated > model_.rowUpper(row) + tolerance_) ||
+            (a > 0.0 && updated < model_.rowLower(row) - tolerance_)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RowActivity::feasible() const noexcept {
+    return !simd::anyOutside(activity_.data(), model_.rowLowerData(), model_.rowUpperData(),
+                             model_.numRows(), tolerance_);
+}
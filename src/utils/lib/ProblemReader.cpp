@@ -1,89 +1,1034 @@
-
 #include "ProblemReader.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+#include "BinaryInstance.h"
+#include "MappedFile.h"
 
-glp_prob* ProblemReader::read(const std::string &filepath) {
+namespace {
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    // Formulação intermediária (índices base 0), carregada no GLPK de uma só vez
+    struct ProblemData {
+        bool maximize = true;
+        double objective_constant = 0.0;
+        std::vector<double> objective;
+        std::vector<double> col_lower;
+        std::vector<double> col_upper;
+        std::vector<char> col_integer;      // Integralidade declarada (marcadores INTORG, BV/LI/UI, seções Binary/General)
+        std::vector<std::string> col_names; // Vazio quando o formato não nomeia as colunas
+        std::vector<double> row_lower;
+        std::vector<double> row_upper;
+        std::vector<int> entry_row;
+        std::vector<int> entry_col;
+        std::vector<double> entry_value;
+
+        int addCol(std::string_view name, double lower, double upper) {
+            objective.push_back(0.0);
+            col_lower.push_back(lower);
+            col_upper.push_back(upper);
+            col_integer.push_back(0);
+            col_names.emplace_back(name);
+            return static_cast<int>(objective.size()) - 1;
+        }
+
+        int addRow(double lower, double upper) {
+            row_lower.push_back(lower);
+            row_upper.push_back(upper);
+            return static_cast<int>(row_lower.size()) - 1;
+        }
+
+        void addEntry(int row, int col, double value) {
+            if (value != 0.0) {
+                entry_row.push_back(row);
+                entry_col.push_back(col);
+                entry_value.push_back(value);
+            }
+        }
+    };
 
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open the file: " + filepath);
+    std::string colLabel(const ProblemData& data, int col) {
+        if (!data.col_names.empty() && !data.col_names[col].empty()) {
+            return data.col_names[col];
+        }
+        return "x" + std::to_string(col + 1);
     }
 
-    // Ponteiro com o problema que será retornado
-    glp_prob *lp = glp_create_prob();
+    std::string formatBound(double value) {
+        if (std::isinf(value)) {
+            return value > 0 ? "inf" : "-inf";
+        }
+        std::string text = std::to_string(value);
+        text.erase(text.find_last_not_of('0') + 1);
+        if (text.back() == '.') {
+            text.pop_back();
+        }
+        return text;
+    }
+
+    // Cria o problema GLPK; entradas repetidas de uma mesma (linha, coluna) são somadas
+    glp_prob* load(const ProblemData& data) {
+        const int num_rows = static_cast<int>(data.row_lower.size());
+        const int num_cols = static_cast<int>(data.objective.size());
+        for (int j = 0; j < num_cols; ++j) {
+            if (!data.col_integer[j]) {
+                throw std::invalid_argument("A variável " + colLabel(data, j) +
+                                            " é contínua; apenas variáveis binárias são suportadas.");
+            }
+            if (data.col_lower[j] < 0.0 || data.col_upper[j] > 1.0 || data.col_lower[j] > data.col_upper[j]) {
+                throw std::invalid_argument("A variável " + colLabel(data, j) + " não é binária (limites [" +
+                                            formatBound(data.col_lower[j]) + ", " +
+                                            formatBound(data.col_upper[j]) + "]).");
+            }
+        }
+
+        // Matriz por linhas (ordenação por contagem) para eliminar duplicatas
+        std::vector<int> row_start(static_cast<size_t>(num_rows) + 1, 0);
+        for (int row : data.entry_row) {
+            ++row_start[row + 1];
+        }
+        for (int i = 0; i < num_rows; ++i) {
+            row_start[i + 1] += row_start[i];
+        }
+        std::vector<int> order(data.entry_row.size());
+        std::vector<int> next(row_start.begin(), row_start.end() - 1);
+        for (size_t k = 0; k < data.entry_row.size(); ++k) {
+            order[next[data.entry_row[k]]++] = static_cast<int>(k);
+        }
+
+        std::vector<int> ia(1, 0);
+        std::vector<int> ja(1, 0);
+        std::vector<double> ar(1, 0.0);
+        ia.reserve(order.size() + 1);
+        ja.reserve(order.size() + 1);
+        ar.reserve(order.size() + 1);
+        std::vector<int> position(static_cast<size_t>(num_cols), -1);
+        for (int i = 0; i < num_rows; ++i) {
+            const size_t first = ar.size();
+            for (int p = row_start[i]; p < row_start[i + 1]; ++p) {
+                const int k = order[p];
+                const int col = data.entry_col[k];
+                if (position[col] >= static_cast<int>(first)) {
+                    ar[position[col]] += data.entry_value[k];
+                    continue;
+                }
+                position[col] = static_cast<int>(ar.size());
+                ia.push_back(i + 1);
+                ja.push_back(col + 1);
+                ar.push_back(data.entry_value[k]);
+            }
+        }
+        // Somas que se anularam não entram na matriz
+        size_t kept = 1;
+        for (size_t k = 1; k < ar.size(); ++k) {
+            if (ar[k] != 0.0) {
+                ia[kept] = ia[k];
+                ja[kept] = ja[k];
+                ar[kept] = ar[k];
+                ++kept;
+            }
+        }
 
-    // Pelos requisitos do trabalho, o problema é sempre de maximização
-    glp_set_obj_dir(lp, GLP_MAX); 
+        glp_prob* lp = glp_create_prob();
+        glp_set_obj_dir(lp, data.maximize ? GLP_MAX : GLP_MIN);
+        glp_set_obj_coef(lp, 0, data.objective_constant);
+        if (num_rows > 0) {
+            glp_add_rows(lp, num_rows);
+        }
+        if (num_cols > 0) {
+            glp_add_cols(lp, num_cols);
+        }
+        for (int j = 0; j < num_cols; ++j) {
+            const double lower = data.col_lower[j];
+            const double upper = data.col_upper[j];
+            glp_set_col_bnds(lp, j + 1, lower == upper ? GLP_FX : GLP_DB, lower, upper);
+            glp_set_obj_coef(lp, j + 1, data.objective[j]);
+            if (!data.col_names.empty() && !data.col_names[j].empty()) {
+                glp_set_col_name(lp, j + 1, data.col_names[j].c_str());
+            }
+        }
+        for (int i = 0; i < num_rows; ++i) {
+            const double lower = data.row_lower[i];
+            const double upper = data.row_upper[i];
+            const bool has_lower = std::isfinite(lower);
+            const bool has_upper = std::isfinite(upper);
+            int type = GLP_FR;
+            if (has_lower && has_upper) {
+                type = lower == upper ? GLP_FX : GLP_DB;
+            } else if (has_upper) {
+                type = GLP_UP;
+            } else if (has_lower) {
+                type = GLP_LO;
+            }
+            glp_set_row_bnds(lp, i + 1, type, has_lower ? lower : 0.0, has_upper ? upper : 0.0);
+        }
+        if (kept > 1) {
+            glp_load_matrix(lp, static_cast<int>(kept) - 1, ia.data(), ja.data(), ar.data());
+        }
+        return lp;
+    }
 
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+    }
 
-    // Lendo a primeira linha do arquivo
-    std::string line;
-    int num_vars, num_constraints;
-    if (!std::getline(file, line)) {
-        throw std::runtime_error("Failed to read the first line of the file.");
+    bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t k = 0; k < a.size(); ++k) {
+            if (std::tolower(static_cast<unsigned char>(a[k])) != std::tolower(static_cast<unsigned char>(b[k]))) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    // Lendo o número de variáveis e restrições
-    std::istringstream iss(line);
-    if (!(iss >> num_vars >> num_constraints)) {
-        throw std::invalid_argument("Invalid format in the first line of the file.");
+    // Converte um número que ocupa o texto inteiro (aceita '+' inicial, que from_chars não aceita)
+    template <typename T>
+    bool parseNumber(std::string_view text, T& value) {
+        if (!text.empty() && text.front() == '+') {
+            text.remove_prefix(1);
+        }
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && end == text.data() + text.size();
     }
-    if (num_vars <= 0 || num_constraints <= 0) {
-        throw std::out_of_range("Number of variables or constraints is out of range.");
+
+    // -----------------------------------------------------------------------
+    // Formato denso do trabalho
+    // -----------------------------------------------------------------------
+
+    // Leitura sequencial de números separados por espaços, sem cópias
+    class NumberScanner {
+    public:
+        explicit NumberScanner(std::string_view text) : pos_(text.data()), end_(text.data() + text.size()) {}
+
+        template <typename T>
+        bool next(T& value) {
+            while (pos_ < end_ && isSpace(*pos_)) {
+                ++pos_;
+            }
+            const char* start = pos_;
+            while (pos_ < end_ && !isSpace(*pos_)) {
+                ++pos_;
+            }
+            return start < pos_ && parseNumber(std::string_view(start, static_cast<size_t>(pos_ - start)), value);
+        }
+
+    private:
+        const char* pos_;
+        const char* end_;
+    };
+
+    void parseDense(std::string_view text, ProblemData& data) {
+        NumberScanner scanner(text);
+
+        // Pelos requisitos do trabalho, o problema é sempre de maximização
+        data.maximize = true;
+
+        int num_vars = 0;
+        int num_constraints = 0;
+        if (!scanner.next(num_vars) || !scanner.next(num_constraints)) {
+            throw std::invalid_argument("Invalid format in the first line of the file.");
+        }
+        if (num_vars <= 0 || num_constraints <= 0) {
+            throw std::out_of_range("Number of variables or constraints is out of range.");
+        }
+
+        // Coeficientes da função objetivo; toda variável em [0, 1]
+        data.objective.resize(num_vars);
+        for (int j = 0; j < num_vars; ++j) {
+            if (!scanner.next(data.objective[j])) {
+                throw std::invalid_argument("Invalid format in the objective function line.");
+            }
+        }
+        data.col_lower.assign(num_vars, 0.0);
+        data.col_upper.assign(num_vars, 1.0);
+        data.col_integer.assign(num_vars, 1);
+
+        // Restrições a·x <= b; coeficientes nulos não entram na matriz
+        const size_t capacity = std::min(static_cast<size_t>(num_vars) * num_constraints, text.size() / 2);
+        data.entry_row.reserve(capacity);
+        data.entry_col.reserve(capacity);
+        data.entry_value.reserve(capacity);
+        for (int i = 0; i < num_constraints; ++i) {
+            for (int j = 0; j < num_vars; ++j) {
+                double coef;
+                if (!scanner.next(coef)) {
+                    throw std::invalid_argument("Formato inválido na linha da restrição " + std::to_string(i + 1) + ".");
+                }
+                data.addEntry(i, j, coef);
+            }
+            double rhs;
+            if (!scanner.next(rhs)) {
+                throw std::invalid_argument("Formato inválido na linha da restrição " + std::to_string(i + 1) + ".");
+            }
+            data.addRow(-INF, rhs);
+        }
     }
 
-    glp_add_rows(lp, num_constraints);
-    glp_add_cols(lp, num_vars);
+    // -----------------------------------------------------------------------
+    // MPS livre
+    // -----------------------------------------------------------------------
 
-    // Coeficientes da função objetivo
-    if (!std::getline(file, line)) {
-        throw std::runtime_error("Failed to read the objective function line.");
+    [[noreturn]] void failMps(int line, const std::string& message) {
+        throw std::invalid_argument("MPS, linha " + std::to_string(line) + ": " + message);
     }
-    std::istringstream obj_iss(line);
-    for (int i = 1; i <= num_vars; ++i) {
-        double coef;
-        if (!(obj_iss >> coef)) {
-            throw std::invalid_argument("Invalid format in the objective function line.");
+
+    void parseMps(std::string_view text, ProblemData& data) {
+        enum class Section { NONE, NAME, OBJSENSE, ROWS, COLUMNS, RHS, RANGES, BOUNDS };
+        constexpr int OBJECTIVE_ROW = -1;
+        constexpr int FREE_ROW = -2;
+
+        // Sem OBJSENSE o MPS é de minimização
+        data.maximize = false;
+
+        std::unordered_map<std::string_view, int> rows;
+        std::unordered_map<std::string_view, int> cols;
+        std::vector<char> sense;
+        std::vector<double> rhs;
+        std::vector<double> range;
+        std::vector<char> integer;
+        std::vector<char> has_upper;
+        bool has_objective = false;
+        bool in_integer_block = false;
+        int current_col = -1;
+        std::string_view current_col_name;
+
+        auto findRow = [&](std::string_view name, int line) {
+            const auto it = rows.find(name);
+            if (it == rows.end()) {
+                failMps(line, "linha desconhecida '" + std::string(name) + "'.");
+            }
+            return it->second;
+        };
+        auto findCol = [&](std::string_view name, int line) {
+            const auto it = cols.find(name);
+            if (it == cols.end()) {
+                failMps(line, "coluna desconhecida '" + std::string(name) + "'.");
+            }
+            return it->second;
+        };
+        auto value = [&](std::string_view token, int line) {
+            double parsed;
+            if (!parseNumber(token, parsed)) {
+                failMps(line, "número inválido '" + std::string(token) + "'.");
+            }
+            return parsed;
+        };
+
+        Section section = Section::NONE;
+        std::vector<std::string_view> tokens;
+        size_t pos = 0;
+        int line_number = 0;
+        bool finished = false;
+        while (pos < text.size() && !finished) {
+            size_t end = text.find('\n', pos);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            const std::string_view line = text.substr(pos, end - pos);
+            pos = end + 1;
+            ++line_number;
+
+            tokens.clear();
+            for (size_t k = 0; k < line.size();) {
+                while (k < line.size() && isSpace(line[k])) {
+                    ++k;
+                }
+                const size_t start = k;
+                while (k < line.size() && !isSpace(line[k])) {
+                    ++k;
+                }
+                if (start < k) {
+                    tokens.push_back(line.substr(start, k - start));
+                }
+            }
+            if (tokens.empty() || tokens[0].front() == '*') {
+                continue;
+            }
+
+            // Cabeçalhos de seção começam na primeira coluna
+            if (!isSpace(line.front())) {
+                const std::string_view header = tokens[0];
+                if (header == "NAME") {
+                    section = Section::NAME;
+                } else if (header == "OBJSENSE") {
+                    section = Section::OBJSENSE;
+                    if (tokens.size() > 1) {
+                        data.maximize = tokens[1] == "MAX" || tokens[1] == "MAXIMIZE";
+                    }
+                } else if (header == "ROWS") {
+                    section = Section::ROWS;
+                } else if (header == "COLUMNS") {
+                    section = Section::COLUMNS;
+                } else if (header == "RHS") {
+                    section = Section::RHS;
+                } else if (header == "RANGES") {
+                    section = Section::RANGES;
+                } else if (header == "BOUNDS") {
+                    section = Section::BOUNDS;
+                } else if (header == "ENDATA") {
+                    finished = true;
+                } else {
+                    failMps(line_number, "seção desconhecida '" + std::string(header) + "'.");
+                }
+                continue;
+            }
+
+            switch (section) {
+            case Section::NAME:
+                break;
+            case Section::OBJSENSE:
+                if (tokens[0] == "MAX" || tokens[0] == "MAXIMIZE") {
+                    data.maximize = true;
+                } else if (tokens[0] == "MIN" || tokens[0] == "MINIMIZE") {
+                    data.maximize = false;
+                } else {
+                    failMps(line_number, "sentido de otimização inválido '" + std::string(tokens[0]) + "'.");
+                }
+                break;
+            case Section::ROWS: {
+                if (tokens.size() < 2) {
+                    failMps(line_number, "linha sem nome.");
+                }
+                const std::string_view type = tokens[0];
+                int index;
+                if (type == "N") {
+                    index = has_objective ? FREE_ROW : OBJECTIVE_ROW;
+                    has_objective = true;
+                } else if (type == "L" || type == "G" || type == "E") {
+                    index = data.addRow(-INF, INF);
+                    sense.push_back(type.front());
+                    rhs.push_back(0.0);
+                    range.push_back(0.0);
+                } else {
+                    failMps(line_number, "tipo de linha inválido '" + std::string(type) + "'.");
+                }
+                if (!rows.emplace(tokens[1], index).second) {
+                    failMps(line_number, "linha repetida '" + std::string(tokens[1]) + "'.");
+                }
+                break;
+            }
+            case Section::COLUMNS: {
+                if (tokens.size() >= 3 && tokens[1] == "'MARKER'") {
+                    if (tokens[2] == "'INTORG'") {
+                        in_integer_block = true;
+                    } else if (tokens[2] == "'INTEND'") {
+                        in_integer_block = false;
+                    } else {
+                        failMps(line_number, "marcador inválido '" + std::string(tokens[2]) + "'.");
+                    }
+                    break;
+                }
+                if (tokens.size() != 3 && tokens.size() != 5) {
+                    failMps(line_number, "número de campos inválido na seção COLUMNS.");
+                }
+                if (current_col < 0 || tokens[0] != current_col_name) {
+                    current_col_name = tokens[0];
+                    const auto [it, inserted] = cols.emplace(current_col_name, static_cast<int>(data.objective.size()));
+                    if (!inserted) {
+                        failMps(line_number, "coluna '" + std::string(current_col_name) + "' não contígua.");
+                    }
+                    current_col = data.addCol(current_col_name, 0.0, INF);
+                    integer.push_back(in_integer_block);
+                    has_upper.push_back(0);
+                }
+                for (size_t k = 1; k + 1 < tokens.size(); k += 2) {
+                    const int row = findRow(tokens[k], line_number);
+                    const double coef = value(tokens[k + 1], line_number);
+                    if (row == OBJECTIVE_ROW) {
+                        data.objective[current_col] += coef;
+                    } else if (row != FREE_ROW) {
+                        data.addEntry(row, current_col, coef);
+                    }
+                }
+                break;
+            }
+            case Section::RHS:
+            case Section::RANGES: {
+                // O nome do conjunto é opcional: com ele o número de campos é ímpar
+                const size_t first = tokens.size() % 2 == 1 ? 1 : 0;
+                if (tokens.size() - first != 2 && tokens.size() - first != 4) {
+                    failMps(line_number, "número de campos inválido.");
+                }
+                for (size_t k = first; k + 1 < tokens.size(); k += 2) {
+                    const int row = findRow(tokens[k], line_number);
+                    const double amount = value(tokens[k + 1], line_number);
+                    if (section == Section::RHS) {
+                        if (row == OBJECTIVE_ROW) {
+                            data.objective_constant = -amount; // Convenção do MPS
+                        } else if (row != FREE_ROW) {
+                            rhs[row] = amount;
+                        }
+                    } else if (row >= 0) {
+                        range[row] = amount;
+                    }
+                }
+                break;
+            }
+            case Section::BOUNDS: {
+                const std::string_view type = tokens[0];
+                const bool needs_value = type == "UP" || type == "LO" || type == "FX" || type == "LI" || type == "UI";
+                const bool no_value = type == "FR" || type == "MI" || type == "PL" || type == "BV";
+                if (!needs_value && !no_value) {
+                    failMps(line_number, "tipo de limite inválido '" + std::string(type) + "'.");
+                }
+                // O nome do conjunto de limites também é opcional
+                const size_t expected = needs_value ? 4 : 3;
+                const size_t name_pos = tokens.size() >= expected ? 2 : 1;
+                if (tokens.size() <= name_pos || (needs_value && tokens.size() <= name_pos + 1)) {
+                    failMps(line_number, "número de campos inválido na seção BOUNDS.");
+                }
+                const int col = findCol(tokens[name_pos], line_number);
+                const double bound = needs_value ? value(tokens[name_pos + 1], line_number) : 0.0;
+                if (type == "UP" || type == "UI") {
+                    data.col_upper[col] = bound;
+                    has_upper[col] = 1;
+                } else if (type == "LO" || type == "LI") {
+                    data.col_lower[col] = bound;
+                } else if (type == "FX") {
+                    data.col_lower[col] = bound;
+                    data.col_upper[col] = bound;
+                    has_upper[col] = 1;
+                } else if (type == "FR") {
+                    data.col_lower[col] = -INF;
+                    data.col_upper[col] = INF;
+                    has_upper[col] = 1;
+                } else if (type == "MI") {
+                    data.col_lower[col] = -INF;
+                } else if (type == "PL") {
+                    data.col_upper[col] = INF;
+                    has_upper[col] = 1;
+                } else {
+                    data.col_lower[col] = 0.0;
+                    data.col_upper[col] = 1.0;
+                    has_upper[col] = 1;
+                }
+                if (type == "LI" || type == "UI" || type == "BV") {
+                    integer[col] = 1;
+                }
+                break;
+            }
+            case Section::NONE:
+                failMps(line_number, "dados fora de uma seção.");
+            }
+        }
+        if (!has_objective) {
+            throw std::invalid_argument("MPS sem linha de objetivo (tipo N).");
+        }
+
+        // Variáveis inteiras sem limite superior explícito são binárias (convenção do MPS)
+        for (size_t j = 0; j < integer.size(); ++j) {
+            if (integer[j] && !has_upper[j] && data.col_upper[j] == INF) {
+                data.col_upper[j] = 1.0;
+            }
+        }
+        data.col_integer.assign(integer.begin(), integer.end());
+
+        // Limites das linhas a partir do sentido, do lado direito e do intervalo (RANGES)
+        for (size_t i = 0; i < sense.size(); ++i) {
+            const double r = range[i];
+            switch (sense[i]) {
+            case 'L':
+                data.row_lower[i] = r != 0.0 ? rhs[i] - std::abs(r) : -INF;
+                data.row_upper[i] = rhs[i];
+                break;
+            case 'G':
+                data.row_lower[i] = rhs[i];
+                data.row_upper[i] = r != 0.0 ? rhs[i] + std::abs(r) : INF;
+                break;
+            default:
+                data.row_lower[i] = r < 0.0 ? rhs[i] + r : rhs[i];
+                data.row_upper[i] = r > 0.0 ? rhs[i] + r : rhs[i];
+                break;
+            }
         }
-        glp_set_obj_coef(lp, i, coef);
     }
 
-    // Leitura das restrições do problema
-    for (int i = 1; i <= num_constraints; ++i) {
+    // -----------------------------------------------------------------------
+    // Formato LP do CPLEX
+    // -----------------------------------------------------------------------
+
+    struct LpToken {
+        enum Kind { NUMBER, NAME, PLUS, MINUS, COLON, LESS, GREATER, EQUAL, END } kind;
+        std::string_view text;
+        double number;
+        int line;
+    };
 
-        // Obtém a linha
-        if (!std::getline(file, line)) {
-            throw std::runtime_error("Falha ao ler a linha da restrição " + std::to_string(i) + ".");
+    enum class LpSection { NONE, MAXIMIZE, MINIMIZE, SUBJECT_TO, BOUNDS, BINARY, GENERAL, END, UNSUPPORTED };
+
+    [[noreturn]] void failLp(int line, const std::string& message) {
+        throw std::invalid_argument("LP, linha " + std::to_string(line) + ": " + message);
+    }
+
+    bool isLpNameChar(char c) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            return true;
         }
-        std::istringstream constraint_iss(line);
+        switch (c) {
+        case '!': case '"': case '#': case '$': case '%': case '&': case '(': case ')': case '/':
+        case ',': case '.': case ';': case '?': case '@': case '_': case '`': case '\'': case '{':
+        case '}': case '|': case '~':
+            return true;
+        default:
+            return false;
+        }
+    }
 
-        // Arrays para armazenar os índices e coeficientes das variáveis na restrição
-        int indices[num_vars + 1];
-        double coefficients[num_vars + 1];
+    std::vector<LpToken> tokenizeLp(std::string_view text) {
+        std::vector<LpToken> tokens;
+        tokens.reserve(text.size() / 4);
+        int line = 1;
+        size_t k = 0;
+        while (k < text.size()) {
+            const char c = text[k];
+            if (c == '\n') {
+                ++line;
+                ++k;
+                continue;
+            }
+            if (isSpace(c)) {
+                ++k;
+                continue;
+            }
+            if (c == '\\') {
+                while (k < text.size() && text[k] != '\n') {
+                    ++k;
+                }
+                continue;
+            }
+            const size_t start = k;
+            LpToken token{LpToken::END, {}, 0.0, line};
+            if (c == '+' || c == '-' || c == ':') {
+                token.kind = c == '+' ? LpToken::PLUS : (c == '-' ? LpToken::MINUS : LpToken::COLON);
+                ++k;
+            } else if (c == '<' || c == '>' || c == '=') {
+                ++k;
+                char op = c;
+                if (k < text.size() && (text[k] == '=' || (c == '=' && (text[k] == '<' || text[k] == '>')))) {
+                    op = c == '=' ? text[k] : c;
+                    ++k;
+                }
+                token.kind = op == '<' ? LpToken::LESS : (op == '>' ? LpToken::GREATER : LpToken::EQUAL);
+            } else if (std::isdigit(static_cast<unsigned char>(c)) ||
+                       (c == '.' && k + 1 < text.size() && std::isdigit(static_cast<unsigned char>(text[k + 1])))) {
+                const auto [end, error] = std::from_chars(text.data() + k, text.data() + text.size(), token.number);
+                if (error != std::errc()) {
+                    failLp(line, "número inválido.");
+                }
+                token.kind = LpToken::NUMBER;
+                k = static_cast<size_t>(end - text.data());
+            } else if (isLpNameChar(c)) {
+                while (k < text.size() && isLpNameChar(text[k])) {
+                    ++k;
+                }
+                token.kind = LpToken::NAME;
+            } else {
+                failLp(line, std::string("caractere não suportado '") + c + "'.");
+            }
+            token.text = text.substr(start, k - start);
+            tokens.push_back(token);
+        }
+        tokens.push_back({LpToken::END, {}, 0.0, line});
+        return tokens;
+    }
+
+    class LpParser {
+    public:
+        LpParser(std::string_view text, ProblemData& data) : tokens_(tokenizeLp(text)), data_(data) {}
+
+        void parse() {
+            LpSection section = sectionAt(pos_);
+            if (section != LpSection::MAXIMIZE && section != LpSection::MINIMIZE) {
+                failLp(tokens_[pos_].line, "o arquivo deve começar por maximize ou minimize.");
+            }
+            data_.maximize = section == LpSection::MAXIMIZE;
+            skipSection();
+            parseObjective();
+            while (true) {
+                const LpToken& token = tokens_[pos_];
+                section = sectionAt(pos_);
+                if (token.kind == LpToken::END || section == LpSection::END) {
+                    break;
+                }
+                if (section == LpSection::NONE || section == LpSection::MAXIMIZE || section == LpSection::MINIMIZE) {
+                    failLp(token.line, "seção inesperada '" + std::string(token.text) + "'.");
+                }
+                if (section == LpSection::UNSUPPORTED) {
+                    failLp(token.line, "seção não suportada '" + std::string(token.text) + "'.");
+                }
+                skipSection();
+                switch (section) {
+                case LpSection::SUBJECT_TO:
+                    while (sectionAt(pos_) == LpSection::NONE && tokens_[pos_].kind != LpToken::END) {
+                        parseConstraint();
+                    }
+                    break;
+                case LpSection::BOUNDS:
+                    while (sectionAt(pos_) == LpSection::NONE && tokens_[pos_].kind != LpToken::END) {
+                        parseBound();
+                    }
+                    break;
+                default: // BINARY ou GENERAL
+                    while (sectionAt(pos_) == LpSection::NONE && tokens_[pos_].kind != LpToken::END) {
+                        const LpToken& name = expect(LpToken::NAME, "nome de variável");
+                        const int col = column(name.text);
+                        data_.col_integer[col] = 1;
+                        if (section == LpSection::BINARY) {
+                            data_.col_lower[col] = 0.0;
+                            data_.col_upper[col] = 1.0;
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+    private:
+        // Seção iniciada no token pos (palavras-chave sem distinção de maiúsculas)
+        LpSection sectionAt(size_t pos) const {
+            const LpToken& token = tokens_[pos];
+            if (token.kind != LpToken::NAME) {
+                return LpSection::NONE;
+            }
+            const std::string_view word = token.text;
+            for (std::string_view keyword : {"maximize", "maximise", "maximum", "max"}) {
+                if (equalsIgnoreCase(word, keyword)) {
+                    return LpSection::MAXIMIZE;
+                }
+            }
+            for (std::string_view keyword : {"minimize", "minimise", "minimum", "min"}) {
+                if (equalsIgnoreCase(word, keyword)) {
+                    return LpSection::MINIMIZE;
+                }
+            }
+            const LpToken& next = tokens_[std::min(pos + 1, tokens_.size() - 1)];
+            if ((equalsIgnoreCase(word, "subject") && next.kind == LpToken::NAME && equalsIgnoreCase(next.text, "to")) ||
+                (equalsIgnoreCase(word, "such") && next.kind == LpToken::NAME && equalsIgnoreCase(next.text, "that")) ||
+                equalsIgnoreCase(word, "st") || equalsIgnoreCase(word, "s.t.") || equalsIgnoreCase(word, "st.")) {
+                return LpSection::SUBJECT_TO;
+            }
+            if (equalsIgnoreCase(word, "bounds") || equalsIgnoreCase(word, "bound")) {
+                return LpSection::BOUNDS;
+            }
+            if (equalsIgnoreCase(word, "binary") || equalsIgnoreCase(word, "binaries") || equalsIgnoreCase(word, "bin")) {
+                return LpSection::BINARY;
+            }
+            if (equalsIgnoreCase(word, "general") || equalsIgnoreCase(word, "generals") || equalsIgnoreCase(word, "gen")) {
+                return LpSection::GENERAL;
+            }
+            if (equalsIgnoreCase(word, "end")) {
+                return LpSection::END;
+            }
+            if (equalsIgnoreCase(word, "semi-continuous") || equalsIgnoreCase(word, "semis") ||
+                equalsIgnoreCase(word, "semi") || equalsIgnoreCase(word, "sos")) {
+                return LpSection::UNSUPPORTED;
+            }
+            return LpSection::NONE;
+        }
+
+        void skipSection() {
+            const std::string_view word = tokens_[pos_].text;
+            pos_ += equalsIgnoreCase(word, "subject") || equalsIgnoreCase(word, "such") ? 2 : 1;
+        }
+
+        const LpToken& expect(LpToken::Kind kind, const char* what) {
+            const LpToken& token = tokens_[pos_];
+            if (token.kind != kind) {
+                failLp(token.line, std::string("esperado ") + what + ".");
+            }
+            ++pos_;
+            return token;
+        }
 
-        // Lê os coeficientes das variáveis na restrição
-        for (int j = 1; j <= num_vars; ++j) {
-            if (!(constraint_iss >> coefficients[j])) {
-                throw std::invalid_argument("Formato inválido na linha da restrição " + std::to_string(i) + ".");
+        int column(std::string_view name) {
+            const auto [it, inserted] = columns_.emplace(name, static_cast<int>(data_.objective.size()));
+            if (inserted) {
+                data_.addCol(name, 0.0, INF);
             }
-            indices[j] = j; // Define o índice da variável
+            return it->second;
+        }
+
+        bool isRelation(LpToken::Kind kind) const {
+            return kind == LpToken::LESS || kind == LpToken::GREATER || kind == LpToken::EQUAL;
         }
 
-        // Lê o lado direito da restrição (valor limite)
-        double rhs;
-        if (!(constraint_iss >> rhs)) {
-            throw std::invalid_argument("Formato inválido na linha da restrição " + std::to_string(i) + ".");
+        bool isVariable(size_t pos) const {
+            return tokens_[pos].kind == LpToken::NAME && sectionAt(pos) == LpSection::NONE;
         }
 
-        // Define os coeficientes e o lado direito da restrição no problema GLPK
-        glp_set_mat_row(lp, i, num_vars, indices, coefficients);
-        glp_set_row_bnds(lp, i, GLP_UP, 0.0, rhs); // Define a restrição como "menor ou igual a rhs"
+        // Nome opcional "rótulo:" antes do objetivo e das restrições
+        void skipLabel() {
+            if (tokens_[pos_].kind == LpToken::NAME && tokens_[pos_ + 1].kind == LpToken::COLON) {
+                pos_ += 2;
+            }
+        }
+
+        // Número com sinal; nas seções de limites aceita também inf/infinity
+        bool parseSignedValue(double& value) {
+            size_t pos = pos_;
+            double sign = 1.0;
+            while (tokens_[pos].kind == LpToken::PLUS || tokens_[pos].kind == LpToken::MINUS) {
+                sign = tokens_[pos].kind == LpToken::MINUS ? -sign : sign;
+                ++pos;
+            }
+            const LpToken& token = tokens_[pos];
+            if (token.kind == LpToken::NUMBER) {
+                value = sign * token.number;
+            } else if (token.kind == LpToken::NAME &&
+                       (equalsIgnoreCase(token.text, "inf") || equalsIgnoreCase(token.text, "infinity"))) {
+                value = sign * INF;
+            } else {
+                return false;
+            }
+            pos_ = pos + 1;
+            return true;
+        }
+
+        // Termo "[sinais] [coeficiente] [variável]"; sem variável o termo é constante
+        void parseTerm(int row, double& constant) {
+            double coef = 1.0;
+            while (tokens_[pos_].kind == LpToken::PLUS || tokens_[pos_].kind == LpToken::MINUS) {
+                coef = tokens_[pos_].kind == LpToken::MINUS ? -coef : coef;
+                ++pos_;
+            }
+            bool has_number = false;
+            if (tokens_[pos_].kind == LpToken::NUMBER) {
+                coef *= tokens_[pos_].number;
+                has_number = true;
+                ++pos_;
+            }
+            if (isVariable(pos_)) {
+                const int col = column(tokens_[pos_].text);
+                ++pos_;
+                if (row < 0) {
+                    data_.objective[col] += coef;
+                } else {
+                    data_.addEntry(row, col, coef);
+                }
+            } else if (has_number) {
+                constant += coef;
+            } else {
+                failLp(tokens_[pos_].line, "termo inválido '" + std::string(tokens_[pos_].text) + "'.");
+            }
+        }
+
+        // Expressão linear até o primeiro token que não continua a soma
+        void parseExpression(int row, double& constant) {
+            parseTerm(row, constant);
+            while (tokens_[pos_].kind == LpToken::PLUS || tokens_[pos_].kind == LpToken::MINUS) {
+                parseTerm(row, constant);
+            }
+        }
+
+        void parseObjective() {
+            skipLabel();
+            if (sectionAt(pos_) != LpSection::NONE || tokens_[pos_].kind == LpToken::END) {
+                return; // Objetivo vazio
+            }
+            double constant = 0.0;
+            parseExpression(-1, constant);
+            data_.objective_constant += constant;
+        }
+
+        void parseConstraint() {
+            skipLabel();
+            const int row = data_.addRow(-INF, INF);
+
+            // Forma com intervalo: "l <= expressão <= u"
+            double lower_value = 0.0;
+            LpToken::Kind lower_relation = LpToken::END;
+            const size_t start = pos_;
+            if (parseSignedValue(lower_value) && isRelation(tokens_[pos_].kind)) {
+                lower_relation = tokens_[pos_].kind;
+                ++pos_;
+            } else {
+                pos_ = start;
+            }
+
+            double constant = 0.0;
+            parseExpression(row, constant);
+            const LpToken& relation = tokens_[pos_];
+            if (!isRelation(relation.kind)) {
+                failLp(relation.line, "esperado <=, >= ou = na restrição.");
+            }
+            ++pos_;
+            double rhs;
+            if (!parseSignedValue(rhs)) {
+                failLp(tokens_[pos_].line, "esperado o lado direito da restrição.");
+            }
+            applyRelation(row, relation.kind, rhs - constant, false);
+            if (lower_relation != LpToken::END) {
+                applyRelation(row, lower_relation, lower_value - constant, true);
+            }
+        }
+
+        // valor relação expressão (reversed) ou expressão relação valor
+        void applyRelation(int row, LpToken::Kind relation, double value, bool reversed) {
+            if (relation == LpToken::EQUAL) {
+                data_.row_lower[row] = value;
+                data_.row_upper[row] = value;
+            } else if ((relation == LpToken::LESS) != reversed) {
+                data_.row_upper[row] = value;
+            } else {
+                data_.row_lower[row] = value;
+            }
+        }
+
+        void applyBound(int col, LpToken::Kind relation, double value, bool reversed) {
+            if (relation == LpToken::EQUAL) {
+                data_.col_lower[col] = value;
+                data_.col_upper[col] = value;
+            } else if ((relation == LpToken::LESS) != reversed) {
+                data_.col_upper[col] = value;
+            } else {
+                data_.col_lower[col] = value;
+            }
+        }
+
+        void parseBound() {
+            const int line = tokens_[pos_].line;
+            if (isVariable(pos_) && tokens_[pos_ + 1].kind == LpToken::NAME &&
+                equalsIgnoreCase(tokens_[pos_ + 1].text, "free")) {
+                const int col = column(tokens_[pos_].text);
+                data_.col_lower[col] = -INF;
+                data_.col_upper[col] = INF;
+                pos_ += 2;
+                return;
+            }
+            double value;
+            if (parseSignedValue(value)) {
+                const LpToken::Kind relation = tokens_[pos_].kind;
+                if (!isRelation(relation)) {
+                    failLp(line, "limite inválido.");
+                }
+                ++pos_;
+                const int col = column(expect(LpToken::NAME, "nome de variável").text);
+                applyBound(col, relation, value, true);
+                if (isRelation(tokens_[pos_].kind)) {
+                    const LpToken::Kind upper_relation = tokens_[pos_].kind;
+                    ++pos_;
+                    if (!parseSignedValue(value)) {
+                        failLp(line, "limite inválido.");
+                    }
+                    applyBound(col, upper_relation, value, false);
+                }
+                return;
+            }
+            const int col = column(expect(LpToken::NAME, "nome de variável").text);
+            const LpToken::Kind relation = tokens_[pos_].kind;
+            if (!isRelation(relation)) {
+                failLp(line, "limite inválido.");
+            }
+            ++pos_;
+            if (!parseSignedValue(value)) {
+                failLp(line, "limite inválido.");
+            }
+            applyBound(col, relation, value, false);
+        }
+
+        std::vector<LpToken> tokens_;
+        ProblemData& data_;
+        std::unordered_map<std::string_view, int> columns_;
+        size_t pos_ = 0;
+    };
+
+    std::string lowerExtension(const std::string& name) {
+        const size_t slash = name.find_last_of('/');
+        const size_t dot = name.find_last_of('.');
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+            return "";
+        }
+        std::string extension = name.substr(dot + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension;
+    }
+}
+
+InstanceFormat ProblemReader::detectFormat(const std::string &name, std::string_view contents) {
+    if (BinaryInstance::matches(contents)) {
+        return InstanceFormat::BINARY;
+    }
+    const std::string extension = lowerExtension(name);
+    if (extension == "bbin") {
+        return InstanceFormat::BINARY;
+    }
+    if (extension == "mps") {
+        return InstanceFormat::FREE_MPS;
+    }
+    if (extension == "lp") {
+        return InstanceFormat::CPLEX_LP;
     }
 
-    // Define o intervalo [0, 1] para cada variável
-    for (int i = 1; i <= num_vars; ++i) {
-        glp_set_col_bnds(lp, i, GLP_DB, 0.0, 1.0);
+    // Primeiro token fora de comentários ('*' no MPS, '\' no LP)
+    size_t pos = 0;
+    while (pos < contents.size()) {
+        if (isSpace(contents[pos])) {
+            ++pos;
+        } else if (contents[pos] == '*' || contents[pos] == '\\') {
+            while (pos < contents.size() && contents[pos] != '\n') {
+                ++pos;
+            }
+        } else {
+            break;
+        }
+    }
+    size_t end = pos;
+    while (end < contents.size() && !isSpace(contents[end])) {
+        ++end;
+    }
+    const std::string_view token = contents.substr(pos, end - pos);
+    if (!token.empty() && (std::isdigit(static_cast<unsigned char>(token.front())) ||
+                           token.front() == '-' || token.front() == '+' || token.front() == '.')) {
+        return InstanceFormat::DENSE_TEXT;
+    }
+    for (std::string_view keyword : {"NAME", "ROWS", "OBJSENSE"}) {
+        if (token == keyword) {
+            return InstanceFormat::FREE_MPS;
+        }
+    }
+    for (std::string_view keyword : {"maximize", "maximise", "maximum", "max", "minimize", "minimise", "minimum", "min"}) {
+        if (equalsIgnoreCase(token, keyword)) {
+            return InstanceFormat::CPLEX_LP;
+        }
     }
+    throw std::invalid_argument("Formato de instância não reconhecido: " + name);
+}
 
-    return lp;
+glp_prob* ProblemReader::read(const std::string &filepath) {
+    return read(filepath, InstanceFormat::AUTO);
 }
 
+glp_prob* ProblemReader::read(const std::string &filepath, InstanceFormat format) {
+    const MappedFile file(filepath);
+    return parse(file.view(), format, filepath);
+}
+
+glp_prob* ProblemReader::parse(std::string_view contents, InstanceFormat format, const std::string &name) {
+    if (format == InstanceFormat::AUTO) {
+        format = detectFormat(name, contents);
+    }
+    if (format == InstanceFormat::BINARY) {
+        return BinaryInstance::load(contents);
+    }
+    ProblemData data;
+    switch (format) {
+    case InstanceFormat::FREE_MPS:
+        parseMps(contents, data);
+        break;
+    case InstanceFormat::CPLEX_LP:
+        LpParser(contents, data).parse();
+        break;
+    default:
+        parseDense(contents, data);
+        break;
+    }
+    return load(data);
+}
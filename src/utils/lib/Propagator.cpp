@@ -0,0 +1,159 @@
+#include "Propagator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+    constexpr double FEASIBILITY_TOLERANCE = 1e-6;
+    constexpr double INTEGER_TOLERANCE = 1e-6;
+    constexpr std::int8_t FREE = -1;
+}
+
+Propagator::Propagator(const ProblemModel& model)
+    : model_(model) {}
+
+bool Propagator::propagate(std::vector<std::pair<int, int>>& fixed_vars, int* infeasible_row) const {
+    PropagatorWorkspace workspace;
+    return propagate(fixed_vars, workspace, infeasible_row);
+}
+
+bool Propagator::propagate(std::vector<std::pair<int, int>>& fixed_vars, PropagatorWorkspace& workspace,
+                           int* infeasible_row) const {
+    const int num_rows = model_.numRows();
+    const int num_cols = model_.numCols();
+
+    std::vector<std::int8_t>& value = workspace.value;
+    value.assign(static_cast<size_t>(num_cols), FREE);
+    for (const auto& [var, fixed_value] : fixed_vars) {
+        value[var] = static_cast<std::int8_t>(fixed_value);
+    }
+
+    // Atividade mínima e máxima de cada linha dadas as fixações correntes
+    std::vector<double>& min_activity = workspace.min_activity;
+    std::vector<double>& max_activity = workspace.max_activity;
+    min_activity.assign(static_cast<size_t>(num_rows), 0.0);
+    max_activity.assign(static_cast<size_t>(num_rows), 0.0);
+    for (int i = 0; i < num_rows; ++i) {
+        for (int k = model_.rowStart(i); k < model_.rowEnd(i); ++k) {
+            const double a = model_.rowValue(k);
+            const std::int8_t v = value[model_.rowCol(k)];
+            if (v != FREE) {
+                min_activity[i] += a * v;
+                max_activity[i] += a * v;
+            } else if (a < 0.0) {
+                min_activity[i] += a;
+            } else {
+                max_activity[i] += a;
+            }
+        }
+    }
+
+    // Fila de linhas a examinar: todas no início, depois só as afetadas por novas fixações
+    std::vector<int>& queue = workspace.queue;
+    std::vector<char>& queued = workspace.queued;
+    queue.resize(static_cast<size_t>(num_rows));
+    queued.assign(static_cast<size_t>(num_rows), 1);
+    for (int i = 0; i < num_rows; ++i) {
+        queue[i] = i;
+    }
+
+    auto fix = [&](int var, int fixed_value) {
+        value[var] = static_cast<std::int8_t>(fixed_value);
+        fixed_vars.emplace_back(var, fixed_value);
+        for (int k = model_.colStart(var); k < model_.colEnd(var); ++k) {
+            const int row = model_.colRow(k);
+            const double a = model_.colValue(k);
+            const double contribution = a * fixed_value;
+            const double min_delta = contribution - std::min(0.0, a);
+            const double max_delta = contribution - std::max(0.0, a);
+            if (min_delta == 0.0 && max_delta == 0.0) {
+                continue;
+            }
+            min_activity[row] += min_delta;
+            max_activity[row] += max_delta;
+            if (!queued[row]) {
+                queued[row] = 1;
+                queue.push_back(row);
+            }
+        }
+    };
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const int row = queue[head];
+        queued[row] = 0;
+        const double upper = model_.rowUpper(row);
+        const double lower = model_.rowLower(row);
+        if (min_activity[row] > upper + FEASIBILITY_TOLERANCE ||
+            max_activity[row] < lower - FEASIBILITY_TOLERANCE) {
+            if (infeasible_row) {
+                *infeasible_row = row;
+            }
+            return false;
+        }
+        for (int k = model_.rowStart(row); k < model_.rowEnd(row); ++k) {
+            const int var = model_.rowCol(k);
+            if (value[var] != FREE) {
+                continue;
+            }
+            const double a = model_.rowValue(k);
+            // Lado <=: o lado que aumenta a atividade mínima não cabe na folga
+            if (min_activity[row] + std::abs(a) > upper + FEASIBILITY_TOLERANCE) {
+                fix(var, a > 0.0 ? 0 : 1);
+            // Lado >=: o lado que reduz a atividade máxima não alcança o limite inferior
+            } else if (max_activity[row] - std::abs(a) < lower - FEASIBILITY_TOLERANCE) {
+                fix(var, a > 0.0 ? 1 : 0);
+            }
+        }
+    }
+    return true;
+}
+
+int Propagator::fixByReducedCost(
+    const std::vector<double>& solution,
+    const std::vector<double>& reduced_costs,
+    double lp_objective,
+    double incumbent,
+    std::vector<std::pair<int, int>>& fixed_vars) const {
+    PropagatorWorkspace workspace;
+    return fixByReducedCost(solution, reduced_costs, lp_objective, incumbent, fixed_vars, workspace);
+}
+
+int Propagator::fixByReducedCost(
+    const std::vector<double>& solution,
+    const std::vector<double>& reduced_costs,
+    double lp_objective,
+    double incumbent,
+    std::vector<std::pair<int, int>>& fixed_vars,
+    PropagatorWorkspace& workspace) const {
+    if (!std::isfinite(incumbent)) {
+        return 0;
+    }
+    std::vector<char>& fixed = workspace.fixed;
+    fixed.assign(solution.size(), 0);
+    for (const auto& [var, fixed_value] : fixed_vars) {
+        fixed[var] = 1;
+    }
+
+    // Em maximização, uma variável não básica em 0 tem d_j <= 0 e uma em 1 tem d_j >= 0;
+    // trocá-la de lado reduz o limite em pelo menos |d_j|.
+    int count = 0;
+    for (size_t j = 0; j < solution.size(); ++j) {
+        if (fixed[j]) {
+            continue;
+        }
+        const double d = reduced_costs[j];
+        int current_value;
+        if (solution[j] <= INTEGER_TOLERANCE && d < 0.0) {
+            current_value = 0;
+        } else if (solution[j] >= 1.0 - INTEGER_TOLERANCE && d > 0.0) {
+            current_value = 1;
+        } else {
+            continue;
+        }
+        if (lp_objective - std::abs(d) <= incumbent) {
+            fixed_vars.emplace_back(static_cast<int>(j), current_value);
+            ++count;
+        }
+    }
+    return count;
+}
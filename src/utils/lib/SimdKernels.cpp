@@ -0,0 +1,158 @@
+#include "SimdKernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+#if defined(__AVX2__)
+    double horizontalSum(__m256d v) {
+        const __m128d low = _mm256_castpd256_pd128(v);
+        const __m128d high = _mm256_extractf128_pd(v, 1);
+        const __m128d pair = _mm_add_pd(low, high);
+        return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+    }
+#endif
+}
+
+namespace simd {
+
+double dot(const double* a, const double* x, int n) noexcept {
+    int k = 0;
+#if defined(__AVX2__)
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    for (; k + 8 <= n; k += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + k), _mm256_loadu_pd(x + k)));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + k + 4), _mm256_loadu_pd(x + k + 4)));
+    }
+    double sum = horizontalSum(_mm256_add_pd(acc0, acc1));
+#else
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    for (; k + 4 <= n; k += 4) {
+        s0 += a[k] * x[k];
+        s1 += a[k + 1] * x[k + 1];
+        s2 += a[k + 2] * x[k + 2];
+        s3 += a[k + 3] * x[k + 3];
+    }
+    double sum = (s0 + s1) + (s2 + s3);
+#endif
+    for (; k < n; ++k) {
+        sum += a[k] * x[k];
+    }
+    return sum;
+}
+
+double dot(const double* a, const int* x, int n) noexcept {
+    int k = 0;
+#if defined(__AVX2__)
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    for (; k + 8 <= n; k += 8) {
+        const __m256d x0 = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + k)));
+        const __m256d x1 = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + k + 4)));
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + k), x0));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + k + 4), x1));
+    }
+    double sum = horizontalSum(_mm256_add_pd(acc0, acc1));
+#else
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    for (; k + 4 <= n; k += 4) {
+        s0 += a[k] * x[k];
+        s1 += a[k + 1] * x[k + 1];
+        s2 += a[k + 2] * x[k + 2];
+        s3 += a[k + 3] * x[k + 3];
+    }
+    double sum = (s0 + s1) + (s2 + s3);
+#endif
+    for (; k < n; ++k) {
+        sum += a[k] * x[k];
+    }
+    return sum;
+}
+
+double sparseDot(const double* values, const int* index, int len, const double* x) noexcept {
+    int k = 0;
+#if defined(__AVX2__)
+    __m256d acc = _mm256_setzero_pd();
+    for (; k + 4 <= len; k += 4) {
+        const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(index + k));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(values + k), _mm256_i32gather_pd(x, idx, 8)));
+    }
+    double sum = horizontalSum(acc);
+#else
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    for (; k + 4 <= len; k += 4) {
+        s0 += values[k] * x[index[k]];
+        s1 += values[k + 1] * x[index[k + 1]];
+        s2 += values[k + 2] * x[index[k + 2]];
+        s3 += values[k + 3] * x[index[k + 3]];
+    }
+    double sum = (s0 + s1) + (s2 + s3);
+#endif
+    for (; k < len; ++k) {
+        sum += values[k] * x[index[k]];
+    }
+    return sum;
+}
+
+double sparseDot(const double* values, const int* index, int len, const int* x) noexcept {
+    int k = 0;
+#if defined(__AVX2__)
+    __m256d acc = _mm256_setzero_pd();
+    for (; k + 4 <= len; k += 4) {
+        const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(index + k));
+        const __m256d gathered = _mm256_cvtepi32_pd(_mm_i32gather_epi32(x, idx, 4));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(values + k), gathered));
+    }
+    double sum = horizontalSum(acc);
+#else
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    for (; k + 4 <= len; k += 4) {
+        s0 += values[k] * x[index[k]];
+        s1 += values[k + 1] * x[index[k + 1]];
+        s2 += values[k + 2] * x[index[k + 2]];
+        s3 += values[k + 3] * x[index[k + 3]];
+    }
+    double sum = (s0 + s1) + (s2 + s3);
+#endif
+    for (; k < len; ++k) {
+        sum += values[k] * x[index[k]];
+    }
+    return sum;
+}
+
+bool anyOutside(const double* activity, const double* lower, const double* upper, int n,
+                double tolerance) noexcept {
+    int k = 0;
+#if defined(__AVX2__)
+    const __m256d tol = _mm256_set1_pd(tolerance);
+    for (; k + 4 <= n; k += 4) {
+        const __m256d act = _mm256_loadu_pd(activity + k);
+        const __m256d over = _mm256_cmp_pd(act, _mm256_add_pd(_mm256_loadu_pd(upper + k), tol), _CMP_GT_OQ);
+        const __m256d under = _mm256_cmp_pd(act, _mm256_sub_pd(_mm256_loadu_pd(lower + k), tol), _CMP_LT_OQ);
+        if (_mm256_movemask_pd(_mm256_or_pd(over, under)) != 0) {
+            return true;
+        }
+    }
+#else
+    // Sem desvio por elemento: o laço interno acumula as violações de um bloco
+    for (; k + 4 <= n; k += 4) {
+        bool outside = false;
+        for (int t = k; t < k + 4; ++t) {
+            outside |= (activity[t] > upper[t] + tolerance) | (activity[t] < lower[t] - tolerance);
+        }
+        if (outside) {
+            return true;
+        }
+    }
+#endif
+    for (; k < n; ++k) {
+        if (activity[k] > upper[k] + tolerance || activity[k] < lower[k] - tolerance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace simd
@@ -0,0 +1,126 @@
+#include "Symmetry.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+namespace {
+    constexpr std::int8_t FREE = -1;
+}
+
+ColumnSymmetry ColumnSymmetry::detect(const ProblemModel& model) {
+    const int num_cols = model.numCols();
+
+    // Ordem total sobre as colunas: objetivo, número de elementos e pares (linha, coeficiente).
+    // As entradas da CSC estão em ordem crescente de linha, então colunas idênticas ficam adjacentes.
+    auto column_less = [&model](int a, int b) {
+        if (model.objective(a) != model.objective(b)) {
+            return model.objective(a) < model.objective(b);
+        }
+        const int len_a = model.colEnd(a) - model.colStart(a);
+        const int len_b = model.colEnd(b) - model.colStart(b);
+        if (len_a != len_b) {
+            return len_a < len_b;
+        }
+        for (int k = 0; k < len_a; ++k) {
+            const int row_a = model.colRow(model.colStart(a) + k);
+            const int row_b = model.colRow(model.colStart(b) + k);
+            if (row_a != row_b) {
+                return row_a < row_b;
+            }
+            const double value_a = model.colValue(model.colStart(a) + k);
+            const double value_b = model.colValue(model.colStart(b) + k);
+            if (value_a != value_b) {
+                return value_a < value_b;
+            }
+        }
+        return false;
+    };
+    std::vector<int> order(static_cast<size_t>(num_cols));
+    std::iota(order.begin(), order.end(), 0);
+    // Estável: dentro de uma classe as colunas ficam em ordem crescente de índice
+    std::stable_sort(order.begin(), order.end(), column_less);
+
+    ColumnSymmetry symmetry;
+    symmetry.class_of_.assign(static_cast<size_t>(num_cols), -1);
+    for (int first = 0; first < num_cols;) {
+        int last = first + 1;
+        while (last < num_cols && !column_less(order[first], order[last])) {
+            ++last;
+        }
+        if (last - first >= 2) {
+            const int id = static_cast<int>(symmetry.classes_.size());
+            std::vector<int> columns(order.begin() + first, order.begin() + last);
+            for (const int col : columns) {
+                symmetry.class_of_[col] = id;
+            }
+            symmetry.symmetric_columns_ += last - first;
+            symmetry.classes_.push_back(std::move(columns));
+        }
+        first = last;
+    }
+    return symmetry;
+}
+
+bool ColumnSymmetry::propagate(std::vector<std::pair<int, int>>& fixed_vars) const {
+    SymmetryWorkspace workspace;
+    return propagate(fixed_vars, workspace);
+}
+
+bool ColumnSymmetry::propagate(std::vector<std::pair<int, int>>& fixed_vars, SymmetryWorkspace& workspace) const {
+    if (classes_.empty()) {
+        return true;
+    }
+
+    std::vector<std::int8_t>& value = workspace.value;
+    std::vector<int>& touched = workspace.touched;
+    if (value.size() != class_of_.size()) {
+        value.assign(class_of_.size(), FREE);
+    }
+    touched.clear();
+    const std::size_t node_fixings = fixed_vars.size();
+    for (const auto& [var, fixed_value] : fixed_vars) {
+        value[var] = static_cast<std::int8_t>(fixed_value);
+        if (class_of_[var] >= 0) {
+            touched.push_back(class_of_[var]);
+        }
+    }
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+
+    bool feasible = true;
+    for (const int id : touched) {
+        const std::vector<int>& columns = classes_[id];
+        const int size = static_cast<int>(columns.size());
+        int last_one = -1;
+        int first_zero = size;
+        for (int k = 0; k < size; ++k) {
+            const std::int8_t v = value[columns[k]];
+            if (v == 1) {
+                last_one = k;
+            } else if (v == 0 && first_zero == size) {
+                first_zero = k;
+            }
+        }
+        // Um 1 depois de um 0 viola x_{c_1} >= ... >= x_{c_k}
+        if (last_one > first_zero) {
+            feasible = false;
+            break;
+        }
+        for (int k = 0; k < last_one; ++k) {
+            if (value[columns[k]] == FREE) {
+                fixed_vars.emplace_back(columns[k], 1);
+            }
+        }
+        for (int k = first_zero + 1; k < size; ++k) {
+            if (value[columns[k]] == FREE) {
+                fixed_vars.emplace_back(columns[k], 0);
+            }
+        }
+    }
+
+    // Só as fixações do nó foram marcadas: o workspace volta a ter todas as colunas livres
+    for (std::size_t k = 0; k < node_fixings; ++k) {
+        value[fixed_vars[k].first] = FREE;
+    }
+    return feasible;
+}
@@ -0,0 +1,98 @@
+#include "WarmStart.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    // Limites da linha (base 1) com ±infinito para os lados ausentes
+    void rowBounds(glp_prob* problem, int row, double& lower, double& upper) {
+        const int type = glp_get_row_type(problem, row);
+        lower = (type == GLP_LO || type == GLP_DB || type == GLP_FX) ? glp_get_row_lb(problem, row) : -INF;
+        upper = (type == GLP_UP || type == GLP_DB || type == GLP_FX) ? glp_get_row_ub(problem, row) : INF;
+    }
+
+    void checkIndex(int index, int size, const char* what) {
+        if (index < 0 || index >= size) {
+            throw std::invalid_argument(std::string("ModelDelta: ") + what + " " + std::to_string(index) +
+                                        " fora do problema.");
+        }
+    }
+}
+
+bool ModelDelta::apply(glp_prob* problem) const {
+    if (!problem) {
+        throw std::invalid_argument("ModelDelta: problema nulo.");
+    }
+    const int num_rows = glp_get_num_rows(problem);
+    const int num_cols = glp_get_num_cols(problem);
+
+    // Validação completa antes de alterar o problema
+    for (const auto& [col, coef] : objective) {
+        checkIndex(col, num_cols, "coluna");
+    }
+    for (const RowBounds& bounds : row_bounds) {
+        checkIndex(bounds.row, num_rows, "linha");
+        if (std::isnan(bounds.lower) || std::isnan(bounds.upper) || bounds.lower > bounds.upper) {
+            throw std::invalid_argument("ModelDelta: limites inválidos para a linha " + std::to_string(bounds.row) + ".");
+        }
+    }
+    for (const Coefficient& coefficient : coefficients) {
+        checkIndex(coefficient.row, num_rows, "linha");
+        checkIndex(coefficient.col, num_cols, "coluna");
+    }
+
+    bool restricts_only = true;
+    for (const auto& [col, coef] : objective) {
+        restricts_only = restricts_only && glp_get_obj_coef(problem, col + 1) == coef;
+        glp_set_obj_coef(problem, col + 1, coef);
+    }
+
+    for (const RowBounds& bounds : row_bounds) {
+        double lower;
+        double upper;
+        rowBounds(problem, bounds.row + 1, lower, upper);
+        restricts_only = restricts_only && bounds.lower >= lower && bounds.upper <= upper;
+
+        int type = GLP_FR;
+        if (bounds.lower > -INF && bounds.upper < INF) {
+            type = bounds.lower == bounds.upper ? GLP_FX : GLP_DB;
+        } else if (bounds.lower > -INF) {
+            type = GLP_LO;
+        } else if (bounds.upper < INF) {
+            type = GLP_UP;
+        }
+        glp_set_row_bnds(problem, bounds.row + 1, type, type == GLP_UP ? 0.0 : bounds.lower,
+                         type == GLP_LO ? 0.0 : bounds.upper);
+    }
+
+    if (!coefficients.empty()) {
+        std::vector<int> index(static_cast<size_t>(num_cols) + 1);
+        std::vector<double> value(static_cast<size_t>(num_cols) + 1);
+        std::vector<double> dense(static_cast<size_t>(num_cols) + 1);
+        for (const Coefficient& coefficient : coefficients) {
+            const int row = coefficient.row + 1;
+            const int length = glp_get_mat_row(problem, row, index.data(), value.data());
+            for (int k = 1; k <= length; ++k) {
+                dense[index[k]] = value[k];
+            }
+            restricts_only = restricts_only && dense[coefficient.col + 1] == coefficient.value;
+            dense[coefficient.col + 1] = coefficient.value;
+
+            // Reescreve a linha sem os zeros (o GLPK rejeita elementos nulos ou repetidos)
+            int new_length = 0;
+            for (int j = 1; j <= num_cols; ++j) {
+                if (dense[j] != 0.0) {
+                    ++new_length;
+                    index[new_length] = j;
+                    value[new_length] = dense[j];
+                    dense[j] = 0.0;
+                }
+            }
+            glp_set_mat_row(problem, row, new_length, index.data(), value.data());
+        }
+    }
+    return restricts_only;
+}
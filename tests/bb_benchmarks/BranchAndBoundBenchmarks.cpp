@@ -0,0 +1,176 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "BinaryInstance.h"
+#include "BranchAndBound.h"
+#include "InstanceGenerator.h"
+#include "Logger.h"
+#include "ProblemModel.h"
+#include "ProblemReader.h"
+
+// Benchmarks sobre instâncias de mochila multidimensional geradas com semente fixa.
+// Argumentos comuns: n (itens), m (restrições) e correlação (índice de KnapsackCorrelation).
+// Exemplos:
+//   bb_benchmarks --benchmark_filter=BranchAndBound
+//   bb_benchmarks --benchmark_format=json --benchmark_out=resultado.json
+
+namespace {
+    constexpr std::uint64_t SEED = 2024;
+    constexpr double TIGHTNESS = 0.5;
+
+    KnapsackInstance makeInstance(const benchmark::State& state) {
+        KnapsackParams params;
+        params.num_items = static_cast<int>(state.range(0));
+        params.num_constraints = static_cast<int>(state.range(1));
+        params.correlation = static_cast<KnapsackCorrelation>(state.range(2));
+        params.tightness = TIGHTNESS;
+        params.seed = SEED;
+        return InstanceGenerator::multiKnapsack(params);
+    }
+
+    std::string describe(const benchmark::State& state) {
+        return InstanceGenerator::correlationName(static_cast<KnapsackCorrelation>(state.range(2)));
+    }
+
+    // Grava a instância em um arquivo temporário, no formato de texto denso ou binário
+    std::string writeInstance(const KnapsackInstance& instance, bool binary) {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() /
+            ("bb_bench_" + std::to_string(instance.num_items) + "x" + std::to_string(instance.num_constraints) +
+             (binary ? ".bbin" : ".txt"));
+        if (binary) {
+            GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+            BinaryInstance::write(problem.get(), path.string());
+        } else {
+            std::ofstream out(path);
+            instance.writeDenseText(out);
+        }
+        return path.string();
+    }
+
+    void readInstance(benchmark::State& state, bool binary) {
+        const std::string path = writeInstance(makeInstance(state), binary);
+        const auto bytes = static_cast<int64_t>(std::filesystem::file_size(path));
+        ProblemReader reader;
+        for (auto _ : state) {
+            GLPProbPtr problem(reader.read(path), GLPKProbDeleter());
+            benchmark::DoNotOptimize(problem.get());
+        }
+        state.SetBytesProcessed(state.iterations() * bytes);
+        std::filesystem::remove(path);
+    }
+}
+
+static void BM_ReadDenseText(benchmark::State& state) {
+    readInstance(state, false);
+}
+
+static void BM_ReadBinary(benchmark::State& state) {
+    readInstance(state, true);
+}
+
+BENCHMARK(BM_ReadDenseText)->ArgsProduct({{100, 1000}, {10, 100}, {0}})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReadBinary)->ArgsProduct({{100, 1000}, {10, 100}, {0}})->Unit(benchmark::kMicrosecond);
+
+// Relaxação linear da raiz, a partir de uma cópia nova do problema (sem base inicial)
+static void BM_RootLp(benchmark::State& state) {
+    const KnapsackInstance instance = makeInstance(state);
+    GLPProbPtr original(instance.toGlpk(), GLPKProbDeleter());
+    std::vector<double> solution;
+    double objective = 0.0;
+    long long lp_iterations = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        glp_prob* copy = glp_create_prob();
+        glp_copy_prob(copy, original.get(), GLP_OFF);
+        GLPKSolver solver{GLPProbPtr(copy, GLPKProbDeleter())};
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(solver.solve(solution, objective));
+        lp_iterations += solver.lastIterationCount();
+    }
+    state.counters["lp_iterations"] = benchmark::Counter(static_cast<double>(lp_iterations), benchmark::Counter::kAvgIterations);
+    state.SetLabel(describe(state));
+}
+
+BENCHMARK(BM_RootLp)->ArgsProduct({{50, 500}, {5, 30}, {0, 2}})->Unit(benchmark::kMicrosecond);
+
+// Branch and Bound completo para cada estratégia de seleção de nós (quarto argumento)
+static void BM_BranchAndBound(benchmark::State& state) {
+    const KnapsackInstance instance = makeInstance(state);
+    BranchAndBoundOptions options;
+    options.node_selection = static_cast<NodeSelection>(state.range(3));
+
+    long long nodes = 0;
+    long long lp_iterations = 0;
+    double objective = 0.0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+        BranchAndBound bb(options);
+        std::vector<int> solution;
+        state.ResumeTiming();
+
+        if (bb.solve(std::move(problem), solution, objective) != SolveStatus::OK) {
+            state.SkipWithError("Branch and Bound não terminou com solução ótima");
+            break;
+        }
+        nodes += bb.stats().nodes;
+        lp_iterations += bb.stats().lp_iterations;
+    }
+    state.counters["nodes"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kAvgIterations);
+    state.counters["nodes/s"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kIsRate);
+    state.counters["lp_iterations"] = benchmark::Counter(static_cast<double>(lp_iterations), benchmark::Counter::kAvgIterations);
+    state.counters["objective"] = objective;
+    state.SetLabel(describe(state));
+}
+
+BENCHMARK(BM_BranchAndBound)
+    ->ArgNames({"n", "m", "corr", "sel"})
+    ->ArgsProduct({
+        {20, 30},
+        {5},
+        {0, 1, 2},
+        {static_cast<int64_t>(NodeSelection::DEPTH_FIRST), static_cast<int64_t>(NodeSelection::BREADTH_FIRST),
+         static_cast<int64_t>(NodeSelection::BEST_BOUND), static_cast<int64_t>(NodeSelection::BEST_ESTIMATE),
+         static_cast<int64_t>(NodeSelection::HYBRID)}})
+    ->Unit(benchmark::kMillisecond);
+
+// Verificação de viabilidade de soluções completas sobre o modelo em cache
+static void BM_FeasibilityCheck(benchmark::State& state) {
+    const KnapsackInstance instance = makeInstance(state);
+    GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+
+    // Soluções aleatórias com cerca de metade dos itens: mistura de viáveis e inviáveis
+    std::mt19937_64 rng(SEED);
+    std::vector<std::vector<int>> solutions(256, std::vector<int>(instance.num_items));
+    for (std::vector<int>& solution : solutions) {
+        for (int& value : solution) {
+            value = static_cast<int>(rng() & 1);
+        }
+    }
+
+    size_t k = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.isFeasible(solutions[k]));
+        k = (k + 1) % solutions.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_FeasibilityCheck)->ArgsProduct({{100, 1000}, {10, 100}, {0}});
+
+int main(int argc, char** argv) {
+    // O solver registra cada incumbente em INFO; nos benchmarks apenas avisos e erros interessam
+    Logger::instance().setLevel(LogLevel::WARNING);
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -1,7 +1,27 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <sstream>
 #include <vector>
+#include "BasisPool.h"
+#include "BatchSolver.h"
+#include "BinaryInstance.h"
+#include "InstanceGenerator.h"
+#include "Lagrangian.h"
 #include "BranchAndBound.h"
+#include "Conflicts.h"
+#include "FixingArena.h"
+#include "Logger.h"
+#include "LpCache.h"
+#include "MappedFile.h"
+#include "NodeSpillFile.h"
+#include "Presolve.h"
 #include "ProblemReader.h"
+#include "Symmetry.h"
+#include "WarmStart.h"
 
 class BranchAndBoundTest : public ::testing::TestWithParam<std::tuple<std::string, double, bool>> {
 protected:
@@ -15,7 +35,9 @@ protected:
             using GLPProbPtr = std::unique_ptr<glp_prob, GLPKProbDeleter>;
             GLPProbPtr problem(raw_problem, GLPKProbDeleter());
 
-            BranchAndBound bb;
+            BranchAndBoundOptions options;
+            options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+            BranchAndBound bb(options);
             std::vector<int> solution;
             double objective_value = 0.0;
 
@@ -50,3 +72,1456 @@ TEST_P(BranchAndBoundTest, ParametrizedTest) {
     auto [filename, expected_objective, use_depth_first] = GetParam();
     RunTest(filename, expected_objective, use_depth_first);
 }
+
+class NodeSelectionTest : public ::testing::TestWithParam<std::tuple<std::string, double, NodeSelection>> {};
+
+TEST_P(NodeSelectionTest, FindsOptimum) {
+    auto [filename, expected_objective, selection] = GetParam();
+    ProblemReader reader;
+    GLPProbPtr problem(reader.read(filename), GLPKProbDeleter());
+
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.node_selection = selection;
+    BranchAndBound bb(options);
+    std::vector<int> solution;
+    double objective_value = 0.0;
+
+    SolveStatus status = bb.solve(std::move(problem), solution, objective_value);
+    ASSERT_EQ(int(status), int(SolveStatus::OK)) << "Failed to solve the problem: " << filename;
+    EXPECT_NEAR(objective_value, expected_objective, 1e-6)
+        << "Incorrect objective value for: " << filename;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    NodeSelectionTests,
+    NodeSelectionTest,
+    ::testing::Values(
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, NodeSelection::BEST_BOUND),
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, NodeSelection::BEST_ESTIMATE),
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, NodeSelection::HYBRID),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, NodeSelection::BEST_BOUND),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, NodeSelection::BEST_ESTIMATE),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, NodeSelection::HYBRID),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, NodeSelection::BEST_BOUND),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, NodeSelection::BEST_ESTIMATE),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, NodeSelection::HYBRID),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, NodeSelection::BEST_BOUND),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, NodeSelection::BEST_ESTIMATE),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, NodeSelection::HYBRID)
+    )
+);
+
+class SharedTrailTest : public ::testing::TestWithParam<std::tuple<std::string, double, NodeSelection>> {};
+
+TEST_P(SharedTrailTest, FindsOptimum) {
+    auto [filename, expected_objective, selection] = GetParam();
+    ProblemReader reader;
+    GLPProbPtr problem(reader.read(filename), GLPKProbDeleter());
+
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.node_selection = selection;
+    options.lp_strategy = LpStrategy::SHARED_TRAIL;
+    BranchAndBound bb(options);
+    std::vector<int> solution;
+    double objective_value = 0.0;
+
+    SolveStatus status = bb.solve(std::move(problem), solution, objective_value);
+    ASSERT_EQ(int(status), int(SolveStatus::OK)) << "Failed to solve the problem: " << filename;
+    EXPECT_NEAR(objective_value, expected_objective, 1e-6)
+        << "Incorrect objective value for: " << filename;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SharedTrailTests,
+    SharedTrailTest,
+    ::testing::Values(
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, NodeSelection::DEPTH_FIRST),
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, NodeSelection::BEST_BOUND),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, NodeSelection::DEPTH_FIRST),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, NodeSelection::BEST_BOUND),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, NodeSelection::DEPTH_FIRST),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, NodeSelection::BEST_BOUND),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, NodeSelection::DEPTH_FIRST),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, NodeSelection::BEST_BOUND)
+    )
+);
+
+class ProblemReaderTest : public ::testing::TestWithParam<std::tuple<std::string, InstanceFormat, double>> {};
+
+TEST_P(ProblemReaderTest, ReadsEquivalentFormats) {
+    auto [filename, format, expected_objective] = GetParam();
+    ProblemReader reader;
+    MappedFile file(filename);
+    EXPECT_EQ(int(ProblemReader::detectFormat(filename, file.view())), int(format));
+    EXPECT_EQ(int(ProblemReader::detectFormat("", file.view())), int(format));
+
+    // A mesma matriz do arquivo denso, em qualquer formato
+    GLPProbPtr dense(reader.read("/app/tests/teste3_19.txt"), GLPKProbDeleter());
+    GLPProbPtr problem(reader.read(filename), GLPKProbDeleter());
+    const ProblemModel expected = ProblemModel::fromGlpk(dense.get());
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+    ASSERT_EQ(model.numRows(), expected.numRows());
+    ASSERT_EQ(model.numCols(), expected.numCols());
+    for (int i = 0; i < model.numRows(); ++i) {
+        EXPECT_EQ(model.rowEnd(i) - model.rowStart(i), expected.rowEnd(i) - expected.rowStart(i));
+        EXPECT_EQ(model.rowUpper(i), expected.rowUpper(i));
+    }
+
+    BranchAndBound bb;
+    std::vector<int> solution;
+    double objective_value = 0.0;
+    ASSERT_EQ(int(bb.solve(std::move(problem), solution, objective_value)), int(SolveStatus::OK));
+    EXPECT_NEAR(objective_value, expected_objective, 1e-6);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ProblemReaderTests,
+    ProblemReaderTest,
+    ::testing::Values(
+        std::make_tuple("/app/tests/teste3_19.txt", InstanceFormat::DENSE_TEXT, 19.0),
+        std::make_tuple("/app/tests/teste3_19.lp", InstanceFormat::CPLEX_LP, 19.0),
+        std::make_tuple("/app/tests/teste3_19.mps", InstanceFormat::FREE_MPS, -19.0) // Minimização
+    )
+);
+
+TEST(ProblemReaderTest, ParsesWideAndFeatureRichInstances) {
+    ProblemReader reader;
+
+    // 100 mil colunas em uma linha densa (antes estouravam a pilha), coeficientes nulos descartados
+    const int num_vars = 100000;
+    std::string wide = std::to_string(num_vars) + " 1\n";
+    for (int j = 0; j < num_vars; ++j) {
+        wide += "1 ";
+    }
+    wide += "\n";
+    for (int j = 0; j < num_vars; ++j) {
+        wide += j % 2 == 0 ? "0 " : "2.5 ";
+    }
+    wide += "10\n";
+    GLPProbPtr wide_problem(reader.parse(wide, InstanceFormat::AUTO), GLPKProbDeleter());
+    const ProblemModel wide_model = ProblemModel::fromGlpk(wide_problem.get());
+    EXPECT_EQ(wide_model.numCols(), num_vars);
+    EXPECT_EQ(wide_model.rowEnd(0) - wide_model.rowStart(0), num_vars / 2);
+
+    // LP com constante no objetivo, termos repetidos, intervalo, limites e comentários
+    const std::string lp =
+        "\\ exemplo\n"
+        "maximize\n obj: 3 x + 2y - z + 4\n"
+        "subject to\n"
+        " c1: x + y + x <= 2.5\n"
+        " -1 <= y - z <= 1\n"
+        " c3: x + z >= 1\n"
+        "bounds\n 0 <= x <= 1\n z <= 1\n y = 1\n"
+        "binary\n x z\ngeneral\n y\n"
+        "end\n";
+    GLPProbPtr lp_problem(reader.parse(lp, InstanceFormat::CPLEX_LP), GLPKProbDeleter());
+    const ProblemModel lp_model = ProblemModel::fromGlpk(lp_problem.get());
+    ASSERT_EQ(lp_model.numCols(), 3);
+    ASSERT_EQ(lp_model.numRows(), 3);
+    EXPECT_EQ(lp_model.objectiveConstant(), 4.0);
+    EXPECT_EQ(lp_model.rowValue(lp_model.rowStart(0)), 2.0); // x + x
+    EXPECT_EQ(lp_model.rowLower(1), -1.0);
+    EXPECT_EQ(lp_model.rowUpper(1), 1.0);
+    EXPECT_EQ(glp_get_col_type(lp_problem.get(), 2), GLP_FX);
+    EXPECT_STREQ(glp_get_col_name(lp_problem.get(), 2), "y");
+
+    // Variáveis inteiras gerais e contínuas (mesmo em [0, 1]) não são aceitas
+    EXPECT_THROW(reader.parse("max\n x\nst\n x <= 3\ngeneral\n x\nend\n", InstanceFormat::CPLEX_LP),
+                 std::invalid_argument);
+    EXPECT_THROW(reader.parse("max\n x + y\nst\n x + y <= 1\nbounds\n x <= 1\n y <= 1\nbinary\n y\nend\n",
+                              InstanceFormat::CPLEX_LP), std::invalid_argument);
+    const std::string continuous_mps =
+        "NAME T\nROWS\n N obj\n L c1\nCOLUMNS\n x obj 1 c1 1\nRHS\n rhs c1 1\nBOUNDS\n UP bnd x 1\nENDATA\n";
+    EXPECT_THROW(reader.parse(continuous_mps, InstanceFormat::FREE_MPS), std::invalid_argument);
+    EXPECT_THROW(reader.parse("sem formato", InstanceFormat::AUTO), std::invalid_argument);
+}
+
+TEST(BinaryInstanceTest, RoundTripsAndRejectsCorruption) {
+    ProblemReader reader;
+    const std::string path = ::testing::TempDir() + "teste3_19.bbin";
+    for (const std::string source : {"/app/tests/teste3_19.txt", "/app/tests/teste3_19.mps"}) {
+        GLPProbPtr original(reader.read(source), GLPKProbDeleter());
+        BinaryInstance::write(original.get(), path);
+
+        // Mesma formulação, inclusive o sentido da otimização
+        MappedFile file(path);
+        EXPECT_EQ(int(ProblemReader::detectFormat("", file.view())), int(InstanceFormat::BINARY));
+        GLPProbPtr loaded(reader.read(path), GLPKProbDeleter());
+        EXPECT_EQ(glp_get_obj_dir(loaded.get()), glp_get_obj_dir(original.get()));
+        const ProblemModel expected = ProblemModel::fromGlpk(original.get());
+        const ProblemModel model = ProblemModel::fromGlpk(loaded.get());
+        ASSERT_EQ(model.numRows(), expected.numRows());
+        ASSERT_EQ(model.numCols(), expected.numCols());
+        for (int i = 0; i < model.numRows(); ++i) {
+            ASSERT_EQ(model.rowEnd(i), expected.rowEnd(i));
+            EXPECT_EQ(model.rowUpper(i), expected.rowUpper(i));
+            for (int k = model.rowStart(i); k < model.rowEnd(i); ++k) {
+                EXPECT_EQ(model.rowCol(k), expected.rowCol(k));
+                EXPECT_EQ(model.rowValue(k), expected.rowValue(k));
+            }
+        }
+        EXPECT_EQ(model.objective(), expected.objective());
+
+        // Qualquer byte alterado no conteúdo é detectado pelo checksum
+        std::string corrupted(file.view());
+        corrupted[corrupted.size() - 9] ^= 0x10;
+        EXPECT_THROW(reader.parse(corrupted, InstanceFormat::AUTO), std::invalid_argument);
+        EXPECT_THROW(reader.parse(std::string(file.view()).substr(0, 100), InstanceFormat::BINARY),
+                     std::invalid_argument);
+    }
+
+    BranchAndBound bb;
+    std::vector<int> solution;
+    double objective_value = 0.0;
+    ASSERT_EQ(int(bb.solve(GLPProbPtr(reader.read(path), GLPKProbDeleter()), solution, objective_value)),
+              int(SolveStatus::OK));
+    EXPECT_NEAR(objective_value, -19.0, 1e-6);
+
+    // Cabeçalho, estrutura e limites são conferidos antes de chegar ao GLPK: 1 linha, x1 + x2 <= 1
+    GLPProbPtr small(glp_create_prob(), GLPKProbDeleter());
+    glp_add_rows(small.get(), 1);
+    glp_add_cols(small.get(), 2);
+    glp_set_row_bnds(small.get(), 1, GLP_UP, 0.0, 1.0);
+    int index[] = {0, 1, 2};
+    double values[] = {0.0, 1.0, 1.0};
+    glp_set_mat_row(small.get(), 1, 2, index, values);
+    for (int j = 1; j <= 2; ++j) {
+        glp_set_col_bnds(small.get(), j, GLP_DB, 0.0, 1.0);
+    }
+    const std::string small_path = ::testing::TempDir() + "small.bbin";
+    BinaryInstance::write(small.get(), small_path);
+    const std::string valid(MappedFile(small_path).view());
+    EXPECT_NO_THROW(GLPProbPtr(reader.parse(valid, InstanceFormat::BINARY), GLPKProbDeleter()));
+    // Refaz o checksum (FNV-1a em palavras de 64 bits, no fim do cabeçalho de 64 bytes)
+    const auto resealed = [](std::string contents) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (size_t k = 64; k < contents.size(); k += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, contents.data() + k, sizeof(word));
+            hash = (hash ^ word) * 1099511628211ULL;
+        }
+        std::memcpy(&contents[56], &hash, sizeof(hash));
+        return contents;
+    };
+    std::string huge = valid;
+    const std::int64_t nonzeros = std::int64_t{1} << 61; // (nnz + 1) * 8 dá a volta em 64 bits
+    std::memcpy(&huge[32], &nonzeros, sizeof(nonzeros));
+    EXPECT_THROW(reader.parse(huge, InstanceFormat::BINARY), std::invalid_argument);
+    std::string repeated = valid;
+    const std::int32_t first_col = 1;
+    std::memcpy(&repeated[64 + 104], &first_col, sizeof(first_col)); // Coluna da 2ª entrada: x1 de novo
+    EXPECT_THROW(reader.parse(resealed(repeated), InstanceFormat::BINARY), std::invalid_argument);
+    glp_set_col_bnds(small.get(), 2, GLP_DB, 0.0, 2.0);
+    BinaryInstance::write(small.get(), small_path);
+    EXPECT_THROW(reader.parse(std::string(MappedFile(small_path).view()), InstanceFormat::BINARY),
+                 std::invalid_argument);
+}
+
+TEST(GLPKSolverTest, WarmStartFromSavedBasis) {
+    ProblemReader reader;
+    GLPKSolver solver(GLPProbPtr(reader.read("/app/tests/teste3_19.txt"), GLPKProbDeleter()));
+
+    std::vector<double> relaxed;
+    double root_objective = 0.0;
+    ASSERT_EQ(int(solver.solve(relaxed, root_objective)), int(SolveStatus::OK));
+    LpBasis basis = solver.saveBasis();
+    ASSERT_FALSE(basis.empty());
+
+    // Re-solving from the optimal basis must give the same bound
+    ASSERT_TRUE(solver.restoreBasis(basis));
+    double warm_objective = 0.0;
+    ASSERT_EQ(int(solver.solve(relaxed, warm_objective)), int(SolveStatus::OK));
+    EXPECT_NEAR(warm_objective, root_objective, 1e-9);
+
+    // A basis with different dimensions is rejected
+    LpBasis wrong = basis;
+    wrong.row_stat.push_back(GLP_BS);
+    EXPECT_FALSE(solver.restoreBasis(wrong));
+}
+
+TEST(PropagatorTest, FixesByRowSlackAndReducedCost) {
+    // max 5x1 + 4x2 + 3x3  s.a.  3x1 + 4x2 + 5x3 <= 6
+    GLPProbPtr problem(glp_create_prob(), GLPKProbDeleter());
+    glp_set_obj_dir(problem.get(), GLP_MAX);
+    glp_add_rows(problem.get(), 1);
+    glp_set_row_bnds(problem.get(), 1, GLP_UP, 0.0, 6.0);
+    glp_add_cols(problem.get(), 3);
+    int indices[] = {0, 1, 2, 3};
+    double weights[] = {0.0, 3.0, 4.0, 5.0};
+    for (int j = 1; j <= 3; ++j) {
+        glp_set_col_bnds(problem.get(), j, GLP_DB, 0.0, 1.0);
+        glp_set_obj_coef(problem.get(), j, 6.0 - j);
+    }
+    glp_set_mat_row(problem.get(), 1, 3, indices, weights);
+
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+    ASSERT_EQ(model.numRows(), 1);
+    ASSERT_EQ(model.numCols(), 3);
+    const Propagator propagator(model);
+
+    // Com x1 = 1 sobram 3 unidades: x2 e x3 não cabem
+    std::vector<std::pair<int, int>> fixed = {{0, 1}};
+    ASSERT_TRUE(propagator.propagate(fixed));
+    EXPECT_EQ(fixed, (std::vector<std::pair<int, int>>{{0, 1}, {1, 0}, {2, 0}}));
+
+    // x1 = x3 = 1 já excede a capacidade
+    std::vector<std::pair<int, int>> infeasible = {{0, 1}, {2, 1}};
+    EXPECT_FALSE(propagator.propagate(infeasible));
+
+    // Limite 9 com incumbente 7.5: trocar x1 de lado custa 2 e é fixado; x3 (custo 1) não
+    std::vector<std::pair<int, int>> rc_fixed;
+    const int count = propagator.fixByReducedCost({1.0, 0.75, 0.0}, {2.0, 0.0, -1.0}, 9.0, 7.5, rc_fixed);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(rc_fixed, (std::vector<std::pair<int, int>>{{0, 1}}));
+}
+
+TEST(ProblemModelTest, KernelsMatchScalarAndTrackFlips) {
+    // Uma matriz densa (cópia por linhas) e uma esparsa (CSR), com número de colunas fora do múltiplo de 8
+    for (int density : {100, 20}) {
+        std::mt19937 rng(density);
+        const int num_rows = 7;
+        const int num_cols = 37;
+        GLPProbPtr problem(glp_create_prob(), GLPKProbDeleter());
+        glp_set_obj_dir(problem.get(), GLP_MAX);
+        glp_add_cols(problem.get(), num_cols);
+        glp_add_rows(problem.get(), num_rows);
+        std::vector<std::vector<double>> dense(num_rows, std::vector<double>(num_cols, 0.0));
+        for (int i = 0; i < num_rows; ++i) {
+            std::vector<int> indices = {0};
+            std::vector<double> values = {0.0};
+            for (int j = 0; j < num_cols; ++j) {
+                if (static_cast<int>(rng() % 100) < density) {
+                    dense[i][j] = static_cast<double>(rng() % 19) - 4.0;
+                    if (dense[i][j] != 0.0) {
+                        indices.push_back(j + 1);
+                        values.push_back(dense[i][j]);
+                    }
+                }
+            }
+            glp_set_mat_row(problem.get(), i + 1, static_cast<int>(indices.size()) - 1, indices.data(), values.data());
+            glp_set_row_bnds(problem.get(), i + 1, GLP_DB, -10.0, 40.0);
+        }
+        const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+        EXPECT_EQ(model.hasDenseRows(), density == 100);
+
+        std::vector<int> solution(num_cols);
+        std::vector<double> fractional(num_cols);
+        for (int j = 0; j < num_cols; ++j) {
+            solution[j] = static_cast<int>(rng() % 2);
+            fractional[j] = static_cast<double>(rng() % 1000) / 1000.0;
+        }
+        RowActivity activity(model, solution);
+        for (int i = 0; i < num_rows; ++i) {
+            double expected = 0.0;
+            double expected_fractional = 0.0;
+            for (int j = 0; j < num_cols; ++j) {
+                expected += dense[i][j] * solution[j];
+                expected_fractional += dense[i][j] * fractional[j];
+            }
+            EXPECT_NEAR(model.rowActivity(i, solution.data()), expected, 1e-9);
+            EXPECT_NEAR(model.rowActivity(i, fractional.data()), expected_fractional, 1e-9);
+            EXPECT_NEAR(activity[i], expected, 1e-9);
+        }
+
+        // Trocas incrementais equivalem a recalcular do zero
+        for (int flip = 0; flip < 50; ++flip) {
+            const int j = static_cast<int>(rng() % num_cols);
+            if (solution[j] == 0) {
+                activity.add(j);
+            } else {
+                activity.remove(j);
+            }
+            solution[j] = 1 - solution[j];
+        }
+        const RowActivity recomputed(model, solution);
+        for (int i = 0; i < num_rows; ++i) {
+            EXPECT_NEAR(activity[i], recomputed[i], 1e-9);
+        }
+        EXPECT_EQ(activity.feasible(), model.isFeasible(solution));
+    }
+}
+
+TEST(HeuristicsTest, RootHeuristicsFindFeasibleIncumbent) {
+    ProblemReader reader;
+    GLPKSolver solver(GLPProbPtr(reader.read("/app/tests/teste3_19.txt"), GLPKProbDeleter()));
+    const ProblemModel model = ProblemModel::fromGlpk(solver.getProblem());
+
+    std::vector<double> relaxed;
+    double root_objective = 0.0;
+    ASSERT_EQ(int(solver.solve(relaxed, root_objective)), int(SolveStatus::OK));
+
+    HeuristicParams params;
+    PrimalHeuristics heuristics(model, params);
+    Incumbent incumbent;
+    long long lp_iterations = 0;
+    const std::vector<std::pair<int, int>> no_fixings;
+    const HeuristicContext context{relaxed, root_objective, no_fixings, 0, incumbent.value(), &solver};
+    EXPECT_TRUE(heuristics.runAtNode(context, incumbent, lp_iterations));
+
+    // Solução viável e limitada pelo ótimo; o LP do nó volta ao estado original
+    ASSERT_TRUE(incumbent.hasSolution());
+    EXPECT_TRUE(model.isFeasible(incumbent.solution()));
+    EXPECT_LE(incumbent.value(), 19.0 + 1e-6);
+    EXPECT_NEAR(incumbent.value(), model.objectiveValue(incumbent.solution()), 1e-9);
+    for (int j = 1; j <= model.numCols(); ++j) {
+        EXPECT_NE(glp_get_col_type(solver.getProblem(), j), GLP_FX);
+    }
+    EXPECT_EQ(heuristics.heuristics().front()->stats().calls, 1);
+}
+
+TEST(CutsTest, SeparatesLiftedCoverAndClique) {
+    // 3x1 + 4x2 + 5x3 + 6x4 <= 8
+    GLPProbPtr problem(glp_create_prob(), GLPKProbDeleter());
+    glp_set_obj_dir(problem.get(), GLP_MAX);
+    glp_add_rows(problem.get(), 1);
+    glp_set_row_bnds(problem.get(), 1, GLP_UP, 0.0, 8.0);
+    glp_add_cols(problem.get(), 4);
+    int indices[] = {0, 1, 2, 3, 4};
+    double weights[] = {0.0, 3.0, 4.0, 5.0, 6.0};
+    for (int j = 1; j <= 4; ++j) {
+        glp_set_col_bnds(problem.get(), j, GLP_DB, 0.0, 1.0);
+    }
+    glp_set_mat_row(problem.get(), 1, 4, indices, weights);
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+
+    CutParams params;
+    const CutSeparator separator(model, params);
+    EXPECT_FALSE(separator.conflict(0, 2));
+    EXPECT_TRUE(separator.conflict(1, 2));
+    EXPECT_TRUE(separator.conflict(0, 3));
+
+    // Cobertura {x2, x3} (9 > 8) com lifting: x4 recebe coeficiente 1, x1 (que cabe com x2) fica de fora
+    const std::vector<double> relaxed = {0.0, 0.75, 0.75, 0.0};
+    Cut cover;
+    ASSERT_TRUE(separator.separateCover(0, relaxed, cover));
+    EXPECT_DOUBLE_EQ(cover.rhs, 1.0);
+    EXPECT_NEAR(cover.violation(relaxed), 0.5, 1e-9);
+    std::vector<int> vars = cover.vars;
+    std::sort(vars.begin(), vars.end());
+    EXPECT_EQ(vars, (std::vector<int>{1, 2, 3}));
+
+    // O pool descarta duplicatas independentemente da ordem dos termos
+    CutPool pool;
+    EXPECT_TRUE(pool.add(cover).second);
+    Cut reversed = cover;
+    std::reverse(reversed.vars.begin(), reversed.vars.end());
+    std::reverse(reversed.coefs.begin(), reversed.coefs.end());
+    EXPECT_FALSE(pool.add(reversed).second);
+    EXPECT_EQ(pool.size(), 1u);
+
+    // O corte entra no LP como linha identificável
+    CutPool::addToProblem(problem.get(), 0, cover);
+    EXPECT_EQ(CutPool::idOfRow(problem.get(), 2), 0);
+    EXPECT_EQ(CutPool::idOfRow(problem.get(), 1), -1);
+}
+
+class CuttingPlaneTest : public ::testing::TestWithParam<std::tuple<std::string, double, LpStrategy, int>> {};
+
+TEST_P(CuttingPlaneTest, FindsOptimumWithTreeCuts) {
+    auto [filename, expected_objective, lp_strategy, num_threads] = GetParam();
+    ProblemReader reader;
+    GLPProbPtr problem(reader.read(filename), GLPKProbDeleter());
+
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.lp_strategy = lp_strategy;
+    options.num_threads = num_threads;
+    options.cuts.tree_frequency = 1;
+    BranchAndBound bb(options);
+    std::vector<int> solution;
+    double objective_value = 0.0;
+
+    SolveStatus status = bb.solve(std::move(problem), solution, objective_value);
+    ASSERT_EQ(int(status), int(SolveStatus::OK)) << "Failed to solve the problem: " << filename;
+    EXPECT_NEAR(objective_value, expected_objective, 1e-6)
+        << "Incorrect objective value for: " << filename;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CuttingPlaneTests,
+    CuttingPlaneTest,
+    ::testing::Values(
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, LpStrategy::COPY_PER_NODE, 1),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, LpStrategy::SHARED_TRAIL, 1),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, LpStrategy::SHARED_TRAIL, 1),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, LpStrategy::COPY_PER_NODE, 4)
+    )
+);
+
+TEST(PresolveTest, ReducesAndRestoresSolution) {
+    // max 5x1 + 4x2 + 3x3 + 2x4 + x5  s.a.  7x1 + 2x2 + 2x3 + 3x4 <= 6,  x2 + x3 <= 5,  4x2 + 5x3 <= 8
+    auto build = []() {
+        GLPProbPtr problem(glp_create_prob(), GLPKProbDeleter());
+        glp_set_obj_dir(problem.get(), GLP_MAX);
+        glp_add_cols(problem.get(), 5);
+        for (int j = 1; j <= 5; ++j) {
+            glp_set_col_bnds(problem.get(), j, GLP_DB, 0.0, 1.0);
+            glp_set_obj_coef(problem.get(), j, 6.0 - j);
+        }
+        glp_add_rows(problem.get(), 3);
+        int row1_indices[] = {0, 1, 2, 3, 4};
+        double row1_values[] = {0.0, 7.0, 2.0, 2.0, 3.0};
+        glp_set_mat_row(problem.get(), 1, 4, row1_indices, row1_values);
+        glp_set_row_bnds(problem.get(), 1, GLP_UP, 0.0, 6.0);
+        int pair_indices[] = {0, 2, 3};
+        double row2_values[] = {0.0, 1.0, 1.0};
+        glp_set_mat_row(problem.get(), 2, 2, pair_indices, row2_values);
+        glp_set_row_bnds(problem.get(), 2, GLP_UP, 0.0, 5.0);
+        double row3_values[] = {0.0, 4.0, 5.0};
+        glp_set_mat_row(problem.get(), 3, 2, pair_indices, row3_values);
+        glp_set_row_bnds(problem.get(), 3, GLP_UP, 0.0, 8.0);
+        return problem;
+    };
+
+    // x1 não cabe, a linha 2 é redundante, x5 não tem travas e x2 domina x3 (conflito na linha 3)
+    GLPProbPtr problem = build();
+    Presolver presolver;
+    Postsolve postsolve;
+    GLPProbPtr reduced = presolver.run(problem.get(), postsolve);
+    ASSERT_NE(reduced, nullptr);
+    EXPECT_EQ(presolver.stats().dominated_cols, 1);
+    EXPECT_EQ(presolver.stats().removed_rows, 3);
+    EXPECT_GT(presolver.stats().tightened_coefs, 0);
+    EXPECT_EQ(postsolve.originalCols(), 5);
+    EXPECT_EQ(postsolve.reducedCols(), 0);
+    EXPECT_NEAR(glp_get_obj_coef(reduced.get(), 0), 7.0, 1e-9);
+    EXPECT_EQ(postsolve.restore({}), (std::vector<int>{0, 1, 0, 1, 1}));
+
+    // O resultado com e sem presolve é o mesmo
+    for (bool presolve : {true, false}) {
+        BranchAndBoundOptions options;
+        options.presolve = presolve;
+        BranchAndBound bb(options);
+        std::vector<int> solution;
+        double objective_value = 0.0;
+        ASSERT_EQ(int(bb.solve(build(), solution, objective_value)), int(SolveStatus::OK));
+        EXPECT_NEAR(objective_value, 7.0, 1e-6);
+        EXPECT_EQ(solution, (std::vector<int>{0, 1, 0, 1, 1}));
+    }
+}
+
+class ParallelSearchTest : public ::testing::TestWithParam<std::tuple<std::string, double, int>> {};
+
+TEST_P(ParallelSearchTest, FindsOptimum) {
+    auto [filename, expected_objective, num_threads] = GetParam();
+    ProblemReader reader;
+    GLPProbPtr problem(reader.read(filename), GLPKProbDeleter());
+
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.num_threads = num_threads;
+    BranchAndBound bb(options);
+    std::vector<int> solution;
+    double objective_value = 0.0;
+
+    SolveStatus status = bb.solve(std::move(problem), solution, objective_value);
+    ASSERT_EQ(int(status), int(SolveStatus::OK)) << "Failed to solve the problem: " << filename;
+    EXPECT_NEAR(objective_value, expected_objective, 1e-6)
+        << "Incorrect objective value for: " << filename;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParallelSearchTests,
+    ParallelSearchTest,
+    ::testing::Values(
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, 2),
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, 4),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, 2),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, 4),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, 2),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, 4),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, 2),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, 4)
+    )
+);
+
+TEST(LoggerTest, FiltersByLevelAndFormatsLines) {
+    std::ostringstream sink;
+    Logger& logger = Logger::instance();
+    const LogLevel previous = logger.level();
+    logger.setSink(sink);
+    logger.setLevel(LogLevel::WARNING);
+
+    int evaluations = 0;
+    auto count = [&evaluations]() { return ++evaluations; };
+    BB_LOG_INFO("Test") << "hidden " << count();
+    BB_LOG_ERROR("Test") << "shown " << count();
+    logger.flush();
+
+    // Arguments of disabled levels are never evaluated
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_EQ(sink.str(), "[Test][ERRO] shown 1\n");
+
+    logger.setLevel(previous);
+    logger.setSink(std::clog);
+}
+
+class BranchingRuleTest : public ::testing::TestWithParam<std::tuple<std::string, double, BranchingStrategy>> {};
+
+TEST_P(BranchingRuleTest, FindsOptimum) {
+    auto [filename, expected_objective, branching] = GetParam();
+    ProblemReader reader;
+    GLPProbPtr problem(reader.read(filename), GLPKProbDeleter());
+
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.node_selection = NodeSelection::BEST_BOUND;
+    options.branching = branching;
+    BranchAndBound bb(options);
+    std::vector<int> solution;
+    double objective_value = 0.0;
+
+    SolveStatus status = bb.solve(std::move(problem), solution, objective_value);
+    ASSERT_EQ(int(status), int(SolveStatus::OK)) << "Failed to solve the problem: " << filename;
+    EXPECT_NEAR(objective_value, expected_objective, 1e-6)
+        << "Incorrect objective value for: " << filename;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BranchingRuleTests,
+    BranchingRuleTest,
+    ::testing::Values(
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, BranchingStrategy::PSEUDO_COST),
+        std::make_tuple("/app/tests/teste1_20.txt", 20.0, BranchingStrategy::RELIABILITY),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, BranchingStrategy::PSEUDO_COST),
+        std::make_tuple("/app/tests/teste2_24.txt", 24.0, BranchingStrategy::RELIABILITY),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, BranchingStrategy::PSEUDO_COST),
+        std::make_tuple("/app/tests/teste3_19.txt", 19.0, BranchingStrategy::RELIABILITY),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, BranchingStrategy::PSEUDO_COST),
+        std::make_tuple("/app/tests/teste4_10.txt", 10.0, BranchingStrategy::RELIABILITY)
+    )
+);
+
+TEST(BatchSolverTest, SolvesDirectoryInParallelAndWritesResults) {
+    // Diretório de testes: as seis instâncias (texto, LP e MPS); o subdiretório é ignorado
+    const std::vector<std::string> instances = BatchSolver::expandInputs({"/app/tests"});
+    ASSERT_EQ(instances.size(), 6u);
+    EXPECT_TRUE(std::is_sorted(instances.begin(), instances.end()));
+
+    BatchSolver batch(BranchAndBoundOptions{}, 3);
+    int callbacks = 0;
+    const std::vector<BatchResult> results = batch.run(instances, [&](const BatchResult&) { ++callbacks; });
+    ASSERT_EQ(results.size(), instances.size());
+    EXPECT_EQ(callbacks, 6);
+    for (size_t k = 0; k < results.size(); ++k) {
+        EXPECT_EQ(results[k].instance, instances[k]);
+        EXPECT_EQ(int(results[k].status), int(SolveStatus::OK)) << results[k].instance << ": " << results[k].error;
+        EXPECT_TRUE(results[k].has_solution);
+        EXPECT_GT(results[k].stats.nodes, 0);
+    }
+    EXPECT_NEAR(results[0].objective, 20.0, 1e-6);  // teste1_20.txt
+    EXPECT_NEAR(results[3].objective, -19.0, 1e-6); // teste3_19.mps (minimização)
+
+    // Arquivo inexistente vira um resultado com erro, sem interromper o lote
+    const BatchResult missing = batch.solveOne("/app/tests/inexistente.txt");
+    EXPECT_EQ(int(missing.status), int(SolveStatus::ERROR));
+    EXPECT_FALSE(missing.error.empty());
+
+    std::ostringstream json;
+    BatchSolver::write(json, results[0], OutputFormat::JSON_LINES, false);
+    EXPECT_EQ(json.str().rfind("{\"instance\":\"/app/tests/teste1_20.txt\",\"status\":\"optimal\",\"objective\":20,\"gap\":0,", 0), 0u)
+        << json.str();
+    std::ostringstream failed;
+    BatchSolver::write(failed, missing, OutputFormat::JSON_LINES, true);
+    EXPECT_NE(failed.str().find("\"objective\":null"), std::string::npos) << failed.str();
+    EXPECT_NE(failed.str().find("\"solution\":null"), std::string::npos) << failed.str();
+
+    std::ostringstream csv;
+    BatchSolver::writeHeader(csv, OutputFormat::CSV, false);
+    BatchSolver::write(csv, results[0], OutputFormat::CSV, false);
+    EXPECT_EQ(csv.str().rfind("instance,status,objective,gap,nodes,lp_iterations,seconds,error\n"
+                              "/app/tests/teste1_20.txt,optimal,20,0,", 0), 0u) << csv.str();
+}
+
+TEST(BatchSolverTest, NodeLimitStopsSearch) {
+    BranchAndBoundOptions options;
+    options.presolve = false;
+    options.node_limit = 1;
+    const BatchResult result = BatchSolver(options, 1).solveOne("/app/tests/teste2_24.txt");
+
+    // A busca para após o primeiro nó, mantendo o incumbente das heurísticas da raiz
+    EXPECT_EQ(int(result.status), int(SolveStatus::FEASIBLE));
+    EXPECT_TRUE(result.has_solution);
+    EXPECT_EQ(result.stats.nodes, 1);
+    EXPECT_GE(result.stats.seconds, 0.0);
+}
+
+TEST(InstanceGeneratorTest, IsDeterministicAndRoundTripsThroughText) {
+    KnapsackParams params;
+    params.num_items = 15;
+    params.num_constraints = 3;
+    params.correlation = KnapsackCorrelation::STRONGLY;
+    params.seed = 7;
+    const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+    const KnapsackInstance same = InstanceGenerator::multiKnapsack(params);
+    EXPECT_EQ(instance.weights, same.weights);
+    EXPECT_EQ(instance.profits, same.profits);
+    EXPECT_EQ(instance.capacities, same.capacities);
+    params.seed = 8;
+    EXPECT_NE(InstanceGenerator::multiKnapsack(params).weights, instance.weights);
+
+    // Correlação forte: lucro = peso médio + R/10
+    for (int j = 0; j < instance.num_items; ++j) {
+        double mean = 0.0;
+        for (int i = 0; i < instance.num_constraints; ++i) {
+            mean += instance.weights[i * instance.num_items + j];
+        }
+        EXPECT_DOUBLE_EQ(instance.profits[j], std::round(mean / instance.num_constraints) + params.max_weight / 10);
+    }
+
+    // O texto denso gerado é lido de volta e tem o mesmo ótimo do problema criado diretamente
+    std::ostringstream text;
+    instance.writeDenseText(text);
+    ProblemReader reader;
+    double objectives[2] = {0.0, 0.0};
+    glp_prob* problems[2] = {reader.parse(text.str(), InstanceFormat::DENSE_TEXT), instance.toGlpk()};
+    for (int k = 0; k < 2; ++k) {
+        BranchAndBound bb;
+        std::vector<int> solution;
+        ASSERT_EQ(int(bb.solve(GLPProbPtr(problems[k], GLPKProbDeleter()), solution, objectives[k])), int(SolveStatus::OK));
+    }
+    EXPECT_NEAR(objectives[0], objectives[1], 1e-6);
+
+    params.tightness = 1.5;
+    EXPECT_THROW(InstanceGenerator::multiKnapsack(params), std::invalid_argument);
+}
+
+TEST(SolveStatsTest, CountsNodesPhasesAndReportsProgress) {
+    std::ostringstream sink;
+    Logger& logger = Logger::instance();
+    const LogLevel previous = logger.level();
+    logger.setSink(sink);
+    logger.setLevel(LogLevel::INFO);
+
+    ProblemReader reader;
+    GLPProbPtr problem(reader.read("/app/tests/teste2_24.txt"), GLPKProbDeleter());
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.presolve = false;
+    options.progress_interval = 1e-9; // Uma linha de progresso por nó
+    BranchAndBound bb(options);
+    std::vector<int> solution;
+    double objective_value = 0.0;
+    ASSERT_EQ(int(bb.solve(std::move(problem), solution, objective_value)), int(SolveStatus::OK));
+    logger.flush();
+    logger.setLevel(previous);
+    logger.setSink(std::clog);
+
+    const SolveStats& stats = bb.stats();
+    EXPECT_GT(stats.nodes, 1);
+    EXPECT_EQ(stats.nodes, stats.nodes_pruned + stats.nodes_infeasible + stats.nodes_integer + stats.nodes_branched);
+    EXPECT_GT(stats.nodes_branched, 0);
+    EXPECT_GT(stats.max_depth, 0);
+    EXPECT_GT(stats.peak_open_nodes, 0);
+    EXPECT_GT(stats.lp_iterations, 0);
+    // Árvore esgotada: o limite coincide com o ótimo
+    EXPECT_NEAR(stats.best_bound, 24.0, 1e-6);
+    EXPECT_EQ(stats.gap, 0.0);
+    EXPECT_GT(stats.lp_seconds, 0.0);
+    EXPECT_LE(stats.lp_seconds, stats.search_seconds);
+    EXPECT_LE(stats.search_seconds, stats.seconds);
+
+    EXPECT_NE(sink.str().find("[Progresso][INFO]"), std::string::npos) << sink.str();
+    EXPECT_NE(sink.str().find("| gap "), std::string::npos);
+
+    // Limite de nós: o gap fica aberto e o limite vem dos nós que sobraram
+    GLPProbPtr limited(reader.read("/app/tests/teste2_24.txt"), GLPKProbDeleter());
+    options.progress_interval = 0.0;
+    options.node_limit = 1;
+    BranchAndBound stopped(options);
+    EXPECT_EQ(int(stopped.solve(std::move(limited), solution, objective_value)), int(SolveStatus::FEASIBLE));
+    EXPECT_EQ(stopped.stats().nodes, 1);
+    EXPECT_GE(stopped.stats().best_bound, 24.0 - 1e-6);
+}
+
+TEST(SearchLimitsTest, GapLimitsAndIncumbentCallback) {
+    KnapsackParams params;
+    params.num_items = 20;
+    params.correlation = KnapsackCorrelation::STRONGLY;
+    const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+    GLPProbPtr original(instance.toGlpk(), GLPKProbDeleter());
+    const ProblemModel model = ProblemModel::fromGlpk(original.get());
+
+    std::vector<int> solution;
+    double exact = 0.0;
+    BranchAndBound exact_bb;
+    ASSERT_EQ(int(exact_bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, exact)), int(SolveStatus::OK));
+
+    // Gap relativo de 5%: a árvore fecha antes, com garantia sobre o valor encontrado
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.relative_gap = 0.05;
+    std::vector<double> improvements;
+    options.on_incumbent = [&](const IncumbentUpdate& update) {
+        EXPECT_TRUE(model.isFeasible(update.solution));
+        EXPECT_NEAR(model.objectiveValue(update.solution), update.objective, 1e-6);
+        EXPECT_GE(update.seconds, 0.0);
+        improvements.push_back(update.objective);
+    };
+    BranchAndBound bb(options);
+    double objective = 0.0;
+    ASSERT_EQ(int(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective)), int(SolveStatus::OK));
+    EXPECT_GE(objective, exact * (1.0 - 0.05) - 1e-6);
+    EXPECT_LE(bb.stats().gap, 0.05 + 1e-9);
+    EXPECT_GE(bb.stats().best_bound, exact - 1e-6);
+    EXPECT_LE(bb.stats().nodes, exact_bb.stats().nodes);
+
+    // Notificações em ordem estritamente crescente, terminando no valor devolvido
+    ASSERT_FALSE(improvements.empty());
+    EXPECT_TRUE(std::is_sorted(improvements.begin(), improvements.end()));
+    EXPECT_EQ(std::adjacent_find(improvements.begin(), improvements.end()), improvements.end());
+    EXPECT_NEAR(improvements.back(), objective, 1e-6);
+
+    // Minimização: o valor notificado está no sentido original
+    ProblemReader reader;
+    BranchAndBoundOptions min_options;
+    double last = 0.0;
+    min_options.on_incumbent = [&last](const IncumbentUpdate& update) { last = update.objective; };
+    BranchAndBound min_bb(min_options);
+    ASSERT_EQ(int(min_bb.solve(GLPProbPtr(reader.read("/app/tests/teste3_19.mps"), GLPKProbDeleter()), solution, objective)),
+              int(SolveStatus::OK));
+    EXPECT_NEAR(last, -19.0, 1e-6);
+
+    // Prazo esgotado antes do primeiro nó: nenhuma solução
+    BranchAndBoundOptions timed;
+    timed.time_limit = 1e-9;
+    timed.presolve = false;
+    BranchAndBound timed_bb(timed);
+    EXPECT_EQ(int(timed_bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective)),
+              int(SolveStatus::LIMIT_REACHED));
+    EXPECT_EQ(timed_bb.stats().nodes, 0);
+}
+
+TEST(MemoryBoundedSearchTest, SpillsNodesAndFindsOptimum) {
+    // Arquivo de transbordo: volta primeiro o maior limite, com as fixações intactas
+    FixingArena arena;
+    NodeSpillFile file;
+    const double bounds[3] = {1.0, 3.0, 2.0};
+    for (int k = 0; k < 3; ++k) {
+        Node node(nullptr, arena.make({{k, 1}, {k + 5, 0}}), bounds[k], NodeType::LEFT_CHILD);
+        node.depth = k + 2;
+        file.write(node);
+    }
+    EXPECT_EQ(file.size(), 3u);
+    EXPECT_DOUBLE_EQ(file.bestBound(), 3.0);
+    const Node best = file.readBest();
+    EXPECT_DOUBLE_EQ(best.bound, 3.0);
+    EXPECT_EQ(best.depth, 3);
+    EXPECT_EQ(best.fixings.toVector(), (std::vector<std::pair<int, int>>{{1, 1}, {6, 0}}));
+    EXPECT_EQ(file.discardDominated(1.5), 1u);
+    EXPECT_DOUBLE_EQ(file.readBest().bound, 2.0);
+    EXPECT_TRUE(file.empty());
+
+    // Busca em largura com orçamento menor que o de um mergulho: transborda para disco e ainda encontra o ótimo
+    KnapsackParams params;
+    params.num_items = 20;
+    params.correlation = KnapsackCorrelation::STRONGLY;
+    const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+    std::vector<int> solution;
+    double exact = 0.0;
+    BranchAndBound exact_bb;
+    ASSERT_EQ(int(exact_bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, exact)), int(SolveStatus::OK));
+
+    for (LpStrategy strategy : {LpStrategy::COPY_PER_NODE, LpStrategy::SHARED_TRAIL}) {
+        BranchAndBoundOptions options;
+        options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+        options.node_selection = NodeSelection::BREADTH_FIRST;
+        options.lp_strategy = strategy;
+        options.node_memory_limit = 1024;
+        BranchAndBound bb(options);
+        double objective = 0.0;
+        ASSERT_EQ(int(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective)),
+                  int(SolveStatus::OK));
+        EXPECT_NEAR(objective, exact, 1e-6);
+        EXPECT_GT(bb.stats().nodes_spilled, 0);
+        EXPECT_GT(bb.stats().peak_open_bytes, 0);
+    }
+
+    EXPECT_THROW(MemoryBoundedSelector(nullptr, 4096, 0), std::invalid_argument);
+    EXPECT_THROW(MemoryBoundedSelector(makeNodeSelector(NodeSelection::DEPTH_FIRST), 0, 0), std::invalid_argument);
+}
+
+TEST(SymmetryTest, DetectsIdenticalColumnsAndFixesOrbits) {
+    // Cinco tipos de item com quatro cópias cada, intercaladas: coluna j é do tipo j % 5
+    KnapsackParams params;
+    params.num_items = 5;
+    params.num_constraints = 3;
+    params.seed = 11;
+    const KnapsackInstance types = InstanceGenerator::multiKnapsack(params);
+    KnapsackInstance instance;
+    instance.num_items = 20;
+    instance.num_constraints = types.num_constraints;
+    instance.capacities = types.capacities;
+    for (double& capacity : instance.capacities) {
+        capacity *= 3.0;
+    }
+    instance.weights.resize(static_cast<size_t>(instance.num_constraints * instance.num_items));
+    for (int j = 0; j < instance.num_items; ++j) {
+        instance.profits.push_back(types.profits[j % 5]);
+        for (int i = 0; i < instance.num_constraints; ++i) {
+            instance.weights[i * instance.num_items + j] = types.weights[i * 5 + j % 5];
+        }
+    }
+
+    GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+    const ColumnSymmetry symmetry = ColumnSymmetry::detect(model);
+    ASSERT_EQ(symmetry.classes().size(), 5u);
+    EXPECT_EQ(symmetry.symmetricColumns(), 20);
+    for (const std::vector<int>& columns : symmetry.classes()) {
+        ASSERT_EQ(columns.size(), 4u);
+        for (size_t k = 0; k < columns.size(); ++k) {
+            EXPECT_EQ(columns[k], columns[0] + 5 * static_cast<int>(k));
+        }
+    }
+
+    // x_10 = 1 fixa em 1 as cópias anteriores (0 e 5); x_6 = 0 fixa em 0 as posteriores (11 e 16)
+    std::vector<std::pair<int, int>> fixed = {{10, 1}, {6, 0}};
+    ASSERT_TRUE(symmetry.propagate(fixed));
+    std::sort(fixed.begin(), fixed.end());
+    EXPECT_EQ(fixed, (std::vector<std::pair<int, int>>{{0, 1}, {5, 1}, {6, 0}, {10, 1}, {11, 0}, {16, 0}}));
+    std::vector<std::pair<int, int>> violated = {{2, 0}, {12, 1}};
+    EXPECT_FALSE(symmetry.propagate(violated));
+
+    // O workspace reaproveitado volta a ficar livre, inclusive depois de uma violação
+    SymmetryWorkspace workspace;
+    violated = {{2, 0}, {12, 1}};
+    EXPECT_FALSE(symmetry.propagate(violated, workspace));
+    std::vector<std::pair<int, int>> reused = {{10, 1}, {6, 0}};
+    ASSERT_TRUE(symmetry.propagate(reused, workspace));
+    std::sort(reused.begin(), reused.end());
+    EXPECT_EQ(reused, fixed);
+    std::vector<std::pair<int, int>> alone = {{12, 1}};
+    ASSERT_TRUE(symmetry.propagate(alone, workspace));
+    EXPECT_EQ(alone.size(), 3u);
+
+    // Mesmo ótimo com e sem a quebra de simetria, explorando menos nós com ela
+    double objectives[2] = {0.0, 0.0};
+    long long nodes[2] = {0, 0};
+    for (int k = 0; k < 2; ++k) {
+        BranchAndBoundOptions options;
+        options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+        options.presolve = false;
+        options.symmetry = k == 0;
+        options.node_selection = NodeSelection::BREADTH_FIRST;
+        BranchAndBound bb(options);
+        std::vector<int> solution;
+        ASSERT_EQ(int(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objectives[k])),
+                  int(SolveStatus::OK));
+        EXPECT_TRUE(model.isFeasible(solution));
+        nodes[k] = bb.stats().nodes;
+    }
+    EXPECT_NEAR(objectives[0], objectives[1], 1e-6);
+    EXPECT_LT(nodes[0], nodes[1]);
+}
+
+TEST(ConflictsTest, ExplainsPrunedNodesAndReusesNogoods) {
+    // Linha 3 x0 + 4 x1 + 5 x2 <= 6: com x0 = x1 = 1 e x2 = 0, só as duas primeiras explicam a violação
+    KnapsackInstance instance;
+    instance.num_items = 3;
+    instance.num_constraints = 1;
+    instance.profits = {1.0, 1.0, 1.0};
+    instance.weights = {3.0, 4.0, 5.0};
+    instance.capacities = {6.0};
+    GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+    const ConflictAnalyzer analyzer(model);
+    Conflict conflict;
+    ASSERT_TRUE(analyzer.explainRow(0, {{0, 1}, {1, 1}, {2, 0}}, conflict));
+    std::sort(conflict.fixings.begin(), conflict.fixings.end());
+    EXPECT_EQ(conflict.fixings, (std::vector<std::pair<int, int>>{{0, 1}, {1, 1}}));
+    EXPECT_FALSE(analyzer.explainRow(0, {{0, 1}, {2, 0}}, conflict));
+
+    // Limite 10 com corte 12: liberar x1 = 0 (ganho 1) e x0 = 1 (ganho 0) ainda poda; x2 = 0 (ganho 5) fica
+    const Conflict bound = ConflictAnalyzer::explainBound({{0, 1}, {1, 0}, {2, 0}}, {2.0, 1.0, 5.0}, 10.0, 12.0);
+    EXPECT_EQ(bound.fixings, (std::vector<std::pair<int, int>>{{2, 0}}));
+    EXPECT_DOUBLE_EQ(bound.bound, 11.0);
+
+    // Pool: poda quem contém o nogood, fixa a variável que falta e ignora nogoods acima do corte
+    ConflictParams params;
+    params.pool_size = 2;
+    params.max_size = 2;
+    ConflictPool pool(5, params);
+    EXPECT_TRUE(pool.add(Conflict{{{3, 1}, {1, 0}}, -std::numeric_limits<double>::infinity()}));
+    EXPECT_TRUE(pool.add(Conflict{{{2, 0}}, 11.0}));
+    EXPECT_FALSE(pool.add(Conflict{{{0, 1}, {1, 1}, {2, 1}}, 0.0}));
+    // Um único workspace em todas as verificações: cada uma devolve as colunas livres
+    ConflictWorkspace workspace;
+    std::vector<std::pair<int, int>> fixed = {{1, 0}, {3, 1}};
+    EXPECT_TRUE(pool.check(fixed, 0.0, workspace).pruned);
+    fixed = {{1, 0}};
+    const ConflictCheck implied = pool.check(fixed, 10.0, workspace);
+    EXPECT_FALSE(implied.pruned);
+    EXPECT_EQ(implied.implied, 1);
+    EXPECT_EQ(fixed.back(), std::make_pair(3, 0));
+    fixed = {{2, 0}};
+    EXPECT_FALSE(pool.check(fixed, 10.0, workspace).pruned);
+    EXPECT_TRUE(pool.check(fixed, 11.0, workspace).pruned);
+    fixed = {{1, 0}};
+    EXPECT_EQ(pool.check(fixed, 10.0).implied, 1);
+    EXPECT_EQ(pool.size(), 2u);
+
+    // Com o pool cheio, o nogood mais antigo sai também do índice por fixação
+    EXPECT_TRUE(pool.add(Conflict{{{4, 1}, {0, 0}}, 5.0}));
+    EXPECT_EQ(pool.size(), 2u);
+    fixed = {{1, 0}, {3, 1}};
+    EXPECT_FALSE(pool.check(fixed, 10.0, workspace).pruned);
+    fixed = {{0, 0}, {4, 1}};
+    EXPECT_TRUE(pool.check(fixed, 10.0, workspace).pruned);
+    fixed = {{4, 1}};
+    EXPECT_EQ(pool.check(fixed, 4.0, workspace).implied, 0);
+    EXPECT_EQ(pool.check(fixed, 5.0, workspace).implied, 1);
+    EXPECT_EQ(fixed.back(), std::make_pair(0, 1));
+
+    // Busca completa: mesmo ótimo com e sem o pool, que aprende e reutiliza nogoods
+    KnapsackParams knapsack;
+    knapsack.num_items = 20;
+    knapsack.correlation = KnapsackCorrelation::STRONGLY;
+    const KnapsackInstance generated = InstanceGenerator::multiKnapsack(knapsack);
+    double objectives[2] = {0.0, 0.0};
+    for (int k = 0; k < 2; ++k) {
+        BranchAndBoundOptions options;
+        options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+        options.conflicts.pool_size = k == 0 ? 1000 : 0;
+        options.node_selection = NodeSelection::BREADTH_FIRST;
+        BranchAndBound bb(options);
+        std::vector<int> solution;
+        ASSERT_EQ(int(bb.solve(GLPProbPtr(generated.toGlpk(), GLPKProbDeleter()), solution, objectives[k])),
+                  int(SolveStatus::OK));
+        if (k == 0) {
+            EXPECT_GT(bb.stats().conflicts_learned, 0);
+            EXPECT_GT(bb.stats().nodes_conflict_pruned, 0);
+        } else {
+            EXPECT_EQ(bb.stats().conflicts_learned, 0);
+        }
+    }
+    EXPECT_NEAR(objectives[0], objectives[1], 1e-6);
+}
+
+TEST(IncrementalSolveTest, ResolvesFromPriorSolutionAndOpenNodes) {
+    // Alterações: apertar um limite só restringe; afrouxar ou mudar o objetivo não
+    KnapsackParams params;
+    params.num_items = 20;
+    params.correlation = KnapsackCorrelation::STRONGLY;
+    const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+    const double inf = std::numeric_limits<double>::infinity();
+    {
+        GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+        ModelDelta tighten;
+        tighten.row_bounds.push_back({0, -inf, instance.capacities[0] - 1.0});
+        EXPECT_TRUE(tighten.apply(problem.get()));
+        EXPECT_DOUBLE_EQ(glp_get_row_ub(problem.get(), 1), instance.capacities[0] - 1.0);
+        ModelDelta relax;
+        relax.row_bounds.push_back({0, -inf, instance.capacities[0]});
+        EXPECT_FALSE(relax.apply(problem.get()));
+        ModelDelta profit;
+        profit.objective.emplace_back(3, instance.profits[3] + 1.0);
+        EXPECT_FALSE(profit.apply(problem.get()));
+        ModelDelta same_coefficient;
+        same_coefficient.coefficients.push_back({1, 2, instance.weights[params.num_items + 2]});
+        EXPECT_TRUE(same_coefficient.apply(problem.get()));
+        ModelDelta invalid;
+        invalid.coefficients.push_back({0, params.num_items, 1.0});
+        EXPECT_THROW(invalid.apply(problem.get()), std::invalid_argument);
+    }
+
+    // Resolve do zero o problema alterado, para comparação
+    auto fresh = [&](const ModelDelta& delta) {
+        GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+        delta.apply(problem.get());
+        BranchAndBound bb;
+        std::vector<int> solution;
+        double objective = 0.0;
+        EXPECT_EQ(int(bb.solve(std::move(problem), solution, objective)), int(SolveStatus::OK));
+        return objective;
+    };
+
+    for (int threads : {1, 2}) {
+        // Execução interrompida: a fronteira fica guardada e a alteração que só restringe a reaproveita
+        BranchAndBoundOptions options;
+        options.num_threads = threads;
+        options.node_limit = 15;
+        BranchAndBound bb(options);
+        std::vector<int> solution;
+        double objective = 0.0;
+        ASSERT_EQ(int(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective)),
+                  int(SolveStatus::FEASIBLE));
+        ASSERT_TRUE(bb.warmStart().frontier_complete);
+        EXPECT_FALSE(bb.warmStart().open_nodes.empty());
+        EXPECT_EQ(bb.warmStart().solution, solution);
+
+        ModelDelta tighten;
+        tighten.row_bounds.push_back({1, -inf, instance.capacities[1] - 2.0});
+        bb.options().node_limit = 0;
+        ASSERT_EQ(int(bb.resolve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), tighten, solution, objective)),
+                  int(SolveStatus::OK));
+        EXPECT_NEAR(objective, fresh(tighten), 1e-6);
+        EXPECT_TRUE(bb.warmStart().open_nodes.empty());
+
+        // Árvore esgotada e solução anterior ainda viável: ela é ótima sem nenhum nó
+        GLPProbPtr restricted(instance.toGlpk(), GLPKProbDeleter());
+        tighten.apply(restricted.get());
+        const double previous = objective;
+        ModelDelta keep_optimum;
+        keep_optimum.row_bounds.push_back({0, -inf, instance.capacities[0] - 0.5});
+        double used = 0.0;
+        for (int j = 0; j < params.num_items; ++j) {
+            used += instance.weights[j] * solution[j];
+        }
+        keep_optimum.row_bounds.back().upper = std::max(used, instance.capacities[0] - 0.5);
+        ASSERT_EQ(int(bb.resolve(std::move(restricted), keep_optimum, solution, objective)), int(SolveStatus::OK));
+        EXPECT_NEAR(objective, previous, 1e-6);
+        EXPECT_EQ(bb.stats().nodes, 0);
+
+        // Objetivo alterado: só a solução anterior é reaproveitada
+        ModelDelta profit;
+        profit.objective.emplace_back(0, instance.profits[0] + 10.0);
+        ASSERT_EQ(int(bb.resolve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), profit, solution, objective)),
+                  int(SolveStatus::OK));
+        EXPECT_NEAR(objective, fresh(profit), 1e-6);
+    }
+
+    // Ponto de partida com número de colunas errado
+    BranchAndBound bb;
+    std::vector<int> solution;
+    double objective = 0.0;
+    WarmStart start;
+    start.solution.assign(3, 0);
+    EXPECT_THROW(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective, start),
+                 std::invalid_argument);
+}
+
+TEST(FixingArenaTest, SharesPrefixesAndRecyclesLinks) {
+    FixingArena arena;
+    {
+        // Dois filhos sobre o mesmo pai: o prefixo não é copiado
+        const FixingChain parent = arena.make({{4, 1}, {2, 0}});
+        const FixingChain left = arena.extend(parent, 7, 0);
+        const FixingChain right = arena.extend(parent, 7, 1);
+        EXPECT_EQ(arena.liveLinks(), 4u);
+        EXPECT_EQ(left.size(), 3u);
+        EXPECT_EQ(left.toVector(), (std::vector<std::pair<int, int>>{{4, 1}, {2, 0}, {7, 0}}));
+        EXPECT_EQ(right.toVector(), (std::vector<std::pair<int, int>>{{4, 1}, {2, 0}, {7, 1}}));
+
+        // O pai sobrevive enquanto algum filho o referencia
+        FixingChain survivor = left;
+        {
+            const FixingChain moved = std::move(survivor);
+            EXPECT_TRUE(survivor.empty());
+            EXPECT_EQ(moved.size(), 3u);
+        }
+        EXPECT_EQ(arena.liveLinks(), 4u);
+    }
+    EXPECT_EQ(arena.liveLinks(), 0u);
+
+    // Elos liberados são reutilizados: uma árvore inteira cabe no primeiro bloco
+    const std::size_t capacity = arena.capacity();
+    for (int round = 0; round < 3; ++round) {
+        std::vector<FixingChain> open(1);
+        for (int depth = 0; depth < 12; ++depth) {
+            std::vector<FixingChain> children;
+            for (const FixingChain& node : open) {
+                if (children.size() < 64) {
+                    children.push_back(arena.extend(node, depth, 0));
+                    children.push_back(arena.extend(node, depth, 1));
+                }
+            }
+            open = std::move(children);
+        }
+        EXPECT_EQ(open.front().size(), 12u);
+    }
+    EXPECT_EQ(arena.liveLinks(), 0u);
+    EXPECT_EQ(arena.capacity(), capacity);
+    EXPECT_EQ(capacity, FixingArena::BLOCK_LINKS);
+}
+
+TEST(BasisPoolTest, RecyclesBasesAndControlBlocks) {
+    ProblemReader reader;
+    GLPKSolver solver(GLPProbPtr(reader.read("/app/tests/teste3_19.txt"), GLPKProbDeleter()));
+    std::vector<double> relaxed;
+    double objective = 0.0;
+    ASSERT_EQ(int(solver.solve(relaxed, objective)), int(SolveStatus::OK));
+    const LpBasis expected = solver.saveBasis();
+
+    BasisPool pool;
+    {
+        // Os dois filhos compartilham a base do pai
+        const std::shared_ptr<const LpBasis> parent = pool.save(solver);
+        std::shared_ptr<const LpBasis> left = parent;
+        const std::shared_ptr<const LpBasis> other = pool.save(solver);
+        EXPECT_EQ(parent->row_stat, expected.row_stat);
+        EXPECT_EQ(parent->col_stat, expected.col_stat);
+        EXPECT_EQ(pool.liveBases(), 2u);
+        left.reset();
+        EXPECT_EQ(pool.liveBases(), 2u);
+    }
+    EXPECT_EQ(pool.liveBases(), 0u);
+
+    // Bases devolvidas são reutilizadas com a mesma memória
+    const LpBasis* first;
+    {
+        const std::shared_ptr<const LpBasis> basis = pool.save(solver);
+        first = basis.get();
+    }
+    for (int round = 0; round < 3; ++round) {
+        std::vector<std::shared_ptr<const LpBasis>> open;
+        open.push_back(pool.save(solver));
+        open.push_back(pool.save(solver));
+        EXPECT_TRUE(open[0].get() == first || open[1].get() == first);
+        EXPECT_EQ(open[1]->col_stat, expected.col_stat);
+    }
+    EXPECT_EQ(pool.liveBases(), 0u);
+    EXPECT_EQ(pool.capacity(), 2u);
+
+    // Muitas bases vivas ao mesmo tempo (tabela de relaxações): todas voltam ao pool
+    {
+        std::vector<std::shared_ptr<const LpBasis>> open;
+        for (int k = 0; k < 1000; ++k) {
+            open.push_back(pool.save(solver));
+        }
+        EXPECT_EQ(pool.liveBases(), 1000u);
+    }
+    EXPECT_EQ(pool.liveBases(), 0u);
+    EXPECT_EQ(pool.capacity(), 1000u);
+}
+
+TEST(LpCacheTest, ReusesRelaxationsAcrossRuns) {
+    KnapsackParams params;
+    params.num_items = 20;
+    params.correlation = KnapsackCorrelation::STRONGLY;
+    const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+    GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+    std::vector<int> columns(static_cast<size_t>(model.numCols()));
+    std::iota(columns.begin(), columns.end(), 0);
+
+    // Chave independente da ordem; limite válido só enquanto o modelo não é relaxado
+    LpCache cache(1 << 16);
+    cache.prepare(model, columns);
+    const LpCacheKey key = LpCache::keyOf({{3, 1}, {5, 0}});
+    EXPECT_EQ(LpCache::keyOf({{5, 0}, {3, 1}}).hash, key.hash);
+    EXPECT_NE(LpCache::keyOf({{3, 1}, {5, 1}}).hash, key.hash);
+    CachedLp cached;
+    EXPECT_FALSE(cache.lookup(key, cached));
+    cache.store(key, 42.0, std::make_shared<const LpBasis>());
+    ASSERT_TRUE(cache.lookup(key, cached));
+    EXPECT_DOUBLE_EQ(cached.bound, 42.0);
+    EXPECT_TRUE(cached.bound_valid);
+    cache.prepare(model, columns);
+    ASSERT_TRUE(cache.lookup(key, cached));
+    EXPECT_TRUE(cached.bound_valid);
+    glp_set_row_bnds(problem.get(), 1, GLP_UP, 0.0, instance.capacities[0] + 1.0);
+    cache.prepare(ProblemModel::fromGlpk(problem.get()), columns);
+    ASSERT_TRUE(cache.lookup(key, cached));
+    EXPECT_FALSE(cached.bound_valid);
+    EXPECT_TRUE(cached.basis);
+    columns[0] = 1;
+    cache.prepare(model, columns);
+    EXPECT_FALSE(cache.lookup(key, cached));
+    EXPECT_EQ(cache.hits(), 3);
+    EXPECT_EQ(cache.misses(), 2);
+
+    // Mesmo modelo resolvido de novo, sem ponto de partida: os nós repetidos partem da base guardada
+    // e são podados pelo limite guardado assim que há incumbente
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    options.lp_cache_bytes = 1 << 22;
+    BranchAndBound bb(options);
+    std::vector<int> solution;
+    double first = 0.0;
+    ASSERT_EQ(int(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, first)), int(SolveStatus::OK));
+    EXPECT_EQ(bb.stats().lp_cache_hits, 0);
+    const long long first_iterations = bb.stats().lp_iterations;
+    double second = 0.0;
+    ASSERT_EQ(int(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, second)), int(SolveStatus::OK));
+    EXPECT_NEAR(second, first, 1e-6);
+    EXPECT_GT(bb.stats().lp_cache_hits, 0);
+    EXPECT_LT(bb.stats().lp_iterations, first_iterations);
+
+    // Objetivo alterado: só as bases são reaproveitadas, e o resultado confere com a resolução do zero
+    ModelDelta profit;
+    profit.objective.emplace_back(0, instance.profits[0] + 10.0);
+    double changed = 0.0;
+    ASSERT_EQ(int(bb.resolve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), profit, solution, changed)),
+              int(SolveStatus::OK));
+    EXPECT_EQ(bb.stats().nodes_cache_pruned, 0);
+    GLPProbPtr fresh_problem(instance.toGlpk(), GLPKProbDeleter());
+    profit.apply(fresh_problem.get());
+    BranchAndBound fresh;
+    double expected = 0.0;
+    ASSERT_EQ(int(fresh.solve(std::move(fresh_problem), solution, expected)), int(SolveStatus::OK));
+    EXPECT_NEAR(changed, expected, 1e-6);
+}
+
+TEST(KnapsackEnginesTest, DispatchesByStructureAndMatchesLpSearch) {
+    // Uma restrição: branch and bound combinatório; várias com capacidades pequenas: programação dinâmica;
+    // capacidades grandes: LP
+    struct Case {
+        int constraints;
+        int max_weight;
+        SolverEngine expected;
+    };
+    const Case cases[] = {{1, 1000, SolverEngine::COMBINATORIAL},
+                          {3, 10, SolverEngine::DYNAMIC_PROGRAMMING},
+                          {3, 1000, SolverEngine::LP_BRANCH_AND_BOUND}};
+    for (const Case& test_case : cases) {
+        for (std::uint64_t seed = 1; seed <= 3; ++seed) {
+            KnapsackParams params;
+            params.num_items = 25;
+            params.num_constraints = test_case.constraints;
+            params.max_weight = test_case.max_weight;
+            params.correlation = KnapsackCorrelation::WEAKLY;
+            params.seed = seed;
+            const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+
+            BranchAndBound automatic;
+            std::vector<int> solution;
+            double objective = 0.0;
+            ASSERT_EQ(int(automatic.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective)),
+                      int(SolveStatus::OK));
+            EXPECT_EQ(int(automatic.stats().engine), int(test_case.expected));
+            EXPECT_NEAR(automatic.stats().gap, 0.0, 1e-9);
+            ASSERT_EQ(solution.size(), static_cast<size_t>(instance.num_items));
+            double profit = 0.0;
+            for (int j = 0; j < instance.num_items; ++j) {
+                profit += instance.profits[j] * solution[j];
+            }
+            EXPECT_NEAR(profit, objective, 1e-6);
+
+            BranchAndBoundOptions options;
+            options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+            BranchAndBound lp(options);
+            double expected = 0.0;
+            ASSERT_EQ(int(lp.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, expected)),
+                      int(SolveStatus::OK));
+            EXPECT_NEAR(objective, expected, 1e-6);
+        }
+    }
+
+    // Algoritmo forçado que não se aplica cai no LP
+    KnapsackParams params;
+    params.num_items = 12;
+    params.num_constraints = 2;
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::COMBINATORIAL;
+    BranchAndBound forced(options);
+    std::vector<int> solution;
+    double objective = 0.0;
+    ASSERT_EQ(int(forced.solve(GLPProbPtr(InstanceGenerator::multiKnapsack(params).toGlpk(), GLPKProbDeleter()),
+                               solution, objective)), int(SolveStatus::OK));
+    EXPECT_EQ(int(forced.stats().engine), int(SolverEngine::LP_BRANCH_AND_BOUND));
+
+    // Empacotamento esparso com linhas * colunas acima do limite denso: forma reconhecida, pesos esparsos
+    const int rows = 2100;
+    const int cols = 2000;
+    GLPProbPtr packing(glp_create_prob(), GLPKProbDeleter());
+    glp_set_obj_dir(packing.get(), GLP_MAX);
+    glp_add_rows(packing.get(), rows);
+    glp_add_cols(packing.get(), cols);
+    for (int j = 1; j <= cols; ++j) {
+        glp_set_col_kind(packing.get(), j, GLP_BV);
+        glp_set_obj_coef(packing.get(), j, 1.0 + j % 7);
+    }
+    for (int i = 1; i <= rows; ++i) {
+        const int index[3] = {0, (i - 1) % cols + 1, i % cols + 1};
+        const double value[3] = {0.0, 1.0, 1.0};
+        glp_set_row_bnds(packing.get(), i, GLP_UP, 0.0, 1.0);
+        glp_set_mat_row(packing.get(), i, 2, index, value);
+    }
+    ASSERT_GT(static_cast<std::size_t>(rows) * cols, ProblemModel::DENSE_MAX_ENTRIES);
+    const ProblemModel sparse = ProblemModel::fromGlpk(packing.get());
+    KnapsackForm form;
+    ASSERT_TRUE(KnapsackForm::extract(sparse, form));
+    EXPECT_EQ(form.rows.size(), static_cast<size_t>(rows));
+    EXPECT_FALSE(form.hasDenseWeights());
+    EXPECT_TRUE(form.integral_weights);
+    EXPECT_FALSE(form.fitsDynamicProgramming(DynamicProgrammingKnapsack::MAX_STATES,
+                                             DynamicProgrammingKnapsack::MAX_CELLS));
+    LagrangianParams lagrangian;
+    lagrangian.enabled = true;
+    EXPECT_EQ(LagrangianBound::create(sparse, lagrangian), nullptr);
+
+    // Um coeficiente negativo na última linha descarta a forma
+    const int index[2] = {0, 1};
+    const double negative[2] = {0.0, -1.0};
+    glp_set_mat_row(packing.get(), rows, 1, index, negative);
+    EXPECT_FALSE(KnapsackForm::extract(ProblemModel::fromGlpk(packing.get()), form));
+}
+
+TEST(LagrangianTest, BoundsNodesWithoutLp) {
+    KnapsackParams params;
+    params.num_items = 30;
+    params.num_constraints = 4;
+    params.correlation = KnapsackCorrelation::WEAKLY;
+    params.seed = 3;
+    const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    BranchAndBound reference(options);
+    std::vector<int> solution;
+    double expected = 0.0;
+    ASSERT_EQ(int(reference.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, expected)),
+              int(SolveStatus::OK));
+
+    // Limite da raiz acima do ótimo; fixar em 1 mais do que cabe na linha mantida é inviável
+    GLPProbPtr problem(instance.toGlpk(), GLPKProbDeleter());
+    const ProblemModel model = ProblemModel::fromGlpk(problem.get());
+    LagrangianParams lagrangian;
+    const std::unique_ptr<LagrangianBound> bound = LagrangianBound::create(model, lagrangian);
+    ASSERT_TRUE(bound);
+    EXPECT_GE(bound->rootBound(), expected - 1e-6);
+    LagrangianWorkspace workspace;
+    std::vector<std::pair<int, int>> all_in;
+    for (int j = 0; j < instance.num_items; ++j) {
+        all_in.emplace_back(j, 1);
+    }
+    EXPECT_TRUE(std::isinf(bound->bound(all_in, expected, workspace)));
+    std::vector<std::pair<int, int>> optimal_fixings;
+    for (int j = 0; j < instance.num_items; ++j) {
+        optimal_fixings.emplace_back(j, solution[j]);
+    }
+    EXPECT_GE(bound->bound(optimal_fixings, expected - 1.0, workspace), expected - 1e-6);
+
+    // Mesmo ótimo com a poda lagrangiana, com nós podados sem LP
+    options.lagrangian.enabled = true;
+    BranchAndBound bb(options);
+    double objective = 0.0;
+    ASSERT_EQ(int(bb.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective)),
+              int(SolveStatus::OK));
+    EXPECT_NEAR(objective, expected, 1e-6);
+    EXPECT_GT(bb.stats().nodes_lagrangian_pruned, 0);
+
+    // Linha com peso negativo: não é mochila e o limite não se aplica
+    glp_set_mat_row(problem.get(), 1, 0, nullptr, nullptr);
+    int index[] = {0, 1, 2};
+    double values[] = {0.0, -1.0, 1.0};
+    glp_set_mat_row(problem.get(), 1, 2, index, values);
+    EXPECT_FALSE(LagrangianBound::create(ProblemModel::fromGlpk(problem.get()), lagrangian));
+}
+
+TEST(SimplexLimitTest, InterruptedRelaxationsAreResumedNotPruned) {
+    KnapsackParams params;
+    params.num_items = 20;
+    params.num_constraints = 3;
+    params.seed = 5;
+    const KnapsackInstance instance = InstanceGenerator::multiKnapsack(params);
+    BranchAndBoundOptions options;
+    options.engine = SolverEngine::LP_BRANCH_AND_BOUND;
+    BranchAndBound reference(options);
+    std::vector<int> solution;
+    double expected = 0.0;
+    ASSERT_EQ(int(reference.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, expected)),
+              int(SolveStatus::OK));
+
+    // Uma iteração por chamada: os nós param no limite, são retomados sem ele e o ótimo é o mesmo
+    options.simplex.iteration_limit = 1;
+    BranchAndBound limited(options);
+    double objective = 0.0;
+    ASSERT_EQ(int(limited.solve(GLPProbPtr(instance.toGlpk(), GLPKProbDeleter()), solution, objective)),
+              int(SolveStatus::OK));
+    EXPECT_NEAR(objective, expected, 1e-6);
+    EXPECT_GT(limited.stats().lp_limit_resolves, 0);
+}
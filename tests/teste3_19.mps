@@ -0,0 +1,150 @@
+* teste3_19 em MPS livre, como minimização do objetivo negado (ótimo -19)
+NAME teste3_19
+ROWS
+ N obj
+ L c1
+ L c2
+ L c3
+ L c4
+ L c5
+ L c6
+ L c7
+ L c8
+ L c9
+ L c10
+ L c11
+ L c12
+COLUMNS
+    MARKER 'MARKER' 'INTORG'
+    x1 obj -7
+    x1 c1 2
+    x1 c2 8
+    x1 c3 8
+    x1 c4 6
+    x1 c5 10
+    x1 c6 10
+    x1 c7 10
+    x1 c8 7
+    x1 c9 2
+    x1 c10 8
+    x1 c11 10
+    x1 c12 9
+    x2 obj -9
+    x2 c1 1
+    x2 c2 6
+    x2 c3 1
+    x2 c4 3
+    x2 c5 8
+    x2 c6 10
+    x2 c7 5
+    x2 c8 9
+    x2 c9 4
+    x2 c10 10
+    x2 c11 9
+    x2 c12 4
+    x3 obj -10
+    x3 c1 9
+    x3 c2 6
+    x3 c3 3
+    x3 c4 9
+    x3 c5 8
+    x3 c6 10
+    x3 c7 8
+    x3 c8 1
+    x3 c9 6
+    x3 c10 2
+    x3 c11 1
+    x3 c12 1
+    x4 obj -3
+    x4 c1 6
+    x4 c2 5
+    x4 c3 7
+    x4 c4 5
+    x4 c5 7
+    x4 c6 9
+    x4 c7 2
+    x4 c8 9
+    x4 c9 1
+    x4 c10 6
+    x4 c11 4
+    x4 c12 8
+    x5 obj -6
+    x5 c1 3
+    x5 c2 2
+    x5 c3 1
+    x5 c4 9
+    x5 c5 10
+    x5 c6 10
+    x5 c7 7
+    x5 c8 5
+    x5 c9 7
+    x5 c10 7
+    x5 c11 2
+    x5 c12 9
+    x6 obj -1
+    x6 c1 6
+    x6 c2 2
+    x6 c3 4
+    x6 c4 6
+    x6 c5 10
+    x6 c6 1
+    x6 c7 8
+    x6 c8 8
+    x6 c9 9
+    x6 c10 2
+    x6 c11 4
+    x6 c12 5
+    x7 obj -9
+    x7 c1 10
+    x7 c2 4
+    x7 c3 8
+    x7 c4 9
+    x7 c5 9
+    x7 c6 8
+    x7 c7 6
+    x7 c8 5
+    x7 c9 10
+    x7 c10 2
+    x7 c11 4
+    x7 c12 10
+    x8 obj -8
+    x8 c1 9
+    x8 c2 3
+    x8 c3 3
+    x8 c4 9
+    x8 c5 9
+    x8 c6 3
+    x8 c7 2
+    x8 c8 9
+    x8 c9 1
+    x8 c10 4
+    x8 c11 8
+    x8 c12 5
+    x9 obj -8
+    x9 c1 1
+    x9 c2 6
+    x9 c3 4
+    x9 c4 6
+    x9 c5 3
+    x9 c6 10
+    x9 c7 2
+    x9 c8 5
+    x9 c9 7
+    x9 c10 9
+    x9 c11 2
+    x9 c12 8
+    MARKER 'MARKER' 'INTEND'
+RHS
+    RHS c1 60
+    RHS c2 80
+    RHS c3 30
+    RHS c4 40
+    RHS c5 20
+    RHS c6 90
+    RHS c7 90
+    RHS c8 80
+    RHS c9 80
+    RHS c10 10
+    RHS c11 30
+    RHS c12 30
+ENDATA